@@ -0,0 +1,54 @@
+#
+#   Example that shows how to fill a table with many items in one call
+#
+#   License
+#
+#   This program is free software; you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation; either version 2 of the License, or
+#   (at your option) any later version.
+#
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+#   GNU General Public License for more details.
+#
+#   You should have received a copy of the GNU General Public License
+#   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+import sys
+sys.path.insert(0,'../../../build/swig/python')
+import yui
+
+factory = yui.YUI.widgetFactory()
+dialog = factory.createMainDialog()
+
+VBox = factory.createVBox(dialog)
+
+yTableHeader = yui.YTableHeader()
+yTableHeader.addColumn("package")
+yTableHeader.addColumn("version")
+yTableHeader.addColumn("release")
+yTableHeader.addColumn("arch")
+
+myTableMinSize = factory.createMinSize(VBox, 50, 12)
+myTable = factory.createTable(myTableMinSize, yTableHeader)
+
+myOK = factory.createPushButton(VBox, "OK")
+
+# Each row is either a list of cell labels or a tuple
+# ( labels, icon names, selected ). All items are created in C++ with one
+# call instead of wrapping each YTableItem and YTableCell.
+rows = [ [ "name-{0}".format(pkg), "1.0", "1", "x86_64" ] for pkg in range(1, 10000) ]
+rows.append( ( [ "yast2", "4.4", "1", "noarch" ], [ "yast.png" ], True ) )
+
+yui.addTableRows(myTable, rows)
+
+# The same with plain lists, available for all languages:
+#
+#   yui.addTableItems(myTable, [ [ "foo", "1.0", "1", "noarch" ] ])
+
+# The Python GIL is released while waiting, so other threads keep running
+event1 = dialog.waitForEvent()
+
+dialog.destroy()
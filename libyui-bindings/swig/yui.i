@@ -1,4 +1,8 @@
-%module yui
+/*
+ * threads="1" only enables the support for releasing the Python GIL; it is
+ * switched off for everything except the blocking calls below (%thread).
+ */
+%module(threads="1") yui
 
 #if defined(SWIGPERL5)
 %{
@@ -179,6 +183,16 @@ class Exception;
 %apply SWIGTYPE *DISOWN { YTableHeader *header_disown };
 %apply SWIGTYPE *DISOWN { YWidget *parent_disown };
 
+/*
+ * Release the Python GIL while waiting for the user, so other Python threads
+ * keep running. libyui does not call back into Python from there.
+ */
+#if defined(SWIGPYTHON)
+%nothread;
+%thread YDialog::waitForEvent;
+%thread YApplication::runInTerminal;
+#endif
+
 %include yui/YUILog.h
 %include yui/YUIPlugin.h
 
@@ -390,3 +404,248 @@ YTableCellIterator incrYTableCellIterator(YTableCellIterator currentIterator) {
 
 %}
 
+/*
+ * Bulk item construction: Creating each item and each cell through the
+ * wrappers and adding them one by one is slow for many items. These build
+ * all items natively and add them with a single addItems() call.
+ */
+#if !defined(SWIGCSHARP)
+
+namespace std {
+    %template(YStringVector) vector<string>;
+    %template(YStringVectorVector) vector< vector<string> >;
+    %template(YBoolVector) vector<bool>;
+}
+
+%inline %{
+
+/*
+ * Add one item per label to a SelectionBox, ComboBox etc.
+ * 'iconNames' and 'selected' may be shorter than 'labels' or empty.
+ */
+void addSelectionItems( YSelectionWidget *widget,
+                        const std::vector<std::string> &labels,
+                        const std::vector<std::string> &iconNames = std::vector<std::string>(),
+                        const std::vector<bool> &selected = std::vector<bool>() ) {
+  YItemCollection items;
+  items.reserve( labels.size() );
+
+  for ( size_t i = 0; i < labels.size(); ++i ) {
+    YItem *item = new YItem( labels[i], i < selected.size() && selected[i] );
+
+    if ( i < iconNames.size() && ! iconNames[i].empty() )
+      item->setIconName( iconNames[i] );
+
+    items.push_back( item );
+  }
+
+  widget->addItems( items );
+}
+
+/*
+ * Add one table item per row with one cell per label. 'iconNames' holds the
+ * icon names of the cells of each row. It and 'selected' may be shorter
+ * than 'rows' or empty.
+ */
+void addTableItems( YTable *table,
+                    const std::vector< std::vector<std::string> > &rows,
+                    const std::vector< std::vector<std::string> > &iconNames = std::vector< std::vector<std::string> >(),
+                    const std::vector<bool> &selected = std::vector<bool>() ) {
+  static const std::vector<std::string> noIcons;
+  YItemCollection items;
+  items.reserve( rows.size() );
+
+  for ( size_t i = 0; i < rows.size(); ++i ) {
+    const std::vector<std::string> &icons = i < iconNames.size() ? iconNames[i] : noIcons;
+    YTableItem *item = new YTableItem();
+
+    for ( size_t col = 0; col < rows[i].size(); ++col )
+      item->addCell( rows[i][col], col < icons.size() ? icons[col] : std::string() );
+
+    if ( i < selected.size() && selected[i] )
+      item->setSelected();
+
+    items.push_back( item );
+  }
+
+  table->addItems( items );
+}
+
+%}
+
+#endif
+
+#if defined(SWIGPYTHON)
+
+%exception addTableRows {
+  try {
+    $action
+  }
+  catch ( const std::invalid_argument &ex ) {
+    SWIG_exception( SWIG_TypeError, ex.what() );
+  }
+}
+
+%{
+static std::string pyToString( PyObject *obj ) {
+  std::string str;
+
+#if PY_MAJOR_VERSION >= 3
+  if ( ! PyUnicode_Check( obj ) )
+    throw std::invalid_argument( "table cells must be strings" );
+
+  const char *utf8 = PyUnicode_AsUTF8( obj );
+#else
+  if ( PyString_Check( obj ) )
+    return PyString_AsString( obj );
+
+  if ( ! PyUnicode_Check( obj ) )
+    throw std::invalid_argument( "table cells must be strings" );
+
+  PyObject *bytes = PyUnicode_AsUTF8String( obj );
+  const char *utf8 = bytes ? PyString_AsString( bytes ) : 0;
+#endif
+
+  if ( utf8 )
+    str = utf8;
+
+#if PY_MAJOR_VERSION < 3
+  Py_XDECREF( bytes );
+#endif
+
+  if ( ! utf8 ) {
+    /* e.g. lone surrogates; the C++ exception is turned into a TypeError */
+    PyErr_Clear();
+    throw std::invalid_argument( "table cells must be valid Unicode strings" );
+  }
+
+  return str;
+}
+
+static bool pyIsString( PyObject *obj ) {
+#if PY_MAJOR_VERSION >= 3
+  return PyUnicode_Check( obj );
+#else
+  return PyString_Check( obj ) || PyUnicode_Check( obj );
+#endif
+}
+
+/* Convert a sequence of strings; None is an empty sequence */
+static std::vector<std::string> pyToStrings( PyObject *seq ) {
+  std::vector<std::string> strings;
+
+  if ( seq == Py_None )
+    return strings;
+
+  if ( pyIsString( seq ) )
+    throw std::invalid_argument( "expected a sequence of strings, not a string" );
+
+  PyObject *fast = PySequence_Fast( seq, "expected a sequence of strings" );
+
+  if ( ! fast ) {
+    PyErr_Clear();
+    throw std::invalid_argument( "expected a sequence of strings" );
+  }
+
+  Py_ssize_t size = PySequence_Fast_GET_SIZE( fast );
+  strings.reserve( size );
+
+  try {
+    for ( Py_ssize_t i = 0; i < size; ++i )
+      strings.push_back( pyToString( PySequence_Fast_GET_ITEM( fast, i ) ) );
+  }
+  catch ( ... ) {
+    Py_DECREF( fast );
+    throw;
+  }
+
+  Py_DECREF( fast );
+
+  return strings;
+}
+
+/*
+ * Create a table item from a row: Either a sequence of cell labels or a
+ * tuple ( labels, iconNames, selected ) with optional iconNames and selected.
+ */
+static YTableItem *pyToTableItem( PyObject *row ) {
+  std::vector<std::string> labels;
+  std::vector<std::string> icons;
+  bool selected = false;
+
+  if ( PyTuple_Check( row ) && PyTuple_Size( row ) > 0 && ! pyIsString( PyTuple_GET_ITEM( row, 0 ) ) ) {
+    Py_ssize_t size = PyTuple_Size( row );
+    labels = pyToStrings( PyTuple_GET_ITEM( row, 0 ) );
+
+    if ( size > 1 )
+      icons = pyToStrings( PyTuple_GET_ITEM( row, 1 ) );
+
+    if ( size > 2 ) {
+      int isTrue = PyObject_IsTrue( PyTuple_GET_ITEM( row, 2 ) );
+
+      if ( isTrue < 0 ) {
+        PyErr_Clear();
+        throw std::invalid_argument( "invalid selected flag" );
+      }
+
+      selected = isTrue;
+    }
+  }
+  else {
+    labels = pyToStrings( row );
+  }
+
+  YTableItem *item = new YTableItem();
+
+  for ( size_t col = 0; col < labels.size(); ++col )
+    item->addCell( labels[col], col < icons.size() ? icons[col] : std::string() );
+
+  if ( selected )
+    item->setSelected();
+
+  return item;
+}
+%}
+
+%inline %{
+
+/*
+ * Python only: Add the rows of a sequence to 'table' with one call. Each row
+ * is either a sequence of cell labels or a tuple ( labels, iconNames,
+ * selected ), e.g.
+ *
+ *   yui.addTableRows( table, [ ( [ "foo", "1.0" ], [ "package.png" ], True ),
+ *                              [ "bar", "2.0" ] ] )
+ */
+void addTableRows( YTable *table, PyObject *rows ) {
+  PyObject *fast = PySequence_Fast( rows, "expected a sequence of rows" );
+
+  if ( ! fast ) {
+    PyErr_Clear();
+    throw std::invalid_argument( "expected a sequence of rows" );
+  }
+
+  Py_ssize_t size = PySequence_Fast_GET_SIZE( fast );
+  YItemCollection items;
+  items.reserve( size );
+
+  try {
+    for ( Py_ssize_t i = 0; i < size; ++i )
+      items.push_back( pyToTableItem( PySequence_Fast_GET_ITEM( fast, i ) ) );
+  }
+  catch ( ... ) {
+    for ( YItem *item: items )
+      delete item;
+
+    Py_DECREF( fast );
+    throw;
+  }
+
+  Py_DECREF( fast );
+  table->addItems( items );
+}
+
+%}
+
+#endif
+
@@ -458,6 +458,19 @@ bool NCPackageSelector::handleEvent ( const NCursesEvent&   event )
     if ( event == NCursesEvent::handled )
 	return false;
 
+    if ( event == NCursesEvent::none )
+    {
+	// no user input: continue the running search
+	if ( searchPopup )
+	    searchPopup->continueSearch();
+
+	return true;
+    }
+
+    // any other action stops the search, its matches so far stay in the list
+    if ( searchPopup && event.widget != searchField )
+	searchPopup->cancelSearch();
+
     // yuiMilestone() << "widget event: " << event << endl;
     // Call the appropriate handler
     if ( event == NCursesEvent::button )
@@ -480,6 +493,12 @@ bool NCPackageSelector::handleEvent ( const NCursesEvent&   event )
             {
                 retVal = searchPopup->showSearchResultPackages();
             }
+            else if ( event.reason == YEvent::ValueChanged )
+            {
+                // search as the user types
+                searchPopup->searchExpressionChanged();
+                retVal = true;
+            }
             else // no action, reason was YEvent::SelectionChanged
             {
                 retVal = true;
@@ -514,6 +533,18 @@ bool NCPackageSelector::handleEvent ( const NCursesEvent&   event )
 }
 
 
+///////////////////////////////////////////////////////////////////
+//
+// isBusy
+//
+// A search runs between the user input
+//
+bool NCPackageSelector::isBusy() const
+{
+    return searchPopup && searchPopup->searchRunning();
+}
+
+
 ///////////////////////////////////////////////////////////////////
 //
 // fillPatchSearchList
@@ -349,6 +349,12 @@ public:
      */
     bool handleEvent( const NCursesEvent& event );
 
+    /**
+     * Return true if there is work to do while there is no user input,
+     * i.e. a package search is running.
+     **/
+    bool isBusy() const;
+
     /**
      * Creates an NCPkgTable widget and shows all versions
      * of all packages belonging to a patch
@@ -156,7 +156,8 @@ NCPackageSelectorPluginImpl::runPkgSelection(  YDialog * dialog,
 	    yuiMilestone() << "NCDialog: " << ncd << endl;
 	    do
 	    {
-		event = ncd->userInput();
+		// don't wait for input while a search is running
+		event = ncd->userInput( ncSelector->isBusy() ? 0 : -1 );
 		result = ncSelector->handleEvent( event );
                 // reset to function keys of the main dialog
                 ncd->setStatusLine();
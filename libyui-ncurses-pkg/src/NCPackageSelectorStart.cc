@@ -163,4 +163,16 @@ bool NCPackageSelectorStart::handleEvent ( const NCursesEvent & event )
     return packager->handleEvent( event );
 }
 
+///////////////////////////////////////////////////////////////////
+//
+//      METHOD NAME : NCPackageSelectorStart::isBusy
+//      METHOD TYPE : bool
+//
+//      DESCRIPTION : asks the member variable PackageSelector packager
+//
+bool NCPackageSelectorStart::isBusy() const
+{
+    return packager && packager->isBusy();
+}
+
 
@@ -102,6 +102,13 @@ class NCPackageSelectorStart : public NCLayoutBox
      */
     bool handleEvent( const NCursesEvent&   event );
 
+    /**
+     * Return true if the package selector wants to continue some work
+     * when there is no user input. Events of type 'none' are passed to
+     * handleEvent() then.
+     **/
+    bool isBusy() const;
+
 };
 
 ///////////////////////////////////////////////////////////////////
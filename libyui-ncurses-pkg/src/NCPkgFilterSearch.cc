@@ -22,6 +22,7 @@
 
 #include <string>
 #include <sstream>
+#include <chrono>
 #include <boost/format.hpp>
 
 #define YUILogComponent "ncurses-pkg"
@@ -46,10 +47,81 @@
 
 using std::endl;
 
+// Run the search for that long before looking for user input again
+#define SEARCH_SLICE_MILLISEC	50
+
+// Check the time after that many solvables
+#define SEARCH_CLOCK_INTERVAL	32
+
+// Search as the user types from that many characters on
+#define MIN_AUTO_SEARCH_LENGTH	2
+
+typedef std::chrono::steady_clock Clock;
+
+// Changes whenever the content of the pool changes, e.g. after enabling
+// or refreshing a repository
+static unsigned poolSerial()
+{
+    return zypp::ResPool::instance().serial().serial();
+}
+
 /*
   Textdomain "ncurses-pkg"
 */
 
+///////////////////////////////////////////////////////////////////
+//
+//	CLASS NAME : NCPkgFilterSearch::SearchJob
+//
+//	DESCRIPTION : State of one search: its parameters and how far
+//		      the query has got
+//
+struct NCPkgFilterSearch::SearchJob
+{
+    SearchJob()
+	: mode( Contains )
+	, ignoreCase( true )
+	, checkName( false )
+	, checkSummary( false )
+	, checkKeywords( false )
+	, checkDescr( false )
+	, checkProvides( false )
+	, checkRequires( false )
+	, focusResults( false )
+	, started( false )
+	, refining( false )
+	, nextCandidate( 0 )
+	, poolSerial( 0 )
+	{}
+
+    std::string	expr;
+    int		mode;
+    bool	ignoreCase;
+    bool	checkName;
+    bool	checkSummary;
+    bool	checkKeywords;
+    bool	checkDescr;
+    bool	checkProvides;
+    bool	checkRequires;
+    bool	focusResults;
+
+    zypp::PoolQuery			query;
+    zypp::PoolQuery::const_iterator	it;
+    bool				started;	// query evaluated
+
+    // refining the last search: check its matches again
+    bool				refining;
+    std::vector<ZyppSel>		candidates;
+    size_t				nextCandidate;
+
+    std::set<ZyppSel>			found;
+    std::vector<ZyppSel>		matches;	// in the order found
+
+    // the pool the query and the matches refer to
+    unsigned				poolSerial;
+};
+
+
 ///////////////////////////////////////////////////////////////////
 //
 //
@@ -167,26 +239,81 @@ bool NCPkgFilterSearch::match( std::string s1, std::string s2, bool ignoreCase )
 bool NCPkgFilterSearch::fillSearchList( std::string & expr,
                                         bool ignoreCase )
 {
-    NCPkgTable * packageList = packager->PackageList();
-
-    if ( !packageList )
+    if ( !packager->PackageList() )
     {
 	return false;
     }
 
+    startSearch( expr, ignoreCase, true );
+
+    while ( continueSearch() )
+	;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::startSearch
+//	METHOD TYPE : void
+//
+//	DESCRIPTION : Set up the query and run the first time slice
+//
+void NCPkgFilterSearch::startSearch( bool focusResults )
+{
+    if ( packager->isYouMode() )
+	return;
+
+    startSearch( getSearchExpression(), getCheckBoxValue( ignoreCase ), focusResults );
+}
+
+void NCPkgFilterSearch::startSearch( const std::string & expr,
+				     bool ignoreCase,
+				     bool focusResults )
+{
+    NCPkgSearchSettings *settings = packager->SearchSettings();
+    std::unique_ptr<SearchJob> job( new SearchJob() );
+
+    job->expr		= expr;
+    job->mode		= searchMode->getCurrentItem();
+    job->ignoreCase	= ignoreCase;
+    job->checkName	= settings->doCheckName();
+    job->checkSummary	= settings->doCheckSummary();
+    job->checkKeywords	= settings->doCheckKeywords();
+    job->checkDescr	= settings->doCheckDescr();
+    job->checkProvides	= settings->doCheckProvides();
+    job->checkRequires	= settings->doCheckRequires();
+    job->focusResults	= focusResults;
+
+    startSearch( std::move( job ) );
+}
+
+void NCPkgFilterSearch::startSearch( std::unique_ptr<SearchJob> job )
+{
+    // no need to show the matches of a search that is replaced anyway
+    runningSearch.reset();
+
+    NCPkgTable * packageList = packager->PackageList();
+
+    if ( !packageList )
+	return;
+
     // clear the package table
     packageList->itemsCleared();
 
-    NCPkgSearchSettings *settings = packager->SearchSettings();
-    zypp::PoolQuery q;
+    job->poolSerial = poolSerial();
+
+    zypp::PoolQuery & q = job->query;
+    std::string queryString = job->expr;
 
-    switch ( searchMode->getCurrentItem() )
+    switch ( job->mode )
     {
 	case Contains:
 	    q.setMatchSubstring();
 	    break;
 	case BeginsWith:
-	    expr = '^' + expr;
+	    queryString = '^' + queryString;
 	    q.setMatchRegex();
 	    break;
 	case ExactMatch:
@@ -200,43 +327,150 @@ bool NCPkgFilterSearch::fillSearchList( std::string & expr,
 	    break;
     }
 
-    q.addString( expr );
+    q.addString( queryString );
     q.addKind( zypp::ResKind::package );
 
-    if ( !ignoreCase )
+    if ( !job->ignoreCase )
 	q.setCaseSensitive();
-    if ( settings->doCheckName() )
+    if ( job->checkName )
 	q.addAttribute( zypp::sat::SolvAttr::name );
-    if ( settings->doCheckSummary() )
+    if ( job->checkSummary )
 	q.addAttribute( zypp::sat::SolvAttr::summary );
-    if ( settings->doCheckKeywords() )
+    if ( job->checkKeywords )
 	q.addAttribute( zypp::sat::SolvAttr::keywords );
-    if ( settings->doCheckDescr() )
+    if ( job->checkDescr )
 	q.addAttribute( zypp::sat::SolvAttr::description );
-    if ( settings->doCheckProvides() )
+    if ( job->checkProvides )
         q.addAttribute( zypp::sat::SolvAttr::provides );
-    if ( settings->doCheckRequires() )
+    if ( job->checkRequires )
         // attribute SolvAttr::requires means "required by"
         q.addAttribute( zypp::sat::SolvAttr::requires );
 
-    NCPopupInfo * info = new NCPopupInfo( wpos( (NCurses::lines()-4)/2, (NCurses::cols()-18)/2 ),
-					  "",
-					  _( "Searching..." )
-					  );
-    info->setPreferredSize( 18, 4 );
-    info->popup();
+    // the matches of a search in an older pool are not all candidates
+    if ( lastSearch && lastSearch->poolSerial != job->poolSerial )
+    {
+	yuiDebug() << "Pool changed, forgetting the last search" << endl;
+	lastSearch.reset();
+    }
+
+    if ( lastSearch && refines( *job, *lastSearch ) )
+    {
+	yuiDebug() << "Refining the last search for \"" << lastSearch->expr << "\"" << endl;
+	job->refining   = true;
+	job->candidates = lastSearch->matches;
+    }
+
+    runningSearch = std::move( job );
+    continueSearch();
+}
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::continueSearch
+//	METHOD TYPE : bool
+//
+//	DESCRIPTION : Add the matches found within one time slice to the
+//		      package list
+//
+bool NCPkgFilterSearch::continueSearch()
+{
+    if ( !runningSearch )
+	return false;
+
+    NCPkgTable * packageList = packager->PackageList();
+
+    if ( !packageList )
+    {
+	runningSearch.reset();
+	return false;
+    }
+
+    if ( runningSearch->poolSerial != poolSerial() )
+    {
+	// the query iterator and the candidates belong to the old pool
+	yuiDebug() << "Pool changed, restarting the search for \"" << runningSearch->expr << "\"" << endl;
+	lastSearch.reset();
+
+	// the same search again, the widgets might show other settings by now
+	std::unique_ptr<SearchJob> job( new SearchJob() );
+
+	job->expr		= runningSearch->expr;
+	job->mode		= runningSearch->mode;
+	job->ignoreCase		= runningSearch->ignoreCase;
+	job->checkName		= runningSearch->checkName;
+	job->checkSummary	= runningSearch->checkSummary;
+	job->checkKeywords	= runningSearch->checkKeywords;
+	job->checkDescr		= runningSearch->checkDescr;
+	job->checkProvides	= runningSearch->checkProvides;
+	job->checkRequires	= runningSearch->checkRequires;
+	job->focusResults	= runningSearch->focusResults;
+
+	startSearch( std::move( job ) );
+
+	return searchRunning();
+    }
+
+    SearchJob & job = *runningSearch;
+    Clock::time_point sliceEnd = Clock::now() + std::chrono::milliseconds( SEARCH_SLICE_MILLISEC );
+    bool done = false;
+    int count = 0;
 
     try
     {
-	for ( zypp::PoolQuery::Selectable_iterator it = q.selectableBegin();
-	     it != q.selectableEnd(); it++)
+	if ( !job.started )
 	{
-	    ZyppPkg pkg = tryCastToZyppPkg( (*it)->theObj() );
-	    packageList->createListEntry ( pkg, *it);
+	    // evaluates the query, so this may throw for a bad regex
+	    job.it = job.query.begin();
+	    job.started = true;
+	}
+
+	while ( !done )
+	{
+	    ZyppSel selectable;
+
+	    if ( job.refining )
+	    {
+		if ( job.nextCandidate >= job.candidates.size() )
+		{
+		    done = true;
+		    break;
+		}
+
+		ZyppSel candidate = job.candidates[ job.nextCandidate++ ];
+
+		if ( candidateMatches( job, candidate ) )
+		    selectable = candidate;
+	    }
+	    else
+	    {
+		if ( job.it == job.query.end() )
+		{
+		    done = true;
+		    break;
+		}
+
+		selectable = zypp::ui::Selectable::get( *job.it );
+		++job.it;
+	    }
+
+	    // a selectable matches for each of its versions
+	    if ( selectable && job.found.insert( selectable ).second )
+	    {
+		job.matches.push_back( selectable );
+		ZyppPkg pkg = tryCastToZyppPkg( selectable->theObj() );
+		packageList->createListEntry( pkg, selectable );
+	    }
+
+	    // don't ask the clock for each solvable
+	    if ( ++count % SEARCH_CLOCK_INTERVAL == 0 && Clock::now() >= sliceEnd )
+		break;
 	}
     }
     catch (const std::exception & e)
     {
+	runningSearch.reset();
+
 	NCPopupInfo * info = new NCPopupInfo ( wpos( NCurses::lines()/10,
 						     NCurses::cols()/10),
 					       NCPkgStrings::ErrorLabel(),
@@ -248,30 +482,167 @@ bool NCPkgFilterSearch::fillSearchList( std::string & expr,
 	info->showInfoPopup();
 	YDialog::deleteTopmostDialog();
 	yuiError() << "Caught a std::exception: " << e.what() << endl;
+
+	packageList->drawList();
+	packager->clearInfoArea();
+
+	return false;
     }
 
-    info->popdown();
-    YDialog::deleteTopmostDialog();
+    showSearchProgress( done );
 
-    int found_pkgs = packageList->getNumLines();
+    if ( done )
+    {
+	yuiMilestone() << "Search for \"" << job.expr << "\": "
+		       << job.matches.size() << " packages found" << endl;
+	lastSearch = std::move( runningSearch );
+    }
+
+    return !done;
+}
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::cancelSearch
+//	METHOD TYPE : void
+//
+//	DESCRIPTION :
+//
+void NCPkgFilterSearch::cancelSearch()
+{
+    if ( !runningSearch )
+	return;
+
+    yuiDebug() << "Search for \"" << runningSearch->expr << "\" cancelled" << endl;
+
+    runningSearch->focusResults = false;
+    showSearchProgress( true );
+
+    // not complete, so it can't be refined
+    runningSearch.reset();
+}
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::searchExpressionChanged
+//	METHOD TYPE : void
+//
+//	DESCRIPTION : Search as you type
+//
+void NCPkgFilterSearch::searchExpressionChanged()
+{
+    if ( packager->isYouMode() )
+	return;
+
+    if ( getSearchExpression().size() < MIN_AUTO_SEARCH_LENGTH )
+	cancelSearch();
+    else
+	startSearch( false );
+}
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::showSearchProgress
+//	METHOD TYPE : void
+//
+//	DESCRIPTION :
+//
+void NCPkgFilterSearch::showSearchProgress( bool done )
+{
+    NCPkgTable * packageList = packager->PackageList();
+
+    if ( !runningSearch || !packageList )
+	return;
+
+    int found_pkgs = runningSearch->matches.size();
     std::ostringstream s;
-    s << boost::format( _( "%d packages found" )) % found_pkgs;
+
+    if ( done )
+	s << boost::format( _( "%d packages found" )) % found_pkgs;
+    else
+	// Label while the search is running, followed by the matches so far
+	s << boost::format( _( "Searching... %d packages found" )) % found_pkgs;
+
     packager->PatternLabel()->setText( s.str() );
 
     // show the package list
     packageList->drawList();
 
+    if ( !done )
+	return;
+
     if ( found_pkgs > 0 )
     {
 	packageList->scrollToFirstItem();
 	packageList->showInformation();
-	packageList->setKeyboardFocus();
+
+	if ( runningSearch->focusResults )
+	    packageList->setKeyboardFocus();
     }
     else
 	packager->clearInfoArea();
+}
 
-    return true;
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::refines
+//	METHOD TYPE : bool
+//
+//	DESCRIPTION :
+//
+bool NCPkgFilterSearch::refines( const SearchJob & job, const SearchJob & previous )
+{
+    // keywords, provides and requires are not checked by candidateMatches()
+    if ( job.checkKeywords || job.checkProvides || job.checkRequires )
+	return false;
+
+    if ( job.mode != Contains || previous.mode != Contains )
+	return false;
+
+    if ( job.ignoreCase	  != previous.ignoreCase   ||
+	 job.checkName	  != previous.checkName	   ||
+	 job.checkSummary != previous.checkSummary ||
+	 job.checkDescr	  != previous.checkDescr   ||
+	 previous.checkKeywords || previous.checkProvides || previous.checkRequires )
+	return false;
+
+    // whatever contains the new expression contains the old one, too
+    return match( job.expr, previous.expr, job.ignoreCase );
+}
 
+///////////////////////////////////////////////////////////////////
+//
+//
+//	METHOD NAME : NCPkgFilterSearch::candidateMatches
+//	METHOD TYPE : bool
+//
+//	DESCRIPTION :
+//
+bool NCPkgFilterSearch::candidateMatches( const SearchJob & job, ZyppSel selectable )
+{
+    // like the query, check the untranslated attributes of all versions
+    for ( zypp::ui::Selectable::picklist_iterator it = selectable->picklistBegin();
+	  it != selectable->picklistEnd(); ++it )
+    {
+	zypp::sat::Solvable solvable = it->satSolvable();
+
+	if ( job.checkName && match( solvable.name(), job.expr, job.ignoreCase ) )
+	    return true;
+
+	if ( job.checkSummary &&
+	     match( solvable.lookupStrAttribute( zypp::sat::SolvAttr::summary ), job.expr, job.ignoreCase ) )
+	    return true;
+
+	if ( job.checkDescr &&
+	     match( solvable.lookupStrAttribute( zypp::sat::SolvAttr::description ), job.expr, job.ignoreCase ) )
+	    return true;
+    }
+
+    return false;
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -284,12 +655,18 @@ bool NCPkgFilterSearch::fillSearchList( std::string & expr,
 //
 bool NCPkgFilterSearch::showSearchResultPackages()
 {
-    std::string filter =  getSearchExpression();
-
     if ( !packager->isYouMode() )
     {
-        // fill the package list with packages matching the search expression
-        fillSearchList( filter, getCheckBoxValue( ignoreCase ) );
+	if ( runningSearch && runningSearch->expr == getSearchExpression() )
+	{
+	    // started while typing, just move the focus when it is done
+	    runningSearch->focusResults = true;
+	}
+	else
+	{
+	    // fill the package list with packages matching the search expression
+	    startSearch( true );
+	}
     }
 
     return true;
@@ -28,6 +28,7 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <memory>
 
 #include <yui/ncurses/NCCheckBox.h>
 #include <yui/ncurses/NCComboBox.h>
@@ -38,6 +39,8 @@
 #include <yui/ncurses/NCPushButton.h>
 #include <yui/ncurses/NCRichText.h>
 
+#include "NCZypp.h"
+
 
 class NCPackageSelector;
 
@@ -69,8 +72,38 @@ private:
 
     NCPackageSelector * packager;		// connection to the package selector
 
+    // The running search and the last one that was completed
+    struct SearchJob;
+    std::unique_ptr<SearchJob> runningSearch;
+    std::unique_ptr<SearchJob> lastSearch;
+
     bool getCheckBoxValue( NCCheckBox * checkBox );
 
+    /**
+     * Return true if 'job' can take the matches of 'previous' as candidates
+     * instead of querying the whole pool again: 'job' searches the same
+     * attributes for a substring that contains the one of 'previous'.
+     **/
+    bool refines( const SearchJob & job, const SearchJob & previous );
+
+    /**
+     * Return true if one of the attributes of 'job' of any version of
+     * 'selectable' contains the search expression.
+     **/
+    bool candidateMatches( const SearchJob & job, ZyppSel selectable );
+
+    /**
+     * Show the matches of the running search found so far.
+     **/
+    void showSearchProgress( bool done );
+
+    void startSearch( const std::string & expr, bool ignoreCase, bool focusResults );
+
+    /**
+     * Start the search with the parameters of 'job', which has not run yet.
+     **/
+    void startSearch( std::unique_ptr<SearchJob> job );
+
 protected:
 
     std::string getSearchExpression() const;
@@ -88,6 +121,43 @@ public:
 
     bool fillSearchList( std::string & expr, bool ignoreCase );
 
+    /**
+     * Start searching for the current search expression. A search that is
+     * still running is cancelled.
+     *
+     * The query does not block the user input: continueSearch() runs it
+     * for a short time whenever there is no input, and the matches are added
+     * to the package list in batches. If the expression only adds to the
+     * one of the last search, just the matches of that search are checked
+     * again.
+     *
+     * 'focusResults': Move the keyboard focus to the package list when the
+     * search is done.
+     **/
+    void startSearch( bool focusResults );
+
+    /**
+     * Continue the running search for a time slice.
+     * Returns true if there is more to do.
+     **/
+    bool continueSearch();
+
+    /**
+     * Stop the running search. The matches found so far stay in the list.
+     **/
+    void cancelSearch();
+
+    /**
+     * Return true if a search is running.
+     **/
+    bool searchRunning() const { return runningSearch.get() != 0; }
+
+    /**
+     * Notification that the search expression was changed: Search as the
+     * user types.
+     **/
+    void searchExpressionChanged();
+
     NCInputField * getSearchField() { return searchExpr; }
 
 };
@@ -138,12 +138,22 @@ void NCPkgTable::addLine( ZyppStatus stat,
 
     // use all-at-once insertion mode - DrawPad() is called only after the loop
     addItem( tabItem, true );
+
+    if ( slbPtr )
+	selItems[ slbPtr.get() ].push_back( tabItem );
 }
 
 
 void NCPkgTable::itemsCleared()
 {
-    return NCTable::deleteAllItems();
+    return deleteAllItems();
+}
+
+
+void NCPkgTable::deleteAllItems()
+{
+    selItems.clear();
+    NCTable::deleteAllItems();
 }
 
 
@@ -295,8 +305,12 @@ bool NCPkgTable::changeStatus( ZyppStatus newstatus,
 		break;
 	}
 
-        // update this list to show the status changes
-	updateTable();
+        // update this list to show the status changes - if the solver
+        // didn't run, only the status of this selectable has changed
+	if ( packager->AutoCheck() || tableType == T_Selections )
+	    updateTable();
+	else
+	    updateTable( { slbPtr } );
 
 	if ( tableType == T_Availables || tableType == T_MultiVersion )
 	{
@@ -314,65 +328,91 @@ bool NCPkgTable::changeStatus( ZyppStatus newstatus,
 //
 bool NCPkgTable::updateTable()
 {
-    unsigned int size = getNumLines();
-    unsigned int index = 0;
+    vector<const YTableCell *> changedCells;
     bool ret = true;
 
-    while ( index < size )
+    // no need to go through the table lines, the tags know the status shown
+    for ( YItemConstIterator it = itemsBegin(); it != itemsEnd(); ++it )
     {
-    	// get the table line
-	NCTableLine * cl = myPad()->ModifyLine( index );
-
-	if ( !cl )
-	{
+	if ( !updateItemStatus( static_cast<YTableItem *>( *it ), changedCells ) )
 	    ret = false;
-	    break;
-	}
+    }
 
-        // get first column (the column containing the status info)
-        YTableItem *it = dynamic_cast<YTableItem*> (cl->origItem() );
-        YTableCell *tcell = it->cell(0);
-	NCPkgTableTag * cc = static_cast<NCPkgTableTag*>( tcell );
-	// get the object pointer
-	ZyppSel slbPtr = getSelPointer( index );
-	ZyppObj objPtr = getDataPointer( index );
+    // redraw only the lines with a new status
+    cellsChanged( changedCells );
+
+    return ret;
+}
+
+
+bool NCPkgTable::updateTable( const std::set<ZyppSel> & changed )
+{
+    vector<const YTableCell *> changedCells;
+    bool ret = true;
+
+    for ( const ZyppSel & slbPtr: changed )
+    {
+	SelItemMap::const_iterator found = selItems.find( slbPtr.get() );
+
+	if ( found == selItems.end() )
+	    continue;	// not in this list
 
-	if ( !cc )
+	for ( YTableItem * item: found->second )
 	{
-	    ret = false;
-	    break;
+	    if ( !updateItemStatus( item, changedCells ) )
+		ret = false;
 	}
+    }
 
-	ZyppStatus newstatus = S_NoInst;
-	if ( slbPtr && objPtr)
-	{
-	    if ( tableType == T_Availables && !slbPtr->multiversionInstall() )
-	    {
-		string isCandidate = "   ";
-		if ( objPtr == slbPtr->candidateObj() )
-		    isCandidate = " x ";
+    cellsChanged( changedCells );
 
-		cl->AddCol( 2, new NCTableCol( isCandidate ) );
-	    }
-	    else
-	    {
-		// get the new status and replace old status
-		newstatus = statusStrategy->getPackageStatus( slbPtr, objPtr );
+    return ret;
+}
 
-		// set new status (if status has changed)
-		if ( getStatus(index) != newstatus )
-		{
-		    cc->setStatus( newstatus );
-                    setCell( index, 0, cc->statusToString (newstatus) );
-		}
-	    }
+
+bool NCPkgTable::updateItemStatus( YTableItem * item, vector<const YTableCell *> & changedCells )
+{
+    if ( !item || !item->hasCell( 0 ) )
+	return false;
+
+    // get first column (the column containing the status info)
+    NCPkgTableTag * cc = static_cast<NCPkgTableTag *>( item->cell( 0 ) );
+    // get the object pointer
+    ZyppSel slbPtr = cc->getSelPointer();
+    ZyppObj objPtr = cc->getDataPointer();
+
+    if ( !slbPtr || !objPtr )
+	return true;
+
+    if ( tableType == T_Availables && !slbPtr->multiversionInstall() )
+    {
+	string isCandidate = "   ";
+	if ( objPtr == slbPtr->candidateObj() )
+	    isCandidate = " x ";
+
+	YTableCell * candCell = item->cell( 2 );
+
+	if ( candCell && candCell->label() != isCandidate )
+	{
+	    candCell->setLabel( isCandidate );
+	    changedCells.push_back( candCell );
 	}
-	index++;
     }
+    else
+    {
+	// get the new status and replace old status
+	ZyppStatus newstatus = statusStrategy->getPackageStatus( slbPtr, objPtr );
 
-    DrawPad();
+	// set new status (if status has changed)
+	if ( cc->getStatus() != newstatus )
+	{
+	    cc->setStatus( newstatus );
+	    cc->setLabel( cc->statusToString( newstatus ) );
+	    changedCells.push_back( cc );
+	}
+    }
 
-    return ret;
+    return true;
 }
 
 
@@ -27,6 +27,8 @@
 #include <iosfwd>
 #include <string>
 #include <map>
+#include <set>
+#include <unordered_map>
 #include <utility>      // for STL std::pair
 
 #include <zypp/ui/Selectable.h>
@@ -275,6 +277,17 @@ private:
 
     std::vector<std::string> header;		// the table header
 
+    // the table items of each selectable (more than one for T_Availables)
+    typedef std::unordered_map<const zypp::ui::Selectable *, std::vector<YTableItem *> > SelItemMap;
+    SelItemMap selItems;
+
+    /**
+     * Compare the status shown for 'item' with the current one and add the
+     * cells that have to show a new status to 'changedCells'.
+     * Return 'false' if 'item' has no status cell.
+     */
+    bool updateItemStatus( YTableItem * item, std::vector<const YTableCell *> & changedCells );
+
 
 public:
 
@@ -309,6 +322,11 @@ public:
      */
     virtual void itemsCleared();
 
+    /**
+     * Deletes all items (reimplemented from NCTable)
+     */
+    virtual void deleteAllItems();
+
     /**
      * Returns the contents of a certain cell in table
      * @param index The table line
@@ -354,10 +372,19 @@ public:
 
     /**
      * Set the status information if status has changed
-     * @return bool
+     * @return bool false if a line has no status cell
      */
     bool updateTable();
 
+    /**
+     * Set the status information of the lines of the given selectables
+     * if their status has changed. Only use this if no other status
+     * can have changed, i.e. the solver did not run.
+     * @param changed The selectables to check
+     * @return bool false if a line of them has no status cell
+     */
+    bool updateTable( const std::set<ZyppSel> & changed );
+
     /**
      * Gets the currently displayed package status.
      * @param index The index in package table (the line)
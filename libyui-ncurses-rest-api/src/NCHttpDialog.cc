@@ -191,6 +191,10 @@ wint_t NCHttpDialog::getch( int timeout_millisec )
 	    got = getinput();
     }
 
+    // the user input might change the widgets, invalidate the REST API caches
+    if ( got != WEOF )
+	YWidget::markChanged();
+
     if ( got == KEY_RESIZE )
     {
 	NCurses::ResizeEvent();
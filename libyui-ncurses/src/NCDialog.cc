@@ -29,6 +29,7 @@ textdomain "ncurses"
 #include <yui/YUILog.h>
 #include "NCDialog.h"
 #include "NCstring.h"
+#include "NCHeadless.h"
 #include "NCPopupInfo.h"
 #include "NCMenuButton.h"
 #include <yui/YShortcut.h>
@@ -36,6 +37,7 @@ textdomain "ncurses"
 #include "YNCursesUI.h"
 #include <yui/YDialogSpy.h>
 #include <yui/YDialog.h>
+#include <yui/YStartupProfiler.h>
 
 #include "ncursesw.h"
 
@@ -50,7 +52,7 @@ NCDialog::NCDialog( YDialogType		dialogType,
 		    YDialogColorMode	colorMode )
     : YDialog( dialogType, colorMode )
     , pan( 0 )
-    , dlgstyle( 0 )
+    , mystyleset( NCstyle::DefaultStyle )
     , inMultiDraw_i( 0 )
     , active( false )
     , wActive( this )
@@ -65,7 +67,7 @@ NCDialog::NCDialog( YDialogType		dialogType,
 NCDialog::NCDialog( YDialogType dialogType, const wpos & at, bool boxed )
 	: YDialog( dialogType, YDialogNormalColor )
 	, pan( 0 )
-	, dlgstyle( 0 )
+	, mystyleset( NCstyle::DefaultStyle )
 	, inMultiDraw_i( 0 )
 	, active( false )
 	, wActive( this )
@@ -102,8 +104,6 @@ void NCDialog::_init()
 	mystyleset = NCstyle::DefaultStyle;
     }
 
-    dlgstyle = &NCurses::style()[mystyleset];
-
     eventReason = YEvent::UnknownReason;
     // yuiDebug() << "+++ " << this << std::endl;
 }
@@ -247,6 +247,7 @@ void NCDialog::showDialog()
 	getVisible();
 
 	doUpdate();
+	YStartupProfiler::dialogPainted();
 	DumpOn( yuiDebug(), " " );
 
     }
@@ -489,11 +490,6 @@ void NCDialog::wRecoded()
 {
     if ( pan )
     {
-	if ( &NCurses::style()[mystyleset] != dlgstyle )
-	{
-	    dlgstyle = &NCurses::style()[mystyleset];
-	}
-
 	pan->bkgdset( wStyle(). getDumb().text );
 
 	pan->clear();
@@ -742,7 +738,12 @@ wint_t NCDialog::getinput()
 {
     wint_t got = WEOF;
 
-    if ( NCstring::terminalEncoding() == "UTF-8" )
+    if ( NCHeadless::instance() )
+    {
+	// No terminal to read from: Take the next key of the script
+	got = NCHeadless::instance()->popKey();
+    }
+    else if ( NCstring::terminalEncoding() == "UTF-8" )
     {
 	wint_t gotwch = WEOF;
 	int ret = ::get_wch( &gotwch ); // get a wide character
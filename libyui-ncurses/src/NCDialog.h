@@ -64,7 +64,6 @@ private:
 
     NCursesUserPanel<NCDialog> * pan;
     NCstyle::StyleSet		 mystyleset;
-    const NCstyle::Style *	 dlgstyle;
 
     unsigned inMultiDraw_i;
 
@@ -209,7 +208,8 @@ protected:
 
     virtual const NCstyle::Style & wStyle() const
     {
-	return dlgstyle ? *dlgstyle : NCurses::style()[NCstyle::DefaultStyle];
+	// Always look up the style set: Switching themes exchanges them.
+	return NCurses::style()[mystyleset];
     }
 
     virtual void setEnabled( bool do_bv ) {}
@@ -0,0 +1,397 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#include <unistd.h>
+#include <string.h>	// memcmp(), strerror()
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+
+#define  YUILogComponent "ncurses"
+#include <yui/YUILog.h>
+#include "NCHeadless.h"
+#include "NCurses.h"
+#include "NCstring.h"
+
+#include "stdutil.h"
+
+using stdutil::form;
+
+
+NCHeadless * NCHeadless::_instance = 0;
+
+
+NCHeadless::RedrawTimer::RedrawTimer()
+    : _active( NCHeadless::instance() != 0 )
+{
+    if ( _active )
+	_start = std::chrono::steady_clock::now();
+}
+
+
+NCHeadless::RedrawTimer::~RedrawTimer()
+{
+    if ( _active && NCHeadless::instance() )
+    {
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _start;
+	NCHeadless::instance()->addRedrawTime( elapsed.count() );
+    }
+}
+
+
+
+NCHeadless::NCHeadless( int cols, int lines )
+    : _cols( cols )
+    , _lines( lines )
+    , _in( 0 )
+    , _out( 0 )
+    , _statsFile( 0 )
+    , _redrawTime( 0.0 )
+{
+}
+
+
+NCHeadless::~NCHeadless()
+{
+    if ( _in )
+	fclose( _in );
+
+    if ( _out )
+	fclose( _out );
+
+    if ( _statsFile )
+	fclose( _statsFile );
+}
+
+
+NCHeadless * NCHeadless::create()
+{
+    if ( _instance )
+	return _instance;
+
+    const char * value = getenv( "Y2NCURSES_HEADLESS" );
+
+    if ( !value || !*value )
+	return 0;
+
+    int cols  = 80;
+    int lines = 25;
+
+    if ( sscanf( value, "%dx%d", &cols, &lines ) != 2 || cols < 1 || lines < 3 )
+    {
+	cols  = 80;
+	lines = 25;
+    }
+
+    _instance = new NCHeadless( cols, lines );
+
+    yuiMilestone() << "Headless terminal " << cols << "x" << lines << std::endl;
+
+    const char * keyScript = getenv( "Y2NCURSES_HEADLESS_KEYS" );
+
+    if ( keyScript && *keyScript )
+	_instance->loadKeyScript( keyScript );
+
+    const char * statsFile = getenv( "Y2NCURSES_HEADLESS_STATS" );
+
+    if ( statsFile && *statsFile )
+    {
+	_instance->_statsFile = fopen( statsFile, "w" );
+
+	if ( _instance->_statsFile )
+	    fprintf( _instance->_statsFile, "frame,cells_changed,bytes,redraw_usec\n" );
+	else
+	    yuiError() << statsFile << ": (" << errno << ") " << strerror( errno ) << std::endl;
+    }
+
+    return _instance;
+}
+
+
+void NCHeadless::destroy()
+{
+    if ( !_instance )
+	return;
+
+    const FrameStats & tot = _instance->_totals;
+
+    yuiMilestone() << form( "Headless: %lu frames, %lu cells changed, %lu bytes, %.3f ms in DoRedraw",
+			    tot.frame, tot.cellsChanged, tot.bytes, tot.redrawTime * 1000.0 )
+		   << std::endl;
+
+    delete _instance;
+    _instance = 0;
+}
+
+
+SCREEN * NCHeadless::newTerm( const std::string & term )
+{
+    _in	 = fopen( "/dev/null", "r" );
+    _out = tmpfile();
+
+    if ( !_in || !_out )
+    {
+	yuiError() << "Headless: (" << errno << ") " << strerror( errno ) << std::endl;
+	return 0;
+    }
+
+    // ncurses takes the screen size from the environment if the output is
+    // not a terminal.
+
+    setenv( "COLUMNS", form( "%d", _cols ).c_str(), 1 );
+    setenv( "LINES",   form( "%d", _lines ).c_str(), 1 );
+
+    SCREEN * screen = 0;
+
+    if ( !term.empty() )
+	screen = ::newterm( term.c_str(), _out, _in );
+
+    if ( !screen )
+    {
+	yuiWarning() << "Headless: newterm( " << term << " ) failed, using xterm" << std::endl;
+	setenv( "TERM", "xterm", 1 );
+	screen = ::newterm( "xterm", _out, _in );
+    }
+
+    unsetenv( "COLUMNS" );
+    unsetenv( "LINES" );
+
+    return screen;
+}
+
+
+void NCHeadless::pushKey( wint_t key )
+{
+    _keys.push_back( key );
+}
+
+
+void NCHeadless::pushText( const std::wstring & text )
+{
+    for ( wchar_t ch : text )
+    {
+	wint_t key = ch;
+
+	// Mark characters that collide with curses KEY_ codes just like
+	// NCDialog::getinput() does for UTF-8 terminals
+
+	if ( key > KEY_MIN )
+	    key += 0xFFFF;
+
+	pushKey( key );
+    }
+}
+
+
+bool NCHeadless::loadKeyScript( const std::string & fileName )
+{
+    std::ifstream script( fileName.c_str() );
+
+    if ( !script )
+    {
+	yuiError() << "Headless: can't read key script " << fileName << std::endl;
+	return false;
+    }
+
+    std::string line;
+    unsigned lineNo = 0;
+
+    while ( std::getline( script, line ) )
+    {
+	++lineNo;
+
+	if ( line.empty() || line[0] == '#' )
+	    continue;
+
+	if ( line[0] == '"' )
+	{
+	    std::wstring text;
+	    NCstring::RecodeToWchar( line.substr( 1 ), "UTF-8", &text );
+	    pushText( text );
+	    continue;
+	}
+
+	wint_t key = keyCode( line );
+
+	if ( key == WEOF )
+	    yuiWarning() << fileName << ":" << lineNo << ": unknown key " << line << std::endl;
+	else
+	    pushKey( key );
+    }
+
+    yuiMilestone() << "Headless: " << _keys.size() << " keys queued from " << fileName << std::endl;
+
+    return true;
+}
+
+
+wint_t NCHeadless::keyCode( const std::string & name )
+{
+    static const std::map<std::string, wint_t> keys =
+    {
+	{ "Up",		KEY_UP		},
+	{ "Down",	KEY_DOWN	},
+	{ "Left",	KEY_LEFT	},
+	{ "Right",	KEY_RIGHT	},
+	{ "Home",	KEY_HOME	},
+	{ "End",	KEY_END		},
+	{ "PgUp",	KEY_PPAGE	},
+	{ "PageUp",	KEY_PPAGE	},
+	{ "PgDn",	KEY_NPAGE	},
+	{ "PageDown",	KEY_NPAGE	},
+	{ "Insert",	KEY_IC		},
+	{ "Delete",	KEY_DC		},
+	{ "Backspace",	KEY_BACKSPACE	},
+	{ "Return",	KEY_RETURN	},
+	{ "Enter",	KEY_RETURN	},
+	{ "Tab",	KEY_TAB		},
+	{ "BackTab",	KEY_BTAB	},
+	{ "Escape",	KEY_ESC		},
+	{ "Esc",	KEY_ESC		},
+	{ "Space",	' '		}
+    };
+
+    auto it = keys.find( name );
+
+    if ( it != keys.end() )
+	return it->second;
+
+    if ( name.size() > 1 && name[0] == 'F' )
+    {
+	int fkey = atoi( name.c_str() + 1 );
+
+	if ( fkey >= 1 && fkey <= 24 )
+	    return KEY_F( fkey );
+    }
+
+    if ( name.size() == 3 && name.compare( 0, 2, "C-" ) == 0 )
+	return CTRL( name[2] );
+
+    if ( name.size() == 1 )
+	return (unsigned char) name[0];
+
+    return WEOF;
+}
+
+
+wint_t NCHeadless::popKey()
+{
+    if ( _keys.empty() )
+	return WEOF;
+
+    wint_t key = _keys.front();
+    _keys.pop_front();
+
+    return key;
+}
+
+
+unsigned long NCHeadless::takeOutputBytes()
+{
+    if ( !_out )
+	return 0;
+
+    // ncurses writes to the file descriptor directly, bypassing the stdio
+    // buffer, so the file position is the number of bytes emitted.
+
+    fflush( _out );
+    int fd = fileno( _out );
+    off_t bytes = lseek( fd, 0, SEEK_CUR );
+
+    if ( bytes > 0 )
+    {
+	if ( ftruncate( fd, 0 ) != 0 )
+	    yuiError() << "Headless: (" << errno << ") " << strerror( errno ) << std::endl;
+
+	lseek( fd, 0, SEEK_SET );
+	rewind( _out );
+    }
+
+    return bytes > 0 ? bytes : 0;
+}
+
+
+unsigned long NCHeadless::takeScreenChanges()
+{
+    int lines = getmaxy( ::curscr );
+    int cols  = getmaxx( ::curscr );
+
+    if ( lines <= 0 || cols <= 0 )
+	return 0;
+
+    size_t cells = (size_t) lines * cols;
+
+    if ( _screen.size() != cells )
+    {
+	// First frame or resized: Compare against a blank screen
+
+	cchar_t blank;
+	memset( &blank, 0, sizeof( blank ) );
+	setcchar( &blank, L" ", A_NORMAL, 0, 0 );
+	_screen.assign( cells, blank );
+    }
+
+    unsigned long changed = 0;
+    cchar_t cell;
+
+    for ( int l = 0; l < lines; ++l )
+    {
+	for ( int c = 0; c < cols; ++c )
+	{
+	    memset( &cell, 0, sizeof( cell ) );
+	    ::mvwin_wch( ::curscr, l, c, &cell );
+
+	    cchar_t & old = _screen[ (size_t) l * cols + c ];
+
+	    if ( memcmp( &old, &cell, sizeof( cell ) ) != 0 )
+	    {
+		old = cell;
+		++changed;
+	    }
+	}
+    }
+
+    return changed;
+}
+
+
+void NCHeadless::endFrame()
+{
+    FrameStats frame;
+
+    frame.frame		= ++_totals.frame;
+    frame.cellsChanged	= takeScreenChanges();
+    frame.bytes		= takeOutputBytes();
+    frame.redrawTime	= _redrawTime;
+    _redrawTime		= 0.0;
+
+    _totals.cellsChanged += frame.cellsChanged;
+    _totals.bytes	 += frame.bytes;
+    _totals.redrawTime	 += frame.redrawTime;
+    _lastFrame = frame;
+
+    yuiDebug() << form( "Frame %lu: %lu cells changed, %lu bytes, %.3f ms in DoRedraw",
+			frame.frame, frame.cellsChanged, frame.bytes, frame.redrawTime * 1000.0 )
+	       << std::endl;
+
+    if ( _statsFile )
+    {
+	fprintf( _statsFile, "%lu,%lu,%lu,%.0f\n",
+		 frame.frame, frame.cellsChanged, frame.bytes, frame.redrawTime * 1e6 );
+	fflush( _statsFile );
+    }
+}
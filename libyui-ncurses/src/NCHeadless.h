@@ -0,0 +1,219 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#ifndef NCHeadless_h
+#define NCHeadless_h
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <ncursesw/curses.h>
+#include <wchar.h>
+
+
+/**
+ * Headless terminal for running the NCurses UI without a tty, e.g. for
+ * automated performance tests in CI.
+ *
+ * This is enabled with the environment variable
+ *
+ *     Y2NCURSES_HEADLESS=<cols>x<lines>
+ *
+ * (e.g. "Y2NCURSES_HEADLESS=120x40"; any other non-empty value uses 80x25).
+ * ncurses then renders to an in-memory virtual screen: Its output goes to
+ * an anonymous temporary file that is only used to count the bytes that
+ * would have been sent to a real terminal, and input is taken from a key
+ * queue instead of the terminal. When the queue is exhausted, the dialog
+ * gets WEOF, i.e. a cancel event if it waits for input without timeout.
+ *
+ * Keys are queued with pushKey() or read from the key script named by
+ * Y2NCURSES_HEADLESS_KEYS (see loadKeyScript()).
+ *
+ * Each NCurses::Update() ends a frame. For each frame, the number of screen
+ * cells that changed, the number of bytes emitted and the time spent in
+ * DoRedraw() of the table and tree pads is logged at debug level and, if
+ * Y2NCURSES_HEADLESS_STATS names a file, appended to that file as one line
+ * of comma-separated values. The totals are logged on shutdown.
+ **/
+class NCHeadless
+{
+public:
+
+    /**
+     * Statistics of one frame or the sum of all frames.
+     **/
+    struct FrameStats
+    {
+	FrameStats()
+	    : frame( 0 )
+	    , cellsChanged( 0 )
+	    , bytes( 0 )
+	    , redrawTime( 0.0 )
+	    {}
+
+	unsigned long frame;		///< frame number or number of frames
+	unsigned long cellsChanged;	///< changed cells of the virtual screen
+	unsigned long bytes;		///< bytes emitted to the terminal
+	double	      redrawTime;	///< seconds spent in DoRedraw()
+    };
+
+    /**
+     * Measure the time from construction to destruction and add it to the
+     * redraw time of the current frame. Does nothing if not headless.
+     **/
+    class RedrawTimer
+    {
+    public:
+	RedrawTimer();
+	~RedrawTimer();
+
+    private:
+	bool _active;
+	std::chrono::steady_clock::time_point _start;
+    };
+
+    /**
+     * Return the headless terminal or 0 if the UI runs on a real terminal.
+     **/
+    static NCHeadless * instance() { return _instance; }
+
+    /**
+     * Create the headless terminal if Y2NCURSES_HEADLESS is set. Return the
+     * new instance or 0 if not headless.
+     **/
+    static NCHeadless * create();
+
+    /**
+     * Write the total statistics to the log and delete the instance. This
+     * must be called after the screen is deleted.
+     **/
+    static void destroy();
+
+    /**
+     * Create the ncurses screen for terminal type 'term', falling back to
+     * "xterm" if 'term' is not known. Return 0 on error.
+     **/
+    SCREEN * newTerm( const std::string & term );
+
+    /**
+     * Return the size of the virtual screen.
+     **/
+    int cols()	const { return _cols; }
+    int lines()	const { return _lines; }
+
+    /**
+     * Append a key to the input queue. 'key' is a character or a curses
+     * KEY_* code as returned by NCDialog::getinput().
+     **/
+    void pushKey( wint_t key );
+
+    /**
+     * Append the characters of 'text' to the input queue.
+     **/
+    void pushText( const std::wstring & text );
+
+    /**
+     * Append the keys of a key script to the input queue. Each line of the
+     * script is either a key name (see keyCode()), or a '"' followed by
+     * text to type. Empty lines and lines starting with '#' are ignored.
+     * Return false if the file could not be read.
+     **/
+    bool loadKeyScript( const std::string & fileName );
+
+    /**
+     * Return the key code for key name 'name', e.g. "Down", "Return",
+     * "F10", "PgDn", "C-x" (Ctrl-X), or a single character. Return WEOF for
+     * unknown names.
+     **/
+    static wint_t keyCode( const std::string & name );
+
+    /**
+     * Remove and return the next key of the input queue or WEOF if it is
+     * empty.
+     **/
+    wint_t popKey();
+
+    /**
+     * Return the number of keys left in the input queue.
+     **/
+    size_t pendingKeys() const { return _keys.size(); }
+
+    /**
+     * Finish the current frame: Compare the virtual screen with the last
+     * frame and collect the statistics. Called after each screen update.
+     **/
+    void endFrame();
+
+    /**
+     * Add 'seconds' to the redraw time of the current frame.
+     **/
+    void addRedrawTime( double seconds ) { _redrawTime += seconds; }
+
+    /**
+     * Return the statistics of the last frame.
+     **/
+    const FrameStats & lastFrame() const { return _lastFrame; }
+
+    /**
+     * Return the sum of the statistics of all frames.
+     **/
+    const FrameStats & totals() const { return _totals; }
+
+private:
+
+    NCHeadless( int cols, int lines );
+    ~NCHeadless();
+
+    // Disable unwanted assignment operator and copy constructor
+
+    NCHeadless & operator=( const NCHeadless & );
+    NCHeadless( const NCHeadless & );
+
+    /**
+     * Return and reset the number of bytes written to the output file.
+     **/
+    unsigned long takeOutputBytes();
+
+    /**
+     * Update the snapshot of the virtual screen and return the number of
+     * cells that changed.
+     **/
+    unsigned long takeScreenChanges();
+
+
+    //
+    // Data members
+    //
+
+    static NCHeadless * _instance;
+
+    int			_cols;
+    int			_lines;
+    FILE *		_in;
+    FILE *		_out;
+    FILE *		_statsFile;
+    std::deque<wint_t>	_keys;
+    std::vector<cchar_t> _screen;
+    double		_redrawTime;
+    FrameStats		_lastFrame;
+    FrameStats		_totals;
+};
+
+
+#endif // NCHeadless_h
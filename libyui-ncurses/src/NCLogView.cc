@@ -123,38 +123,34 @@ NCPad * NCLogView::CreatePad()
     wsze psze( defPadSze() );
     NCPad * npad = new NCPad( psze.H, psze.W, *this );
     npad->bkgd( listStyle().item.plain );
+    npad->setLineProvider( [this]( NCursesWindow & w, const wrect at, unsigned lineNo )
+                           {
+                               drawLine( w, at, lineNo );
+                           } );
     return npad;
 }
 
 
 void NCLogView::DrawPad()
 {
-    // maximal value for lines is 32000!
-    unsigned maxLines = 20000;
-    unsigned skipLines = 0;
-    unsigned lines = text.Lines();
-    unsigned cl = 0;
+    // The pad pages if there are too many lines, so there is no need to
+    // limit the number of lines here.
+    textLines.clear();
+    textLines.reserve( text.Lines() );
 
-    if ( lines > maxLines )
-    {
-	skipLines = lines - maxLines;
-	lines = maxLines;
-    }
+    for ( NCtext::const_iterator line = text.begin(); line != text.end(); ++line )
+	textLines.push_back( &( *line ) );
+
+    AdjustPad( wsze( textLines.size(), Columns() ) );
+    myPad()->drawLines();
+}
 
-    AdjustPad( wsze( lines, Columns() ) );
 
-    for ( NCtext::const_iterator line = text.begin(); line != text.end(); ++line )
+void NCLogView::drawLine( NCursesWindow & w, const wrect at, unsigned lineNo )
+{
+    if ( lineNo < textLines.size() )
     {
-	if ( skipLines == 0 )
-	{
-	    myPad()->move( cl++, 0 );
-	    std::wstring cline = ( *line ).str();
-	    myPad()->addwstr( cline.c_str() );
-	}
-	else
-	{
-	    skipLines--;
-	}
+	w.move( at.Pos.L, at.Pos.C );
+	w.addwstr( textLines[ lineNo ]->str().c_str() );
     }
 }
-
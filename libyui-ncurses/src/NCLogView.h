@@ -26,6 +26,7 @@
 #define NCLogView_h
 
 #include <iosfwd>
+#include <vector>
 
 #include <yui/YLogView.h>
 #include "NCPadWidget.h"
@@ -43,6 +44,12 @@ private:
 
     NCtext text;
 
+    /// Random access to the lines of *text* for drawLine()
+    std::vector<const NCstring *> textLines;
+
+    /// Line provider for the pad
+    void drawLine( NCursesWindow & w, const wrect at, unsigned lineNo );
+
 protected:
 
     virtual const char * location() const { return "NCLogView"; }
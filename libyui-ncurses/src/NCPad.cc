@@ -36,10 +36,20 @@
 //#define MAX_PAD_HEIGHT 100
 #define MAX_PAD_HEIGHT NCursesWindow::maxcoord()
 
+// Maximum height of a pageable NCursesPad. Anything larger is kept in
+// the pages of an NCPadPageCache.
+#define MAX_PAGEABLE_PAD_HEIGHT PAD_PAGESIZE
+
+// Height of a single page of the NCPadPageCache and number of pages in
+// its pool: 512 lines are kept in memory no matter how high the pad is.
+#define CACHE_PAGE_HEIGHT 64
+#define CACHE_POOL_SIZE   8
+
 
 NCPad::NCPad( int lines, int cols, const NCWidget & p )
   : NCursesPad( lines > MAX_PAD_HEIGHT ? PAD_PAGESIZE : lines, cols )
   , _vheight( lines > MAX_PAD_HEIGHT ? lines : 0 )
+  , _pageCache( 0 )
   , parw( p )
   , destwin ( 0 )
   , maxdpos ( 0 )
@@ -49,6 +59,12 @@ NCPad::NCPad( int lines, int cols, const NCWidget & p )
 {}
 
 
+NCPad::~NCPad()
+{
+    delete _pageCache;
+}
+
+
 void NCPad::Destwin( NCursesWindow * dwin )
 {
     if ( dwin != destwin )
@@ -88,16 +104,23 @@ void NCPad::resize( wsze nsze )
 	if ( odest )
 	    Destwin( 0 );
 
-        if ( nsze.H > MAX_PAD_HEIGHT )
+        int maxPadHeight = pageable() ? MAX_PAGEABLE_PAD_HEIGHT : MAX_PAD_HEIGHT;
+
+        if ( nsze.H > maxPadHeight )
         {
-	    // yuiDebug() << "TRUNCATE PAD: " << nsze.H << " > " << MAX_PAD_HEIGHT << std::endl;
+	    // yuiDebug() << "TRUNCATE PAD: " << nsze.H << " > " << maxPadHeight << std::endl;
 	    NCursesPad::resize( PAD_PAGESIZE, nsze.W );
 	    _vheight = nsze.H;
+
+	    pageCache()->resize( nsze.H, nsze.W );
         }
         else
         {
 	    NCursesPad::resize( nsze.H, nsze.W );
 	    _vheight = 0;
+
+	    delete _pageCache;
+	    _pageCache = 0;
         }
 
         // yuiDebug() << "Pageing ?: " << paging() << std::endl;
@@ -138,23 +161,77 @@ int NCPad::update()
 			    false /* are blanks transparent */);
 	}
 
-        // Here: Table is paging, so we must prepare the visible lines
-        // on the Pad before we're copying them to the destwin:
-        wsze lSze( 1, width() );
-        for ( int i = 0; i <= maxdpos.L; ++i )
-        {
-            directDraw( *this, wrect( wpos( i, 0 ), lSze ), srect.Pos.L+i );
-        }
-        return copywin( *destwin,
-                        0, srect.Pos.C,
-                        drect.Pos.L, drect.Pos.C,
-                        maxdpos.L,   maxdpos.C,
-                        false );
+        // Here: The pad is paging, so the visible lines are copied from
+        // the cached pages. Pages that are not cached are filled via
+        // directDraw() on the fly.
+        pageCache()->setBackground( getbkgd() );
+
+        return pageCache()->copyTo( *destwin,
+                                   srect.Pos.L, srect.Pos.C,
+                                   drect.Pos.L, drect.Pos.C,
+                                   maxdpos.L,   maxdpos.C );
     }
     return OK;
 }
 
 
+NCPadPageCache * NCPad::pageCache()
+{
+    if ( !_pageCache )
+    {
+	_pageCache = new NCPadPageCache( [this]( NCursesWindow & w, const wrect at, unsigned lineno )
+					 {
+					     directDraw( w, at, lineno );
+					 },
+					 CACHE_PAGE_HEIGHT,
+					 CACHE_POOL_SIZE );
+	_pageCache->resize( vheight(), width() );
+    }
+
+    return _pageCache;
+}
+
+
+void NCPad::directDraw( NCursesWindow & w, const wrect at, unsigned lineno )
+{
+    if ( _lineProvider )
+	_lineProvider( w, at, lineno );
+}
+
+
+void NCPad::invalidatePages()
+{
+    if ( _pageCache )
+	_pageCache->invalidate();
+}
+
+
+void NCPad::redrawPagedLine( unsigned lineno )
+{
+    if ( _pageCache )
+	_pageCache->redrawLine( lineno );
+}
+
+
+void NCPad::drawLines()
+{
+    if ( paging() )
+    {
+	invalidatePages();
+	return;
+    }
+
+    clear();
+
+    wsze lSze( 1, width() );
+
+    for ( int i = 0; i < height(); ++i )
+    {
+	directDraw( *this, wrect( wpos( i, 0 ), lSze ), i );
+    }
+}
+
+
 int NCPad::setpos( const wpos & newpos )
 {
     srect.Pos = newpos.between( 0, maxspos );
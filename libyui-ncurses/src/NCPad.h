@@ -29,6 +29,7 @@
 
 #include "NCurses.h"
 #include "NCWidget.h"
+#include "NCPadPageCache.h"
 
 
 //! Interface for scroll callbacks
@@ -111,6 +112,10 @@ public:
 /// viewport window and so does NCPad (*destwin*).
 class NCPad : public NCursesPad, public NCScrollHint
 {
+public:
+
+    typedef NCPadPageCache::LineProvider LineProvider;
+
 private:
 
     /** The real height in case the NCursesPad is truncated, otherwise \c 0.
@@ -121,13 +126,23 @@ private:
      * more than 32768 lines). If \ref resize truncated the window, the real
      * size is in \ref _vheight. Longer lists need to be paged.
      *
-     * \todo Once all NCPad based types are able to page, \a maxPadHeight could be
-     * std::set to e.g \c 1024 to avoid bigger widgets in memory. Currently just
-     * \ref NCTablePad supports paging. If paging is \c ON, all content lines are
-     * written via \ref directDraw. Without paging \ref DoRedraw is reponsible for this.
+     * Pads that can page (see \ref pageable) are truncated as soon as they
+     * are higher than one page to avoid big widgets in memory. If paging is
+     * \c ON, all content lines are written via \ref directDraw into the
+     * pages of \ref _pageCache. Without paging \ref DoRedraw is reponsible
+     * for this.
      */
     int   _vheight;
 
+    /// Backing store of the content lines while paging, otherwise nullptr (owned)
+    NCPadPageCache * _pageCache;
+
+    /// Draws the content lines on demand (may be empty)
+    LineProvider _lineProvider;
+
+    /// Return the page cache, creating it if necessary
+    NCPadPageCache * pageCache();
+
 protected:
 
     const NCWidget & parw;
@@ -148,6 +163,25 @@ protected:
     /** Whether the Pad is truncated (we're paging). */
     bool paging() const { return _vheight; }
 
+    /**
+     * Whether this pad is able to page, i.e. it can draw any content line
+     * on demand via \ref directDraw. By default this is the case if a
+     * line provider is set.
+     */
+    virtual bool pageable() const { return (bool) _lineProvider; }
+
+    /**
+     * Discard all cached pages (if paging) after the content changed.
+     * They are refilled via \ref directDraw when they are needed again.
+     */
+    void invalidatePages();
+
+    /**
+     * Redraw content line *lineno* via \ref directDraw if its page is
+     * cached (if paging).
+     */
+    void redrawPagedLine( unsigned lineno );
+
     virtual int dirtyPad() { dirty = false; return setpos( CurPos() ); }
 
     /// Set the visible position to *newpos* (but clamp by *maxspos*), then \ref update.
@@ -168,15 +202,17 @@ protected:
      * is truncated, the visible lines are prepared immediately before
      * they are written to \ref destwin
      * .
+     * By default this calls the line provider (if there is one).
+     *
      * \see \ref _vheight.
      */
-    virtual void directDraw( NCursesWindow & w, const wrect at, unsigned lineno ) {}
+    virtual void directDraw( NCursesWindow & w, const wrect at, unsigned lineno );
 
 public:
 
     /// @param p (used just for styling info, NOT sizing)
     NCPad( int lines, int cols, const NCWidget & p );
-    virtual ~NCPad() {}
+    virtual ~NCPad();
 
 public:
 
@@ -192,6 +228,16 @@ public:
     virtual void wRecoded();
     virtual void setDirty() { dirty = true; }
 
+    /// Set a callback that draws a single content line on demand.
+    /// This makes a plain NCPad \ref pageable, so it can hold any number of
+    /// lines with bounded memory.
+    void setLineProvider( LineProvider provider ) { _lineProvider = provider; }
+
+    /// (Re-)draw all content lines via the line provider: Directly into the
+    /// pad if it is not truncated, otherwise the cached pages are discarded
+    /// to be refilled on demand.
+    void drawLines();
+
     int update();
     virtual int setpos() { return setpos( CurPos() ); }
 
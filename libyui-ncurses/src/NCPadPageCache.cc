@@ -0,0 +1,197 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#include <algorithm>
+
+#include "NCPadPageCache.h"
+
+
+NCPadPageCache::NCPadPageCache( LineProvider provider,
+                                unsigned     pageHeight,
+                                unsigned     poolSize )
+    : _provider( provider )
+    , _pageHeight( pageHeight ? pageHeight : 1 )
+    , _poolSize( poolSize ? poolSize : 1 )
+    , _lines( 0 )
+    , _cols( 0 )
+    , _bkgd( 0 )
+    , _clock( 0 )
+    , _hits( 0 )
+    , _misses( 0 )
+{
+    _pool.reserve( _poolSize );
+}
+
+
+NCPadPageCache::~NCPadPageCache()
+{
+    clearPool();
+}
+
+
+void NCPadPageCache::clearPool()
+{
+    for ( Page & page : _pool )
+        delete page.pad;
+
+    _pool.clear();
+}
+
+
+void NCPadPageCache::resize( unsigned lines, unsigned cols )
+{
+    _lines = lines;
+
+    if ( cols != _cols )
+    {
+        // The pages need a different width: Throw them away, new ones are
+        // created on demand.
+        clearPool();
+        _cols = cols;
+    }
+    else
+    {
+        invalidate();
+    }
+}
+
+
+void NCPadPageCache::setBackground( chtype bkgd )
+{
+    if ( bkgd != _bkgd )
+    {
+        _bkgd = bkgd;
+        invalidate();
+    }
+}
+
+
+void NCPadPageCache::invalidate()
+{
+    for ( Page & page : _pool )
+        page.pageNo = -1;
+}
+
+
+void NCPadPageCache::redrawLine( unsigned lineNo )
+{
+    if ( lineNo >= _lines )
+        return;
+
+    int pageNo = lineNo / _pageHeight;
+
+    for ( Page & page : _pool )
+    {
+        if ( page.pageNo == pageNo )
+        {
+            int row = lineNo % _pageHeight;
+
+            page.pad->move( row, 0 );
+            page.pad->clrtoeol();
+            _provider( *page.pad, wrect( wpos( row, 0 ), wsze( 1, _cols ) ), lineNo );
+
+            return;
+        }
+    }
+}
+
+
+int NCPadPageCache::copyTo( NCursesWindow & dest,
+                            int sminrow, int smincol,
+                            int dminrow, int dmincol,
+                            int dmaxrow, int dmaxcol )
+{
+    int ret  = OK;
+    int srow = sminrow;
+    int drow = dminrow;
+
+    // Copy page by page: The destination rectangle may span several pages,
+    // and the pool may even be smaller than that.
+
+    while ( drow <= dmaxrow )
+    {
+        int pageRow = srow % _pageHeight;
+        int rows    = std::min( (int) _pageHeight - pageRow, dmaxrow - drow + 1 );
+
+        NCursesPad * page = fetchPage( srow / _pageHeight );
+
+        if ( page->copywin( dest,
+                            pageRow, smincol,
+                            drow,    dmincol,
+                            drow + rows - 1, dmaxcol,
+                            false ) == ERR )
+        {
+            ret = ERR;
+        }
+
+        srow += rows;
+        drow += rows;
+    }
+
+    return ret;
+}
+
+
+NCursesPad * NCPadPageCache::fetchPage( int pageNo )
+{
+    Page * lru = 0;
+
+    for ( Page & page : _pool )
+    {
+        if ( page.pageNo == pageNo )
+        {
+            ++_hits;
+            page.lastUsed = ++_clock;
+
+            return page.pad;
+        }
+
+        if ( !lru || page.lastUsed < lru->lastUsed )
+            lru = &page;
+    }
+
+    if ( _pool.size() < _poolSize )
+    {
+        Page page;
+        page.pad      = new NCursesPad( _pageHeight, _cols ? _cols : 1 );
+        page.pageNo   = -1;
+        page.lastUsed = 0;
+
+        _pool.push_back( page );
+        lru = &_pool.back();
+    }
+
+    ++_misses;
+    fillPage( *lru, pageNo );
+    lru->lastUsed = ++_clock;
+
+    return lru->pad;
+}
+
+
+void NCPadPageCache::fillPage( Page & page, int pageNo )
+{
+    page.pageNo = pageNo;
+    page.pad->bkgdset( _bkgd );
+    page.pad->clear();
+
+    unsigned first = pageNo * _pageHeight;
+    unsigned last  = std::min( first + _pageHeight, _lines );
+    wsze lineSze( 1, _cols );
+
+    for ( unsigned lineNo = first; lineNo < last; ++lineNo )
+        _provider( *page.pad, wrect( wpos( lineNo - first, 0 ), lineSze ), lineNo );
+}
@@ -0,0 +1,168 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#ifndef NCPadPageCache_h
+#define NCPadPageCache_h
+
+#include <functional>
+#include <vector>
+
+#include "NCurses.h"
+
+
+/**
+ * A fixed-size pool of small ncurses pads ("pages") that together act as
+ * the backing store of an NCPad that is too high to be held in a single
+ * NCursesPad.
+ *
+ * Each page holds 'pageHeight' consecutive lines of the virtual pad. Pages
+ * are filled on demand by calling the line provider for each line of the
+ * page; if all pages are in use, the least recently used one is reused.
+ * This keeps memory usage bounded no matter how many lines the virtual pad
+ * has.
+ **/
+class NCPadPageCache
+{
+public:
+
+    /**
+     * Callback to draw line 'lineNo' of the virtual pad into window 'w' at
+     * rectangle 'at'. The rectangle is always one line high and as wide as
+     * the pad.
+     **/
+    typedef std::function<void( NCursesWindow & w, const wrect at, unsigned lineNo )> LineProvider;
+
+    /**
+     * Constructor.
+     *
+     * 'poolSize' is the maximum number of pages held at any time.
+     **/
+    NCPadPageCache( LineProvider provider,
+                    unsigned     pageHeight = 64,
+                    unsigned     poolSize   = 8 );
+
+    /**
+     * Destructor.
+     **/
+    ~NCPadPageCache();
+
+    /**
+     * Set the size of the virtual pad. This discards all pages.
+     **/
+    void resize( unsigned lines, unsigned cols );
+
+    /**
+     * Set the background of newly filled pages. If this is different from
+     * the current one, all cached pages are invalidated.
+     **/
+    void setBackground( chtype bkgd );
+
+    /**
+     * Invalidate all pages. They are refilled from the line provider when
+     * they are needed the next time.
+     **/
+    void invalidate();
+
+    /**
+     * Redraw line 'lineNo' from the line provider if its page is cached.
+     * Nothing is done if the page is not cached: It will be filled with the
+     * up-to-date content anyway when it is needed.
+     **/
+    void redrawLine( unsigned lineNo );
+
+    /**
+     * Copy a rectangle of the virtual pad starting at line 'sminrow' and
+     * column 'smincol' to the rectangle 'dminrow', 'dmincol', 'dmaxrow',
+     * 'dmaxcol' of window 'dest', fetching or filling the pages as needed.
+     *
+     * This is the paged equivalent of NCursesWindow::copywin().
+     **/
+    int copyTo( NCursesWindow & dest,
+                int sminrow, int smincol,
+                int dminrow, int dmincol,
+                int dmaxrow, int dmaxcol );
+
+    /**
+     * Return the number of lines of the virtual pad.
+     **/
+    unsigned lines() const { return _lines; }
+
+    /**
+     * Return the number of lines of each page.
+     **/
+    unsigned pageHeight() const { return _pageHeight; }
+
+    /**
+     * Return the number of page requests that could be served from the
+     * pool.
+     **/
+    unsigned long hits() const { return _hits; }
+
+    /**
+     * Return the number of page requests that needed a page to be filled
+     * from the line provider.
+     **/
+    unsigned long misses() const { return _misses; }
+
+private:
+
+    // Disable unwanted assignment operator and copy constructor
+
+    NCPadPageCache & operator=( const NCPadPageCache & );
+    NCPadPageCache( const NCPadPageCache & );
+
+    struct Page
+    {
+        NCursesPad *  pad;      ///< (owned)
+        int           pageNo;   ///< -1 if the page content is invalid
+        unsigned long lastUsed; ///< for LRU eviction
+    };
+
+    /**
+     * Return the page with number 'pageNo', filling the least recently used
+     * page of the pool if it is not cached.
+     **/
+    NCursesPad * fetchPage( int pageNo );
+
+    /**
+     * Fill 'page' with the lines of page number 'pageNo'.
+     **/
+    void fillPage( Page & page, int pageNo );
+
+    /**
+     * Delete all pages.
+     **/
+    void clearPool();
+
+
+    //
+    // Data members
+    //
+
+    LineProvider      _provider;
+    unsigned          _pageHeight;
+    unsigned          _poolSize;
+    unsigned          _lines;
+    unsigned          _cols;
+    chtype            _bkgd;
+    std::vector<Page> _pool;
+    unsigned long     _clock;
+    unsigned long     _hits;
+    unsigned long     _misses;
+};
+
+
+#endif // NCPadPageCache_h
@@ -460,6 +460,13 @@ void NCPadWidget::setLabel( const NClabel & nlabel )
 }
 
 
+void NCPadWidget::setFrameHint( const NCstring & hint )
+{
+    frameHint = NClabel( hint );
+    Redraw();
+}
+
+
 void NCPadWidget::wRedraw()
 {
     if ( !win )
@@ -477,6 +484,10 @@ void NCPadWidget::wRedraw()
 	label.drawAt( *win, style, wpos( 0, 1 ),
 		      wsze( 1, win->width() - 2 ), NC::TOPLEFT, false );
 
+    if ( frameHint.width() )
+	frameHint.drawAt( *win, style, wpos( 0, 1 ),
+			  wsze( 1, win->width() - 2 ), NC::TOPRIGHT, false );
+
     InitPad();
 
     if ( !pad->Destwin() )
@@ -47,6 +47,7 @@ private:
 
 
     NClabel	    label;
+    NClabel	    frameHint;
     NCursesWindow * padwin;    ///< (owned IFF different from NCWidget::*win*)
     NCScrollbar *   hsb;               ///< (owned)
     NCScrollbar *   vsb;               ///< (owned)
@@ -66,6 +67,12 @@ protected:
     bool    hasHeadline;
     bool    activeLabelOnly;
 
+    /**
+     * Set a short hint that is displayed right-aligned in the top frame
+     * line, e.g. a filter string. An empty hint removes it.
+     */
+    void setFrameHint( const NCstring & hint );
+
     void startMultidraw()    { multidraw = true; }
 
     void stopMultidraw()     { multidraw = false; DrawPad(); }
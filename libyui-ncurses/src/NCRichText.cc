@@ -244,7 +244,7 @@ void NCRichText::wRedraw()
 
     if ( initial && autoScrollDown() )
     {
-	myPad()->ScrlTo( wpos( myPad()->maxy(), 0 ) );
+	myPad()->ScrlToLastLine();
     }
 
     return;
@@ -301,6 +301,17 @@ NCPad * NCRichText::CreatePad()
     wsze psze( defPadSze() );
     textwidth = psze.W;
     NCPad * npad = new NCPad( psze.H, textwidth, *this );
+
+    if ( plainText )
+    {
+	// Plain text lines can be drawn one by one, so the pad can page.
+	// In HTML mode, the layout is only known while rendering the pad.
+	npad->setLineProvider( [this]( NCursesWindow & w, const wrect at, unsigned lineNo )
+			       {
+				   DrawPlainLine( w, at, lineNo );
+			       } );
+    }
+
     return npad;
 }
 
@@ -330,15 +341,17 @@ void NCRichText::DrawPlainPad()
     NCtext ftext( text );
     // yuiDebug() << "ftext is " << wsze( ftext.Lines(), ftext.Columns() ) << std::endl;
 
+    plainLines.assign( ftext.begin(), ftext.end() );
+
     AdjustPad( wsze( ftext.Lines(), ftext.Columns() ) );
+    myPad()->drawLines();
+}
 
-    cl = 0;
 
-    for ( NCtext::const_iterator line = ftext.begin();
-	  line != ftext.end(); ++line, ++cl )
-    {
-	myPad()->addwstr( cl, 0, ( *line ).str().c_str() );
-    }
+void NCRichText::DrawPlainLine( NCursesWindow & w, const wrect at, unsigned lineNo )
+{
+    if ( lineNo < plainLines.size() )
+	w.addwstr( at.Pos.L, at.Pos.C, plainLines[ lineNo ].str().c_str() );
 }
 
 void NCRichText::PadPreTXT( const wchar_t * osch, const unsigned olen )
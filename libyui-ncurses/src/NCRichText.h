@@ -27,6 +27,7 @@
 
 #include <iosfwd>
 #include <stack>
+#include <vector>
 
 #include <yui/YRichText.h>
 #include "NCPadWidget.h"
@@ -66,6 +67,9 @@ private:
 
     bool plainText;
 
+    /// The formatted lines of *text* in plain text mode
+    std::vector<NCstring> plainLines;
+
     unsigned textwidth;
     unsigned cl;
     unsigned cc;
@@ -186,6 +190,7 @@ private:
     void PadSetAttr();
 
     void DrawPlainPad();
+    void DrawPlainLine( NCursesWindow & w, const wrect at, unsigned lineNo );
     void DrawHTMLPad();
 
     void PadNL();
@@ -87,6 +87,7 @@ public:
     // to be called to reflect changed attributes on screen
     static void attrchanged()
     {
+	NCstyle::attrChanged();
 	NCurses::Redraw();
 	showex( EX_UPDATE );
     }
@@ -1467,43 +1468,49 @@ void NCStyleDef::saveStyle()
     out << "" << std::endl;
     out << "#include \"NCstyle.h\"" << std::endl;
     out << "" << std::endl;
-    out << "inline void NCstyleInit_" << NCstyle_C.styleName << "( std::vector<NCstyle::Style> & styleSet )" << std::endl;
+    out << "constexpr NCstyle::Theme NCstyleTheme_" << NCstyle_C.styleName << " =" << std::endl;
     out << "{" << std::endl;
+    out << "    \"" << NCstyle_C.styleName << "\"," << std::endl;
 
-    out << "  //=================================================================" << std::endl;
-    out << "  // init global attributes" << std::endl;
-    out << "  //=================================================================" << std::endl;
-    out << "  NCattrset * attrset( &styleSet[NCstyle::" << NCstyle::dumpName( NCstyle::DefaultStyle ) << "].getAttrGlobal() );" << std::endl;
+    out << "    //=================================================================" << std::endl;
+    out << "    // global attributes" << std::endl;
+    out << "    //=================================================================" << std::endl;
+    out << "    {" << std::endl;
 
     for ( NCstyle::STglobal a = ( NCstyle::STglobal )0; a < NCstyle::MaxSTglobal; a = ( NCstyle::STglobal )( a + 1 ) )
     {
-	out << "  attrset->setAttr( NCstyle::"
+	out << "\t/* "
 	<< NCstyle::dumpName( a )
-	<< ", ";
+	<< " */ ";
 	dumpChtype( out, NCstyle_C( a ) )
-	<< " );" << std::endl;
+	<< "," << std::endl;
     }
 
-    out << "  //=================================================================" << std::endl;
-    out << "  // init local attributes" << std::endl;
-    out << "  //=================================================================" << std::endl;
+    out << "    }," << std::endl;
+    out << "    //=================================================================" << std::endl;
+    out << "    // local attributes" << std::endl;
+    out << "    //=================================================================" << std::endl;
+    out << "    {" << std::endl;
 
     for ( NCstyle::StyleSet sts = ( NCstyle::StyleSet )0; sts < NCstyle::MaxStyleSet; sts = ( NCstyle::StyleSet )( sts + 1 ) )
     {
-	out << "  // " << NCstyle::dumpName( sts ) << std::endl;
-	out << "  attrset = &styleSet[NCstyle::" << NCstyle::dumpName( sts ) << "].getAttrLocal();"  << std::endl;
+	out << "\t// " << NCstyle::dumpName( sts ) << std::endl;
+	out << "\t{" << std::endl;
 
 	for ( NCstyle::STlocal a = ( NCstyle::STlocal )0; a < NCstyle::MaxSTlocal; a = ( NCstyle::STlocal )( a + 1 ) )
 	{
-	    out << "  attrset->setAttr( NCstyle::"
+	    out << "\t    /* "
 	    << NCstyle::dumpName( a )
-	    << ", ";
-	    dumpChtype( out, NCstyle_C.styleSet[sts]( a ) )
-	    << " );" << std::endl;
+	    << " */ ";
+	    dumpChtype( out, NCstyle_C.getStyle( sts )( a ) )
+	    << "," << std::endl;
 	}
+
+	out << "\t}," << std::endl;
     }
 
-    out << "}" << std::endl;
+    out << "    }" << std::endl;
+    out << "};" << std::endl;
     out << "#endif // " << hname << std::endl;
     out.close();
 
@@ -1560,10 +1567,11 @@ void NCStyleDef::restoreStyle()
     std::list<std::string> data_vec[NCstyle::MaxStyleSet+1];
     NCstyle::StyleSet cvec = NCstyle::MaxStyleSet;
 
-    std::string initfnc_ti( "inline void NCstyleInit_" );
-    initfnc_ti += NCstyle_C.styleName + "(";
-    std::string attrdef( "  attrset->setAttr( NCstyle::" );
-    std::string stydef( "  attrset = &styleSet[NCstyle::" );
+    std::string themedef( "constexpr NCstyle::Theme NCstyleTheme_" );
+    themedef += NCstyle_C.styleName + " ";
+    std::string attrdef( "/* " );
+    std::string attrsep( " */ " );
+    std::string stydef( "// " );
 
     enum STATE { PRE, ONFNC, IN, POST, ERROR };
     STATE psaw = PRE;
@@ -1587,16 +1595,15 @@ void NCStyleDef::restoreStyle()
 	    {
 		case PRE:
 
-		    if ( line.find( initfnc_ti ) == 0 )
+		    if ( line.find( themedef ) == 0 )
 			psaw = ONFNC;
 
 		    break;
 
 		case ONFNC:
-		    if ( line == "{" || line.find( "  //" ) == 0 )
-			break;
+		    // skip everything up to the opening brace of the global attributes
 
-		    if ( line == "  NCattrset * attrset( &styleSet[NCstyle::DefaultStyle].getAttrGlobal() );" )
+		    if ( line == "    {" )
 		    {
 			psaw = IN;
 			cvec = NCstyle::MaxStyleSet;
@@ -1604,58 +1611,53 @@ void NCStyleDef::restoreStyle()
 			//p.show();
 			//p.refresh();
 		    }
-		    else
-			psaw = ERROR;
 
 		    break;
 
 		case IN:
-		    if ( line == "}" )
+		    line.erase( 0, line.find_first_not_of( " \t" ) );
+
+		    if ( line == "};" )
 		    {
 			psaw = POST;
 			break;
 		    }
 
-		    if ( line.find( "  //" ) == 0 )
+		    if ( line == "{" || line == "}" || line == "}," )
 			break;
 
 		    if ( line.find( attrdef ) == 0 )
 		    {
-			data_vec[cvec].push_back( line.substr( attrdef.size() ) );
+			std::string::size_type sep = line.find( attrsep );
+
+			if ( sep == std::string::npos )
+			{
+			    psaw = ERROR;
+			    break;
+			}
+
+			std::string val( line.substr( sep + attrsep.size() ) );
+
+			if ( val.size() && val[ val.size() - 1 ] == ',' )
+			    val.erase( val.size() - 1 );
+
+			data_vec[cvec].push_back( line.substr( attrdef.size(), sep - attrdef.size() ) + ", " + val );
 			//p.printw( "." );
 		    }
 		    else if ( line.find( stydef ) == 0 )
 		    {
 			line.erase( 0, stydef.size() );
 
-			if ( line.find( "DefaultStyle]" ) == 0 )
+			for ( NCstyle::StyleSet sts = ( NCstyle::StyleSet )0; sts < NCstyle::MaxStyleSet; sts = ( NCstyle::StyleSet )( sts + 1 ) )
 			{
-			    cvec = NCstyle::DefaultStyle;
-			    //p.printw( "[DefaultStyle]" );
-			}
-			else if ( line.find( "InfoStyle]" ) == 0 )
-			{
-			    cvec = NCstyle::InfoStyle;
-			    //p.printw( "[InfoStyle]" );
-			}
-			else if ( line.find( "WarnStyle]" ) == 0 )
-			{
-			    cvec = NCstyle::WarnStyle;
-			    //p.printw( "[WarnStyle]" );
-			}
-			else if ( line.find( "PopupStyle]" ) == 0 )
-			{
-			    cvec = NCstyle::PopupStyle;
-			    //p.printw( "[PopupStyle]" );
-			}
-			else
-			{
-			    psaw = ERROR;
+			    if ( line == NCstyle::dumpName( sts ) )
+			    {
+				cvec = sts;
+				//p.printw( "[%s]", line.c_str() );
+			    }
 			}
 
-			p.show();
-
-			p.refresh();
+			// any other comment is ignored
 		    }
 		    else
 		    {
@@ -68,6 +68,7 @@ NCTable::NCTable( YWidget *      parent,
     , _lastSortCol( 0 )
     , _sortReverse( false )
     , _sortStrategy( new NCTableSortDefault() )
+    , _filterInput( false )
 {
     // yuiDebug() << endl;
 
@@ -154,27 +155,50 @@ void NCTable::setCell( int index, int col, const string & newtext )
 
 void NCTable::cellChanged( const YTableCell * changedCell )
 {
-    YUI_CHECK_PTR( changedCell );
-
-    YTableItem * ytableItem = changedCell->parent();
-    YUI_CHECK_PTR( ytableItem );
+    // Same as for several cells: This also updates the filter
+    cellsChanged( vector<const YTableCell *>( 1, changedCell ) );
+}
 
-    NCTableLine * tableLine = (NCTableLine *) ytableItem->data();
-    YUI_CHECK_PTR( tableLine );
 
-    NCTableCol * tableCol = tableLine->GetCol( changedCell->column() );
+void NCTable::cellsChanged( const vector<const YTableCell *> & cells )
+{
+    std::unordered_set<const NCTableLine *> changedLines;
+    bool widthChanged = false;
 
-    if ( tableCol )
+    for ( const YTableCell * changedCell : cells )
     {
+        YUI_CHECK_PTR( changedCell );
+
+        YTableItem * ytableItem = changedCell->parent();
+        YUI_CHECK_PTR( ytableItem );
+
+        NCTableLine * tableLine = (NCTableLine *) ytableItem->data();
+        YUI_CHECK_PTR( tableLine );
+
+        NCTableCol * tableCol = tableLine->GetCol( changedCell->column() );
+
+        if ( ! tableCol )
+        {
+            yuiError() << "No column #" << changedCell->column()
+                       << " in item " << ytableItem
+                       << endl;
+            continue;
+        }
+
+        int oldWidth = tableCol->Size().W;
         tableCol->SetLabel( changedCell->label() );
-        DrawPad();
-    }
-    else
-    {
-        yuiError() << "No column #" << changedCell->column()
-                   << " in item " << ytableItem
-                   << endl;
+
+        if ( tableCol->Size().W > oldWidth )
+            widthChanged = true;
+
+        changedLines.insert( tableLine );
     }
+
+    if ( changedLines.empty() )
+        return;
+
+    myPad()->linesChanged( changedLines, widthChanged );
+    DrawPad();
 }
 
 
@@ -540,13 +564,62 @@ bool NCTable::setItemByKey( int key )
 NCPad * NCTable::CreatePad()
 {
     wsze    psze( defPadSze() );
-    NCPad * npad = new NCTablePad( psze.H, psze.W, *this );
+    NCTablePad * npad = new NCTablePad( psze.H, psze.W, *this );
     npad->bkgd( listStyle().item.plain );
+    npad->setFilter( NCstring( filter() ).str() );
 
     return npad;
 }
 
 
+void NCTable::setFilter( const string & filter )
+{
+    YTable::setFilter( filter );
+    _filterInput = true;
+
+    if ( myPad() )
+    {
+        myPad()->setFilter( NCstring( filter ).str() );
+        updateFilterHint();
+        DrawPad();
+    }
+}
+
+
+bool NCTable::handleFilterInput( wint_t key, NCursesEvent & event )
+{
+    if ( ! _filterInput )
+        return false;
+
+    std::wstring oldFilter = myPad()->filter();
+
+    if ( ! myPad()->handleFilterInput( key ) )
+        return false;
+
+    updateFilterHint();
+    DrawPad();
+
+    if ( myPad()->filter() != oldFilter )
+    {
+        YTable::setFilter( NCstring( myPad()->filter() ).Str() );
+
+        if ( notify() )
+            event = NCursesEvent::FilterChanged;
+    }
+
+    return true;
+}
+
+
+void NCTable::updateFilterHint()
+{
+    if ( myPad()->editingFilter() || ! myPad()->filter().empty() )
+        setFrameHint( NCstring( L"/" + myPad()->filter() ) );
+    else
+        setFrameHint( NCstring( "" ) );
+}
+
+
 /**
  * NCurses widget keyboard handler.
  *
@@ -569,6 +642,12 @@ NCursesEvent NCTable::wHandleInput( wint_t key )
     // - NCTablePadBase::handleInput()
     // - NCTableLine::handleInput()
 
+    // While the user is typing a filter string, all printable keys go to
+    // the filter.
+
+    if ( handleFilterInput( key, ret ) )
+        return ret;
+
     bool handled = handleInput( key ); // NCTablePad::handleInput()
 
     switch ( key )
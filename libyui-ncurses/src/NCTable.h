@@ -161,6 +161,18 @@ public:
      **/
     virtual NCursesEvent wHandleInput( wint_t key );
 
+    /**
+     * Set a filter string: Only items that contain it are displayed.
+     *
+     * This also enables interactive filtering: From then on, the user can
+     * type a filter string after pressing '/'. Applications that want this
+     * without an initial filter can set an empty filter. Until then, '/'
+     * is handled like any other key.
+     *
+     * Reimplemented from YTable.
+     **/
+    virtual void setFilter( const std::string & filter );
+
     /**
      * libyui geometry management:
      * Return the preferred width for this widget.
@@ -280,6 +292,18 @@ protected:
      **/
     virtual NCPad * CreatePad();
 
+    /**
+     * Let the pad handle interactive filter editing if it is enabled (see
+     * setFilter()). Return 'true' if 'key' was consumed; 'event' is set to
+     * the event to return in that case.
+     **/
+    bool handleFilterInput( wint_t key, NCursesEvent & event );
+
+    /**
+     * Show the current filter (if any) in the frame.
+     **/
+    void updateFilterHint();
+
     /**
      * Return the TreePad that belongs to this widget.
      *
@@ -380,6 +404,14 @@ protected:
      **/
     void cellChanged( const YTableCell * cell );
 
+    /**
+     * Notification that the labels of 'cells' changed, e.g. to show a new
+     * status. Unlike one cellChanged() call for each of them, only the
+     * lines of these cells are redrawn, and the column widths are only
+     * recalculated if a label got wider.
+     **/
+    void cellsChanged( const std::vector<const YTableCell *> & cells );
+
     /**
      * Change the cell with item index 'index' and column no. 'col' to 'newText'.
      **/
@@ -454,6 +486,8 @@ private:
     int  _lastSortCol;
     bool _sortReverse;
     NCTableSortStrategyBase * _sortStrategy;    //< owned
+
+    bool _filterInput;  // '/' starts filter editing
 };
 
 
@@ -0,0 +1,258 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#include <algorithm>
+#include <cwctype>
+
+#include "NCTableFilterIndex.h"
+#include "NCTableItem.h"
+
+using std::vector;
+using std::wstring;
+
+
+NCTableFilterIndex::NCTableFilterIndex()
+    : _removedCount( 0 )
+    , _lastMatchesValid( false )
+{
+}
+
+
+NCTableFilterIndex::~NCTableFilterIndex()
+{
+}
+
+
+void NCTableFilterIndex::clear()
+{
+    _lines.clear();
+    _texts.clear();
+    _ids.clear();
+    _postings.clear();
+    _changedLines.clear();
+    _removedCount     = 0;
+    _lastMatchesValid = false;
+}
+
+
+wstring NCTableFilterIndex::foldCase( const wstring & text )
+{
+    wstring result( text );
+
+    for ( wchar_t & ch : result )
+        ch = towlower( ch );
+
+    return result;
+}
+
+
+wstring NCTableFilterIndex::lineText( const NCTableLine * line )
+{
+    wstring text;
+
+    for ( unsigned col = 0; col < line->Cols(); ++col )
+    {
+        const NCTableCol * cell = line->GetCol( col );
+
+        if ( !cell )
+            continue;
+
+        for ( const NCstring & str : cell->Label().getText() )
+        {
+            // Separate the cells so a filter never matches across them
+            text += L'\n';
+            text += str.str();
+        }
+    }
+
+    return foldCase( text );
+}
+
+
+NCTableFilterIndex::Trigram
+NCTableFilterIndex::trigram( const wstring & text, unsigned pos )
+{
+    const Trigram mask = 0x1fffff; // 21 bits are enough for any Unicode character
+
+    return ( ( (Trigram) text[ pos     ] & mask ) << 42 )
+        |  ( ( (Trigram) text[ pos + 1 ] & mask ) << 21 )
+        |    ( (Trigram) text[ pos + 2 ] & mask );
+}
+
+
+void NCTableFilterIndex::addLine( const NCTableLine * line )
+{
+    if ( !line )
+        return;
+
+    if ( _ids.find( line ) != _ids.end() )
+        removeLine( line );
+
+    unsigned id = _lines.size();
+    _lines.push_back( line );
+    _texts.push_back( lineText( line ) );
+    _ids[ line ] = id;
+
+    const wstring & text = _texts.back();
+
+    if ( text.size() >= 3 )
+    {
+        vector<Trigram> trigrams;
+        trigrams.reserve( text.size() - 2 );
+
+        for ( unsigned pos = 0; pos + 2 < text.size(); ++pos )
+            trigrams.push_back( trigram( text, pos ) );
+
+        // Add each line only once to each posting list. Since IDs are
+        // handed out in ascending order, the posting lists stay sorted.
+
+        std::sort( trigrams.begin(), trigrams.end() );
+        trigrams.erase( std::unique( trigrams.begin(), trigrams.end() ), trigrams.end() );
+
+        for ( Trigram tri : trigrams )
+            _postings[ tri ].push_back( id );
+    }
+
+    // A new line might match the last filter, too
+    _lastMatchesValid = false;
+}
+
+
+void NCTableFilterIndex::removeLine( const NCTableLine * line )
+{
+    auto it = _ids.find( line );
+
+    if ( it == _ids.end() )
+        return;
+
+    // Leave the ID in the posting lists; match() skips removed lines.
+    _lines[ it->second ] = 0;
+    _texts[ it->second ].clear();
+    _ids.erase( it );
+    _changedLines.erase( line );
+    ++_removedCount;
+
+    compact();
+}
+
+
+void NCTableFilterIndex::lineChanged( const NCTableLine * line )
+{
+    if ( line && _ids.find( line ) != _ids.end() )
+        _changedLines.insert( line );
+}
+
+
+void NCTableFilterIndex::indexChangedLines()
+{
+    if ( _changedLines.empty() )
+        return;
+
+    vector<const NCTableLine *> changedLines( _changedLines.begin(), _changedLines.end() );
+    _changedLines.clear();
+
+    for ( const NCTableLine * line : changedLines )
+        addLine( line );
+}
+
+
+void NCTableFilterIndex::compact()
+{
+    if ( _removedCount < 1024 || _removedCount < _ids.size() )
+        return;
+
+    // Rebuild the index from the remaining lines in their old order
+
+    vector<const NCTableLine *> lines;
+    lines.reserve( _ids.size() );
+
+    for ( const NCTableLine * line : _lines )
+    {
+        if ( line )
+            lines.push_back( line );
+    }
+
+    clear();
+
+    for ( const NCTableLine * line : lines )
+        addLine( line );
+}
+
+
+vector<const NCTableLine *> NCTableFilterIndex::match( const wstring & filter )
+{
+    indexChangedLines();
+
+    wstring needle = foldCase( filter );
+    vector<unsigned> candidates;
+
+    if ( _lastMatchesValid && needle.find( _lastFilter ) != wstring::npos )
+    {
+        // The new filter is more specific than the last one:
+        // Only the last matches can match this one.
+        candidates.swap( _lastMatches );
+    }
+    else if ( needle.size() >= 3 )
+    {
+        // Check only the lines that have the rarest trigram of the filter
+
+        const vector<unsigned> * rarest = 0;
+
+        for ( unsigned pos = 0; pos + 2 < needle.size(); ++pos )
+        {
+            auto it = _postings.find( trigram( needle, pos ) );
+
+            if ( it == _postings.end() )
+            {
+                rarest = 0;
+                break;
+            }
+
+            if ( !rarest || it->second.size() < rarest->size() )
+                rarest = &it->second;
+        }
+
+        if ( rarest )
+            candidates = *rarest;
+    }
+    else
+    {
+        candidates.reserve( _lines.size() );
+
+        for ( unsigned id = 0; id < _lines.size(); ++id )
+            candidates.push_back( id );
+    }
+
+    vector<unsigned> matchIds;
+
+    for ( unsigned id : candidates )
+    {
+        if ( _lines[ id ] && _texts[ id ].find( needle ) != wstring::npos )
+            matchIds.push_back( id );
+    }
+
+    vector<const NCTableLine *> result;
+    result.reserve( matchIds.size() );
+
+    for ( unsigned id : matchIds )
+        result.push_back( _lines[ id ] );
+
+    _lastFilter       = needle;
+    _lastMatchesValid = true;
+    _lastMatches.swap( matchIds );
+
+    return result;
+}
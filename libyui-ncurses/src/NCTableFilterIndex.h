@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+#ifndef NCTableFilterIndex_h
+#define NCTableFilterIndex_h
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class NCTableLine;
+
+
+/**
+ * Search index for filtering the lines of an NCTablePadBase by a substring
+ * of any of their cells.
+ *
+ * The index keeps the case-folded text of each line and a trigram index
+ * over it: Each sequence of three characters maps to the lines that contain
+ * it. A filter string of three or more characters only needs to check the
+ * lines of its rarest trigram. Filters that extend the previous filter (the
+ * usual case when typing) only check the previous matches.
+ *
+ * Lines are added and removed incrementally; lines whose cells were changed
+ * are only marked and indexed again right before the next match.
+ **/
+class NCTableFilterIndex
+{
+public:
+
+    /**
+     * Constructor.
+     **/
+    NCTableFilterIndex();
+
+    /**
+     * Destructor.
+     **/
+    ~NCTableFilterIndex();
+
+    /**
+     * Remove all lines from the index.
+     **/
+    void clear();
+
+    /**
+     * Add a line to the index. If it is already there, it is indexed again.
+     **/
+    void addLine( const NCTableLine * line );
+
+    /**
+     * Remove a line from the index.
+     **/
+    void removeLine( const NCTableLine * line );
+
+    /**
+     * Notify the index that the cells of a line might have changed. The
+     * line is indexed again right before the next match().
+     **/
+    void lineChanged( const NCTableLine * line );
+
+    /**
+     * Return the lines that contain 'filter' in any of their cells, ignoring
+     * case. The lines are returned in no particular order.
+     **/
+    std::vector<const NCTableLine *> match( const std::wstring & filter );
+
+    /**
+     * Return the number of indexed lines.
+     **/
+    unsigned size() const { return _ids.size(); }
+
+    /**
+     * Return the case-folded version of 'text' as it is used in the index.
+     **/
+    static std::wstring foldCase( const std::wstring & text );
+
+private:
+
+    typedef uint64_t Trigram;
+
+    /**
+     * Return the case-folded text of all cells of 'line'.
+     **/
+    static std::wstring lineText( const NCTableLine * line );
+
+    /**
+     * Return the trigram starting at position 'pos' of 'text'.
+     **/
+    static Trigram trigram( const std::wstring & text, unsigned pos );
+
+    /**
+     * Index all lines that were marked as changed.
+     **/
+    void indexChangedLines();
+
+    /**
+     * Drop the slots of removed lines if there are too many of them.
+     **/
+    void compact();
+
+
+    //
+    // Data members
+    //
+
+    std::vector<const NCTableLine *> _lines;   ///< by ID; 0 for removed lines
+    std::vector<std::wstring>        _texts;   ///< case-folded text by ID
+    std::unordered_map<const NCTableLine *, unsigned> _ids;
+    std::unordered_map<Trigram, std::vector<unsigned> > _postings;
+    std::unordered_set<const NCTableLine *> _changedLines;
+    unsigned                         _removedCount;
+
+    // Result of the last match for incremental filtering
+
+    std::wstring                     _lastFilter;
+    std::vector<unsigned>            _lastMatches;
+    bool                             _lastMatchesValid;
+};
+
+
+#endif // NCTableFilterIndex_h
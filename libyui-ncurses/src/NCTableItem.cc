@@ -714,6 +714,8 @@ NCTableStyle::NCTableStyle( const NCWidget & parentWidget )
     , _colSepWidth( 1 )
     , _colSepChar( ACS_VLINE )
     , _hotCol( (unsigned) - 1 )
+    , _attrGeneration( (unsigned long) - 1 )
+    , _attrState( NC::WSdumb )
 {
 }
 
@@ -780,8 +782,32 @@ chtype NCTableStyle::highlightBG( const NCTableLine::STATE lstate,
 }
 
 
-chtype NCTableStyle::getBG( const NCTableLine::STATE lstate,
-			    const NCTableCol::STYLE  cstyle ) const
+void NCTableStyle::updateAttrCache() const
+{
+    static const NCTableLine::STATE states[] =
+    {
+	NCTableLine::S_NORMAL,
+	NCTableLine::S_ACTIVE,
+	NCTableLine::S_DISABLED,
+	NCTableLine::S_HIDDEN,
+	NCTableLine::S_HEADLINE
+    };
+
+    for ( NCTableLine::STATE lstate : states )
+    {
+	for ( int cstyle = NCTableCol::NONE; cstyle <= NCTableCol::SEPARATOR; ++cstyle )
+	{
+	    _attrCache[ stateIndex( lstate ) ][ cstyle ] = lookupBG( lstate, (NCTableCol::STYLE) cstyle );
+	}
+    }
+
+    _attrGeneration = NCstyle::generation();
+    _attrState      = _parentWidget.GetState();
+}
+
+
+chtype NCTableStyle::lookupBG( const NCTableLine::STATE lstate,
+			       const NCTableCol::STYLE  cstyle ) const
 {
     switch ( lstate )
     {
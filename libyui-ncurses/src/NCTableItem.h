@@ -591,10 +591,28 @@ public:
 
     const NCstyle::StList & listStyle()  const { return _parentWidget.listStyle(); }
 
-    chtype getBG() const { return listStyle().item.plain; }
+    chtype getBG() const { return getBG( NCTableLine::S_NORMAL, NCTableCol::PLAIN ); }
 
+    /// Return the attribute for a cell of style *cstyle* in a line with
+    /// state *lstate*. This is called for each cell that is drawn, so it
+    /// is looked up in a flat cache that is only refilled if the widget
+    /// state or the attributes changed.
     chtype getBG( const NCTableLine::STATE lstate,
-		  const NCTableCol::STYLE  cstyle = NCTableCol::PLAIN ) const;
+		  const NCTableCol::STYLE  cstyle = NCTableCol::PLAIN ) const
+    {
+	int idx = stateIndex( lstate );
+
+	if ( idx < 0 )
+	    return currentBG;
+
+	if ( _attrGeneration != NCstyle::generation()
+	     || _attrState != _parentWidget.GetState() )
+	{
+	    updateAttrCache();
+	}
+
+	return _attrCache[ idx ][ cstyle ];
+    }
 
     chtype highlightBG( const NCTableLine::STATE lstate,
 			const NCTableCol::STYLE  cstyle,
@@ -625,6 +643,28 @@ public:
 
 private:
 
+    /// Index of *lstate* in the attribute cache, -1 if there is none
+    static int stateIndex( const NCTableLine::STATE lstate )
+    {
+	switch ( lstate )
+	{
+	    case NCTableLine::S_NORMAL:		return 0;
+	    case NCTableLine::S_ACTIVE:		return 1;
+	    case NCTableLine::S_DISABLED:	return 2;
+	    case NCTableLine::S_HIDDEN:		return 3;
+	    case NCTableLine::S_HEADLINE:	return 4;
+	}
+
+	return -1;
+    }
+
+    /// Look up the attribute for getBG() in the widget's style
+    chtype lookupBG( const NCTableLine::STATE lstate,
+		     const NCTableCol::STYLE  cstyle ) const;
+
+    /// Fill the attribute cache for the current widget state
+    void updateAttrCache() const;
+
     const NCWidget &            _parentWidget;
     NCTableHead                 _headline;
     std::vector<unsigned>	_colWidth;  ///< column widths
@@ -636,6 +676,12 @@ private:
 
     chtype   _colSepChar;	///< column separator character
     unsigned _hotCol;		///< which column is "hot"
+
+    // Cache of getBG() by line state index and column style
+
+    mutable chtype	  _attrCache[ 5 ][ NCTableCol::SEPARATOR + 1 ];
+    mutable unsigned long _attrGeneration;
+    mutable NC::WState	  _attrState;
 };
 
 
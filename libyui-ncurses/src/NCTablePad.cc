@@ -27,6 +27,7 @@
 #define  YUILogComponent "ncurses"
 #include <yui/YUILog.h>
 #include "NCTablePad.h"
+#include "NCHeadless.h"
 
 
 
@@ -43,6 +44,8 @@ NCTablePad::~NCTablePad()
 
 int NCTablePad::DoRedraw()
 {
+    NCHeadless::RedrawTimer timer;
+
     if ( !Destwin() )
     {
 	dirty = true;
@@ -50,12 +53,7 @@ int NCTablePad::DoRedraw()
     }
 
     prepareRedraw();
-
-    if ( ! paging() )
-        drawContentLines();
-    // else
-    //   item drawing requested via directDraw()
-
+    drawContentLines();
     drawHeader();
 
     dirty = false;
@@ -64,20 +62,6 @@ int NCTablePad::DoRedraw()
 }
 
 
-void NCTablePad::directDraw( NCursesWindow & w, const wrect at, unsigned lineNo )
-{
-    if ( lineNo < Lines() )
-    {
-        _visibleItems[ lineNo ]->DrawAt( w,
-                                         at,
-                                         _itemStyle,
-                                         ( (unsigned) currentLineNo() == lineNo) );
-    }
-    else
-        yuiWarning() << "Illegal Line no " << lineNo << " (" << Lines() << ")" << std::endl;
-}
-
-
 bool NCTablePad::handleInput( wint_t key )
 {
     bool handled = false;
@@ -23,11 +23,17 @@
 
 /-*/
 
+#include <algorithm>
+#include <cwctype>
+#include <unordered_set>
+
 #define  YUILogComponent "ncurses"
 #include <yui/YUILog.h>
 #include "NCTablePadBase.h"
+#include "NCHeadless.h"
 
 using std::vector;
+using std::wstring;
 
 
 NCTablePadBase::NCTablePadBase( int lines, int cols, const NCWidget & p )
@@ -38,6 +44,9 @@ NCTablePadBase::NCTablePadBase( int lines, int cols, const NCWidget & p )
     , _dirtyFormat( false )
     , _itemStyle( p )
     , _citem( 0 )
+    , _editingFilter( false )
+    , _filterIndexValid( false )
+    , _drawnLinesCount( 0 )
 {
 }
 
@@ -55,6 +64,8 @@ void NCTablePadBase::ClearTable()
 
     _items.clear();
     _visibleItems.clear();
+    _filterIndex.clear();
+    _filterIndexValid = false;
     setFormatDirty();
 }
 
@@ -93,7 +104,46 @@ const NCTableLine * NCTablePadBase::GetLine( unsigned idx ) const
 NCTableLine * NCTablePadBase::ModifyLine( unsigned idx )
 {
     setFormatDirty();
-    return getLineWithIndex( idx );
+    NCTableLine * line = getLineWithIndex( idx );
+
+    if ( _filterIndexValid )
+        _filterIndex.lineChanged( line );
+
+    return line;
+}
+
+
+void NCTablePadBase::linesChanged( const std::unordered_set<const NCTableLine *> & lines,
+                                   bool widthChanged )
+{
+    if ( lines.empty() )
+        return;
+
+    if ( _filterIndexValid )
+    {
+        for ( const NCTableLine * line : lines )
+            _filterIndex.lineChanged( line );
+    }
+
+    if ( widthChanged )
+        setFormatDirty();
+
+    if ( !_filter.empty() && refilter() )
+        return;
+
+    if ( dirty )
+        return; // the next update redraws everything anyway
+
+    for ( unsigned lineNo = 0; lineNo < visibleLines(); ++lineNo )
+    {
+        if ( lines.find( _visibleItems[ lineNo ] ) == lines.end() )
+            continue;
+
+        if ( paging() )
+            redrawPagedLine( lineNo );
+        else if ( lineNo < _drawnLines.size() && _drawnLines[ lineNo ] )
+            drawLine( lineNo );
+    }
 }
 
 
@@ -120,6 +170,9 @@ void NCTablePadBase::SetLines( unsigned idx )
     {
 	for ( unsigned i = idx; i < Lines(); ++i )
 	{
+	    if ( _filterIndexValid )
+		_filterIndex.removeLine( _items[i] );
+
 	    delete _items[i];
 	}
     }
@@ -130,6 +183,9 @@ void NCTablePadBase::SetLines( unsigned idx )
     {
 	if ( !_items[i] )
 	    _items[i] = new NCTableLine( 0 );
+
+	if ( _filterIndexValid )
+	    _filterIndex.addLine( _items[i] );
     }
 
     setFormatDirty();
@@ -138,6 +194,11 @@ void NCTablePadBase::SetLines( unsigned idx )
 
 void NCTablePadBase::SetLines( std::vector<NCTableLine*> & newItems )
 {
+    // Drop the filter index first: Removing the old lines one by one from
+    // it would only be wasted effort.
+    _filterIndex.clear();
+    _filterIndexValid = false;
+
     SetLines( 0 );
     _items = newItems;
 
@@ -154,9 +215,16 @@ void NCTablePadBase::SetLines( std::vector<NCTableLine*> & newItems )
 void NCTablePadBase::AddLine( unsigned idx, NCTableLine * item )
 {
     assertLine( idx );
+
+    if ( _filterIndexValid )
+        _filterIndex.removeLine( _items[idx] );
+
     delete _items[idx];
     _items[idx] = item ? item : new NCTableLine( 0 );
 
+    if ( _filterIndexValid )
+        _filterIndex.addLine( _items[idx] );
+
     setFormatDirty();
 }
 
@@ -212,6 +280,12 @@ wsze NCTablePadBase::UpdateFormat()
     _dirtyFormat = false;
     updateVisibleItems();
 
+    return resizeToVisibleItems();
+}
+
+
+wsze NCTablePadBase::resizeToVisibleItems()
+{
     maxspos.L = visibleLines() > (unsigned) srect.Sze.H ? visibleLines() - srect.Sze.H : 0;
 
     wsze size( visibleLines(), _itemStyle.TableWidth() );
@@ -228,16 +302,123 @@ void NCTablePadBase::updateVisibleItems()
 {
     _visibleItems.clear();
 
+    if ( _filter.empty() )
+    {
+        for ( unsigned i = 0; i < Lines(); ++i )
+        {
+            if ( _items[ i ]->isVisible() )
+                _visibleItems.push_back( _items[ i ] );
+        }
+
+        return;
+    }
+
+    // Filtering: Show the matching lines and all their parents, no matter
+    // if any branches are open or closed.
+
+    ensureFilterIndex();
+    vector<const NCTableLine *> matches = _filterIndex.match( _filter );
+
+    if ( matches.size() == Lines() )
+    {
+        for ( unsigned i = 0; i < Lines(); ++i )
+        {
+            if ( !_items[ i ]->isHidden() )
+                _visibleItems.push_back( _items[ i ] );
+        }
+
+        return;
+    }
+
+    std::unordered_set<const NCTableLine *> shown;
+    shown.reserve( matches.size() );
+
+    for ( const NCTableLine * line : matches )
+    {
+        while ( line && shown.insert( line ).second )
+            line = line->parent();
+    }
+
+    for ( unsigned i = 0; i < Lines(); ++i )
+    {
+        if ( shown.count( _items[ i ] ) && !_items[ i ]->isHidden() )
+            _visibleItems.push_back( _items[ i ] );
+    }
+}
+
+
+void NCTablePadBase::ensureFilterIndex()
+{
+    if ( _filterIndexValid )
+        return;
+
+    _filterIndex.clear();
+
     for ( unsigned i = 0; i < Lines(); ++i )
+        _filterIndex.addLine( _items[ i ] );
+
+    _filterIndexValid = true;
+}
+
+
+bool NCTablePadBase::refilter()
+{
+    NCTableLine * currentLine = GetCurrentLine();
+    int oldLineNo = currentLineNo();
+
+    vector<NCTableLine *> oldVisibleItems;
+    oldVisibleItems.swap( _visibleItems );
+    updateVisibleItems();
+
+    if ( _visibleItems == oldVisibleItems )
+        return false;
+
+    resizeToVisibleItems();
+
+    // Keep the current line if it still matches, otherwise stay at the
+    // same position
+    vector<NCTableLine *>::const_iterator it =
+        std::find( _visibleItems.begin(), _visibleItems.end(), currentLine );
+
+    if ( currentLine && it != _visibleItems.end() )
+        oldLineNo = it - _visibleItems.begin();
+
+    dirty = true;
+    setpos( wpos( oldLineNo, srect.Pos.C ) );
+
+    return true;
+}
+
+
+void NCTablePadBase::setFilter( const wstring & filter )
+{
+    if ( filter == _filter )
+        return;
+
+    _filter = filter;
+
+    if ( _dirtyFormat )
+    {
+        UpdateFormat();
+    }
+    else
     {
-	if ( _items[ i ]->isVisible() )
-	    _visibleItems.push_back( _items[ i ] );
+        // The line formats did not change, so there is no need to go
+        // through all lines in UpdateFormat().
+        updateVisibleItems();
+        resizeToVisibleItems();
     }
+
+    setCurrentLineNo( 0 );
+    srect.Pos.L = 0;
+    dirty = true;
 }
 
 
 int NCTablePadBase::DoRedraw()
 {
+    NCHeadless::RedrawTimer timer;
+
     // Notice that this is only a fallback implementation of this method.
     // Derived classes usually overwrite this with subtle changes.
     // See NCTreePad::DoRedraw() or NCTablePad::DoRedraw().
@@ -265,23 +446,75 @@ void NCTablePadBase::prepareRedraw()
 
     bkgdset( _itemStyle.getBG() );
     clear();
+    invalidatePages();
+    _drawnLines.assign( paging() ? 0 : visibleLines(), false );
 }
 
 
 void NCTablePadBase::drawContentLines()
 {
-    wsze lineSize( 1, width() );
+    if ( paging() )
+        return; // item drawing requested via directDraw()
 
-    for ( unsigned lineNo = 0; lineNo < visibleLines(); ++lineNo )
+    // Only the lines in the viewport are drawn right away. Drawing all lines
+    // of a table with thousands of items on each redraw is far too
+    // expensive; setpos() draws the others when they are scrolled into the
+    // viewport.
+
+    drawViewportLines();
+}
+
+
+void NCTablePadBase::drawViewportLines()
+{
+    if ( paging() )
+        return;
+
+    if ( _drawnLines.size() != visibleLines() )
+        _drawnLines.assign( visibleLines(), false );
+
+    unsigned first = srect.Pos.L > 0 ? srect.Pos.L : 0;
+    unsigned last  = std::min( first + srect.Sze.H, visibleLines() );
+
+    for ( unsigned lineNo = first; lineNo < last; ++lineNo )
     {
-	_visibleItems[ lineNo ]->DrawAt( *this,
-                                         wrect( wpos( lineNo, 0 ), lineSize ),
-                                         _itemStyle,
-                                         ( lineNo == (unsigned) currentLineNo() ) );
+        if ( ! _drawnLines[ lineNo ] )
+            drawLine( lineNo );
     }
 }
 
 
+void NCTablePadBase::drawLine( NCursesWindow & w, const wrect at, unsigned lineNo )
+{
+    _visibleItems[ lineNo ]->DrawAt( w,
+                                     at,
+                                     _itemStyle,
+                                     ( (unsigned) currentLineNo() == lineNo ) );
+    ++_drawnLinesCount;
+}
+
+
+void NCTablePadBase::drawLine( unsigned lineNo )
+{
+    if ( lineNo >= visibleLines() )
+        return;
+
+    drawLine( *this, wrect( wpos( lineNo, 0 ), wsze( 1, width() ) ), lineNo );
+
+    if ( lineNo < _drawnLines.size() )
+        _drawnLines[ lineNo ] = true;
+}
+
+
+void NCTablePadBase::directDraw( NCursesWindow & w, const wrect at, unsigned lineNo )
+{
+    if ( lineNo < visibleLines() )
+        drawLine( w, at, lineNo );
+    else
+        yuiWarning() << "Illegal Line no " << lineNo << " (" << visibleLines() << ")" << std::endl;
+}
+
+
 void NCTablePadBase::drawHeader()
 {
     wsze lineSize( 1, width() );
@@ -311,6 +544,18 @@ int NCTablePadBase::setpos( const wpos & newpos )
     if ( _dirtyFormat )
 	UpdateFormat();
 
+    if ( !visibleLines() )
+    {
+	// The filter matches no line: There is no current line to draw
+	setCurrentLineNo( -1 );
+	srect.Pos = wpos( 0, newpos.C ).between( 0, maxspos );
+
+	if ( dirty )
+	    return DoRedraw();
+
+	return update();
+    }
+
     // Save old values
     int oldLineNo = currentLineNo();
     int oldPos    = srect.Pos.C;
@@ -358,23 +603,21 @@ int NCTablePadBase::setpos( const wpos & newpos )
     {
         // adjust only
 
-    if ( currentLineNo() != oldLineNo )
-    {
-	_visibleItems[ oldLineNo ]->DrawAt( *this,
-                                            wrect( wpos( oldLineNo, 0 ),
-                                                   wsze( 1, width() ) ),
-                                            _itemStyle,
-                                            false );
-    }
+	if ( currentLineNo() != oldLineNo && oldLineNo >= 0 && (unsigned) oldLineNo < visibleLines() )
+	    drawLine( oldLineNo );
 
-    _visibleItems[ currentLineNo() ]->DrawAt( *this,
-                                              wrect( wpos( currentLineNo(), 0 ),
-                                                     wsze( 1, width() ) ),
-                                              _itemStyle,
-                                              true );
+	drawLine( currentLineNo() );
+
+	// Draw the lines that were just scrolled into the viewport
+	drawViewportLines();
+    }
+    else if ( currentLineNo() != oldLineNo )
+    {
+        // Only the cached pages of the old and the new current item need an
+        // update, all others are drawn via directDraw() on demand.
+        redrawPagedLine( oldLineNo );
+        redrawPagedLine( currentLineNo() );
     }
-    // else
-    //   item drawing requested via directDraw()
 
     if ( srect.Pos.C != oldPos )
 	SendHead();
@@ -441,6 +684,62 @@ bool NCTablePadBase::currentItemHandleInput( wint_t key )
 }
 
 
+bool NCTablePadBase::handleFilterInput( wint_t key )
+{
+    if ( !_editingFilter )
+    {
+        if ( key != '/' )
+            return false;
+
+        _editingFilter = true;
+
+        return true;
+    }
+
+    wstring newFilter = _filter;
+
+    switch ( key )
+    {
+        case KEY_BACKSPACE:
+
+            if ( newFilter.empty() )
+                _editingFilter = false;
+            else
+                newFilter.erase( newFilter.size() - 1 );
+
+            break;
+
+        case KEY_RETURN:
+            _editingFilter = false;
+            break;
+
+        default:
+            {
+                // Wide characters that collide with curses KEY_... codes are
+                // marked by NCDialog::getinput() (see NCInputField).
+                bool isChar = false;
+
+                if ( key > 0xFFFF )
+                {
+                    isChar = true;
+                    key -= 0xFFFF;
+                }
+
+                // Let the pad handle cursor keys etc. while editing the filter
+                if ( ( !isChar && KEY_MIN < key && KEY_MAX > key ) || !iswprint( key ) )
+                    return false;
+
+                newFilter += (wchar_t) key;
+            }
+            break;
+    }
+
+    setFilter( newFilter );
+
+    return true;
+}
+
+
 NCTableLine * NCTablePadBase::GetCurrentLine() const
 {
     if ( currentLineNo() >= 0 && (unsigned) currentLineNo() < visibleLines() )
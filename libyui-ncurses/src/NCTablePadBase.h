@@ -26,9 +26,12 @@
 #ifndef NCTablePadBase_h
 #define NCTablePadBase_h
 
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include "NCPad.h"
 #include "NCTableItem.h"
+#include "NCTableFilterIndex.h"
 
 class NCTableCol;
 
@@ -162,6 +165,16 @@ public:
      **/
     NCTableLine * ModifyLine( unsigned idx );
 
+    /**
+     * Notification that the content of 'lines' changed. Unlike after
+     * ModifyLine(), only these lines are redrawn and the table format is
+     * not recalculated from all lines, unless 'widthChanged' is set.
+     * Lines that are not drawn yet get the new content when they are
+     * scrolled into the viewport.
+     **/
+    void linesChanged( const std::unordered_set<const NCTableLine *> & lines,
+                       bool widthChanged = false );
+
     /**
      * Find the item with index 'idx' in the items and return its position.
      * Return -1 if not found.
@@ -174,6 +187,37 @@ public:
      **/
     NCTableLine * GetCurrentLine() const;
 
+    /**
+     * Set a filter string: Only lines that contain it in any of their cells
+     * (ignoring case) remain visible, plus the parents of those lines if
+     * items are nested. An empty filter shows all lines again.
+     *
+     * This only updates the visible items; the caller is responsible for
+     * redrawing the pad.
+     **/
+    void setFilter( const std::wstring & filter );
+
+    /**
+     * Return the current filter string.
+     **/
+    const std::wstring & filter() const { return _filter; }
+
+    /**
+     * Return 'true' if the user is currently typing a filter string,
+     * i.e. all printable keys go to the filter.
+     **/
+    bool editingFilter() const { return _editingFilter; }
+
+    /**
+     * Handle interactive filter editing: '/' starts it, printable keys are
+     * added to the filter, Backspace removes the last character (or ends
+     * editing if the filter is empty), Return ends editing and keeps the
+     * filter. Return 'true' if the key was consumed.
+     *
+     * Widgets that support filtering call this before handleInput().
+     **/
+    bool handleFilterInput( wint_t key );
+
     /**
      * Handle a keyboard input event. Return 'true' if the event is now
      * handled, 'false' if it should be propagated to the parent widget.
@@ -186,6 +230,12 @@ public:
      **/
     virtual bool handleInput( wint_t key );
 
+    /**
+     * Return the number of content lines drawn so far. This is meant for
+     * debugging and benchmarking the redraw logic.
+     **/
+    unsigned long drawnLinesCount() const { return _drawnLinesCount; }
+
 
 private:
 
@@ -210,6 +260,24 @@ protected:
      **/
     virtual bool currentItemHandleInput( wint_t key );
 
+    /**
+     * Make sure the filter index contains all lines.
+     **/
+    void ensureFilterIndex();
+
+    /**
+     * Apply the active filter again after line contents changed and
+     * redraw everything if that shows or hides any lines. Return 'true'
+     * in that case, 'false' if the visible lines are still the same.
+     **/
+    bool refilter();
+
+    /**
+     * Update the scrolling limits and the pad size after the visible items
+     * changed. Return the new pad size.
+     **/
+    wsze resizeToVisibleItems();
+
     /**
      * Update the internal _visibleItems vector with the items that are
      * currently visible: Clear the old contents of the vector, iterate over
@@ -221,6 +289,22 @@ protected:
 
     void setFormatDirty() { dirty = _dirtyFormat = true; }
 
+    /**
+     * Table and tree pads can always draw any visible line on demand, so
+     * they page as soon as they get too high.
+     *
+     * Reimplemented from NCPad.
+     **/
+    virtual bool pageable() const { return true; }
+
+    /**
+     * Draw the visible line 'lineNo' at 'at' in window 'w'. This is used
+     * to fill the pages of the pad while paging.
+     *
+     * Reimplemented from NCPad.
+     **/
+    virtual void directDraw( NCursesWindow & w, const wrect at, unsigned lineNo );
+
     virtual int dirtyPad() { return setpos( CurPos() ); }
 
     /**
@@ -237,10 +321,29 @@ protected:
     virtual void prepareRedraw();
 
     /**
-     * Redraw the (visible) content lines one by one.
+     * Redraw the content lines in the viewport one by one. All other lines
+     * are only drawn when they are scrolled into the viewport.
+     * While paging, this is left to directDraw().
      **/
     virtual void drawContentLines();
 
+    /**
+     * Draw the visible line 'lineNo' at 'at' in window 'w', highlighted if
+     * it is the current line.
+     **/
+    void drawLine( NCursesWindow & w, const wrect at, unsigned lineNo );
+
+    /**
+     * Draw the visible line 'lineNo' into the pad.
+     **/
+    void drawLine( unsigned lineNo );
+
+    /**
+     * Draw the lines in the viewport that were not drawn since the last
+     * redraw (if not paging).
+     **/
+    void drawViewportLines();
+
     /**
      * Redraw the table header.
      **/
@@ -293,6 +396,12 @@ protected:
     bool	              _dirtyFormat;  ///< does table format (size) need recalculating?
     NCTableStyle	      _itemStyle;
     wpos		      _citem;        ///< current/cursor position
+    std::wstring              _filter;
+    bool                      _editingFilter;
+    NCTableFilterIndex        _filterIndex;  ///< only used while filtering
+    bool                      _filterIndexValid;
+    std::vector<bool>         _drawnLines;   ///< by visible line; not used while paging
+    unsigned long             _drawnLinesCount;
 };
 
 
@@ -44,6 +44,7 @@ NCTree::NCTree( YWidget *      parent,
     , NCPadWidget( parent )
     , _multiSelect( multiselection )
     , _nextItemIndex( 0 )
+    , _filterInput( false )
 {
     // yuiDebug() << endl;
 
@@ -230,13 +231,62 @@ void NCTree::rebuildTree()
 NCPad * NCTree::CreatePad()
 {
     wsze    psze( defPadSze() );
-    NCPad * npad = new NCTreePad( psze.H, psze.W, *this );
+    NCTreePad * npad = new NCTreePad( psze.H, psze.W, *this );
     npad->bkgd( listStyle().item.plain );
+    npad->setFilter( NCstring( filter() ).str() );
 
     return npad;
 }
 
 
+void NCTree::setFilter( const string & filter )
+{
+    YTree::setFilter( filter );
+    _filterInput = true;
+
+    if ( myPad() )
+    {
+        myPad()->setFilter( NCstring( filter ).str() );
+        updateFilterHint();
+        DrawPad();
+    }
+}
+
+
+bool NCTree::handleFilterInput( wint_t key, NCursesEvent & event )
+{
+    if ( ! _filterInput )
+        return false;
+
+    std::wstring oldFilter = myPad()->filter();
+
+    if ( ! myPad()->handleFilterInput( key ) )
+        return false;
+
+    updateFilterHint();
+    DrawPad();
+
+    if ( myPad()->filter() != oldFilter )
+    {
+        YTree::setFilter( NCstring( myPad()->filter() ).Str() );
+
+        if ( notify() )
+            event = NCursesEvent::FilterChanged;
+    }
+
+    return true;
+}
+
+
+void NCTree::updateFilterHint()
+{
+    if ( myPad()->editingFilter() || ! myPad()->filter().empty() )
+        setFrameHint( NCstring( L"/" + myPad()->filter() ) );
+    else
+        setFrameHint( NCstring( "" ) );
+}
+
+
 void NCTree::CreateTreeLines( NCTreeLine * parentLine,
                               NCTreePad  * pad,
                               YItem      * item )
@@ -334,6 +384,12 @@ NCursesEvent NCTree::wHandleInput( wint_t key )
     // - NCTreeLine::handleInput()
     // - NCTableLine::handleInput()
 
+    // While the user is typing a filter string, all printable keys go to
+    // the filter.
+
+    if ( handleFilterInput( key, ret ) )
+        return ret;
+
     bool handled = handleInput( key ); // NCTreePad::handleInput()
 
     const YItem * currentItem = getCurrentItem();
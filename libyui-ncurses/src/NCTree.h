@@ -162,6 +162,18 @@ public:
      **/
     virtual NCursesEvent wHandleInput( wint_t key );
 
+    /**
+     * Set a filter string: Only items that contain it are displayed.
+     *
+     * This also enables interactive filtering: From then on, the user can
+     * type a filter string after pressing '/'. Applications that want this
+     * without an initial filter can set an empty filter. Until then, '/'
+     * is handled like any other key.
+     *
+     * Reimplemented from YTree.
+     **/
+    virtual void setFilter( const std::string & filter );
+
 
 protected:
 
@@ -177,6 +189,18 @@ protected:
      **/
     virtual NCPad * CreatePad();
 
+    /**
+     * Let the pad handle interactive filter editing if it is enabled (see
+     * setFilter()). Return 'true' if 'key' was consumed; 'event' is set to
+     * the event to return in that case.
+     **/
+    bool handleFilterInput( wint_t key, NCursesEvent & event );
+
+    /**
+     * Show the current filter (if any) in the frame.
+     **/
+    void updateFilterHint();
+
     /**
      * Return the TreePad that belongs to this widget.
      *
@@ -243,6 +267,7 @@ private:
 
     bool _multiSelect;
     int  _nextItemIndex; // Only used in CreateTreeLines()
+    bool _filterInput;   // '/' starts filter editing
 };
 
 
@@ -27,6 +27,7 @@
 #define  YUILogComponent "ncurses"
 #include <yui/YUILog.h>
 #include "NCTreePad.h"
+#include "NCHeadless.h"
 
 
 
@@ -73,6 +74,8 @@ void NCTreePad::ShowItem( const NCTableLine * item )
 
 int NCTreePad::DoRedraw()
 {
+    NCHeadless::RedrawTimer timer;
+
     if ( !NCPad::Destwin() )
     {
 	dirty = true;
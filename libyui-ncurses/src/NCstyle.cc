@@ -42,6 +42,8 @@
 int NCattribute::_colors = ::COLORS;
 int NCattribute::_pairs = ::COLOR_PAIRS;
 
+unsigned long NCstyle::_generation = 0;
+
 
 
 unsigned NCstyle::Style::sanitycheck()
@@ -145,6 +147,13 @@ NCstyle::Style::Style()
 
 
 
+NCstyle::Style::Style( const chtype * attrs )
+	: NCattrset( attrs, MaxSTlocal )
+	, StDialog( initDialog() )
+{}
+
+
+
 NCstyle::Style::Style( const Style & rhs )
 	: NCattrset( rhs )
 	, StDialog( initDialog() )
@@ -280,7 +289,7 @@ std::string NCstyle::dumpName( NCstyle::STlocal a )
 NCstyle::NCstyle( std::string term_t )
     : styleName( "linux" )
     , term( term_t )
-    , styleSet( MaxStyleSet )
+    , styleSet( 0 )
     , fakestyle_e( MaxStyleSet )
 {
     char *user_defined_style = getenv( "Y2NCURSES_COLOR_THEME" );
@@ -315,15 +324,8 @@ NCstyle::NCstyle( std::string term_t )
     yuiMilestone() << "Init " << term_t << " using " << ( NCattribute::colors() ? "color" : "bw" )
 		   << " => " << MaxStyleSet << " styles in " << styleName << std::endl;
 
-#define IF_STYLE_INIT(n) if ( styleName == #n ) { NCstyleInit_##n( styleSet ); }
-    IF_STYLE_INIT( linux )
-	else IF_STYLE_INIT( xterm )
-            else IF_STYLE_INIT( rxvt )
-                else IF_STYLE_INIT( mono )
-                    else IF_STYLE_INIT( braille )
-                        else IF_STYLE_INIT( highcontrast )
-                            else IF_STYLE_INIT( inverted )
-                                else NCstyleInit_linux( styleSet );
+    const Theme * theme = findTheme( styleName );
+    setTheme( theme ? *theme : NCstyleTheme_linux );
 }
 
 
@@ -334,6 +336,54 @@ NCstyle::~NCstyle()
 
 
 
+const NCstyle::Theme * NCstyle::findTheme( const std::string & name )
+{
+    static const Theme * const themes[] =
+    {
+	&NCstyleTheme_linux,
+	&NCstyleTheme_xterm,
+	&NCstyleTheme_rxvt,
+	&NCstyleTheme_mono,
+	&NCstyleTheme_braille,
+	&NCstyleTheme_highcontrast,
+	&NCstyleTheme_inverted
+    };
+
+    for ( const Theme * theme : themes )
+    {
+	if ( name == theme->name )
+	    return theme;
+    }
+
+    return 0;
+}
+
+
+
+void NCstyle::setTheme( const Theme & theme )
+{
+    std::vector<Style> & styles( themeStyles[ &theme ] );
+
+    if ( styles.empty() )
+    {
+	// The Styles reference their own attributes, so the vector must not
+	// reallocate after they are created.
+	styles.reserve( MaxStyleSet );
+
+	for ( unsigned sts = 0; sts < MaxStyleSet; ++sts )
+	    styles.emplace_back( theme.local[sts] );
+    }
+
+    for ( unsigned a = 0; a < MaxSTglobal; ++a )
+	Style::attrGlobal.setAttr( a, theme.global[a] );
+
+    styleName = theme.name;
+    styleSet  = &styles;
+    attrChanged();
+}
+
+
+
 void NCstyle::nextStyle()
 {
     if ( !NCattribute::colors() ) return;
@@ -341,30 +391,19 @@ void NCstyle::nextStyle()
     if ( styleName == "mono" )
     {
 	if ( term == "xterm" )
-	{
-	    styleName = "xterm";
-	    NCstyleInit_xterm( styleSet );
-	}
+	    setTheme( NCstyleTheme_xterm );
 	else if ( term == "rxvt" )
-	{
-	    styleName = "rxvt";
-	    NCstyleInit_rxvt( styleSet );
-	}
+	    setTheme( NCstyleTheme_rxvt );
 	else
-	{
-	    styleName = "linux";
-	    NCstyleInit_linux( styleSet );
-	}
+	    setTheme( NCstyleTheme_linux );
     }
     else if ( styleName == "braille" )
     {
-	styleName = "mono";
-	NCstyleInit_mono( styleSet );
+	setTheme( NCstyleTheme_mono );
     }
     else
     {
-	styleName = "braille";
-	NCstyleInit_braille( styleSet );
+	setTheme( NCstyleTheme_braille );
     }
 }
 
@@ -380,5 +419,6 @@ void NCstyle::changeSyle()
 void NCstyle::fakestyle( StyleSet f )
 {
     fakestyle_e = f;
+    attrChanged();
     NCurses::Redraw();
 }
@@ -28,6 +28,7 @@
 #include <ncursesw/ncurses.h>
 
 #include <iosfwd>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -182,6 +183,8 @@ public:
 
     NCattrset( unsigned num ) : attr( num, A_NORMAL ) {}
 
+    NCattrset( const chtype * attrs, unsigned num ) : attr( attrs, attrs + num ) {}
+
     virtual ~NCattrset() {}
 
 public:
@@ -546,6 +549,7 @@ public:
     public:
 
 	Style();
+	Style( const chtype * attrs ); ///< MaxSTlocal attributes
 	Style( const Style & rhs );
 	virtual ~Style();
 
@@ -572,15 +576,45 @@ public:
 	MaxStyleSet
     };
 
+    /**
+     * The attributes of a built-in theme. The themes are constant tables
+     * (see NCstyle.*.h) which are compiled in, so nothing needs to be
+     * computed at startup.
+     **/
+    struct Theme
+    {
+	const char * name;
+	chtype	     global[MaxSTglobal];
+	chtype	     local[MaxStyleSet][MaxSTlocal];
+    };
+
 private:
 
     std::string		styleName;
     std::string		term;
-    std::vector<Style>	styleSet;
+
+    /// The style sets of each theme used so far, created from its Theme table
+    std::map<const Theme *, std::vector<Style> > themeStyles;
+
+    /// The style sets of the current theme (not owned)
+    std::vector<Style> * styleSet;
 
     StyleSet fakestyle_e;
     void     fakestyle( StyleSet f );
-    Style &  getStyle( StyleSet a ) { return styleSet[a]; }
+    Style &  getStyle( StyleSet a ) { return (*styleSet)[a]; }
+
+    static unsigned long _generation;
+
+    /**
+     * Switch to a built-in theme. The style sets of a theme are created only
+     * once, so switching between themes is just exchanging a pointer.
+     **/
+    void setTheme( const Theme & theme );
+
+    /**
+     * Return the built-in theme 'name' or 0 if there is none.
+     **/
+    static const Theme * findTheme( const std::string & name );
 
 public:
 
@@ -592,14 +626,27 @@ public:
     const Style &  operator[]( StyleSet a ) const
     {
 	if ( fakestyle_e != MaxStyleSet )
-	    return styleSet[fakestyle_e];
+	    return (*styleSet)[fakestyle_e];
 
-	return styleSet[a];
+	return (*styleSet)[a];
     }
 
     void changeSyle();
     void nextStyle();
 
+    /**
+     * Notify that attributes were changed, so everything that caches them
+     * has to fetch them again.
+     **/
+    static void attrChanged() { ++_generation; }
+
+    /**
+     * Return a number that changes whenever any attribute changes, e.g.
+     * when switching to another theme. Caches of attributes compare this
+     * to find out if they are still valid.
+     **/
+    static unsigned long generation() { return _generation; }
+
     static std::string dumpName( StyleSet a );
     static std::string dumpName( STglobal a );
     static std::string dumpName( STlocal a );
@@ -27,269 +27,276 @@
 
 #include "NCstyle.h"
 
-inline void NCstyleInit_mono( std::vector<NCstyle::Style> & styleSet )
+constexpr NCstyle::Theme NCstyleTheme_mono =
 {
+    "mono",
     //=================================================================
-    // init global attributes
+    // global attributes
     //=================================================================
-    NCattrset * attrset( &styleSet[NCstyle::DefaultStyle].getAttrGlobal() );
-    attrset->setAttr( NCstyle::AppTitle, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::AppText, 0 );
+    {
+	/* AppTitle */ 0|A_BOLD,
+	/* AppText */ 0,
+    },
     //=================================================================
-    // init local attributes
+    // local attributes
     //=================================================================
-    // DefaultStyle
-    attrset = &styleSet[NCstyle::DefaultStyle].getAttrLocal();
-    attrset->setAttr( NCstyle::DialogBorder, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveBorder, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogText, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogHeadline, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogDisabled, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActivePlain, 0 );
-    attrset->setAttr( NCstyle::DialogActiveLabel, 0 );
-    attrset->setAttr( NCstyle::DialogActiveData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveScrl, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFramePlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameHint, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFramePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameScrl, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListSelHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveTitle, 0 );
-    attrset->setAttr( NCstyle::ListActivePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelPlain, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelLabel, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextLink, 0 );
-    attrset->setAttr( NCstyle::RichTextArmedlink, 0 );
-    attrset->setAttr( NCstyle::RichTextActiveArmedlink, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextVisitedLink, 0 );
-    attrset->setAttr( NCstyle::RichTextB, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ProgbarCh, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ProgbarBgch, 4194481 );
-    attrset->setAttr( NCstyle::TextCursor, 0 | A_REVERSE | A_BOLD );
-    // InfoStyle
-    attrset = &styleSet[NCstyle::InfoStyle].getAttrLocal();
-    attrset->setAttr( NCstyle::DialogBorder, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveBorder, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogText, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogHeadline, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogDisabled, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogHint, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActivePlain, 0 );
-    attrset->setAttr( NCstyle::DialogActiveLabel, 0 );
-    attrset->setAttr( NCstyle::DialogActiveData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveScrl, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFramePlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameHint, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFramePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameScrl, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListSelHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveTitle, 0 );
-    attrset->setAttr( NCstyle::ListActivePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelPlain, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelLabel, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextLink, 0 );
-    attrset->setAttr( NCstyle::RichTextArmedlink, 0 );
-    attrset->setAttr( NCstyle::RichTextActiveArmedlink, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextVisitedLink, 0 );
-    attrset->setAttr( NCstyle::RichTextB, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ProgbarCh, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ProgbarBgch, 4194481 );
-    attrset->setAttr( NCstyle::TextCursor, 0 | A_REVERSE | A_BOLD );
-    // WarnStyle
-    attrset = &styleSet[NCstyle::WarnStyle].getAttrLocal();
-    attrset->setAttr( NCstyle::DialogBorder, 0 );
-    attrset->setAttr( NCstyle::DialogTitle, 0 );
-    attrset->setAttr( NCstyle::DialogActiveBorder, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveTitle, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogText, 0 );
-    attrset->setAttr( NCstyle::DialogHeadline, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogDisabled, 0 );
-    attrset->setAttr( NCstyle::DialogPlain, 0 );
-    attrset->setAttr( NCstyle::DialogLabel, 0 );
-    attrset->setAttr( NCstyle::DialogData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogScrl, 0 );
-    attrset->setAttr( NCstyle::DialogActivePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFramePlain, 0 );
-    attrset->setAttr( NCstyle::DialogFrameLabel, 0 );
-    attrset->setAttr( NCstyle::DialogFrameData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameScrl, 0 );
-    attrset->setAttr( NCstyle::DialogActiveFramePlain, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameLabel, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameData, 0 );
-    attrset->setAttr( NCstyle::DialogActiveFrameHint, 0 );
-    attrset->setAttr( NCstyle::DialogActiveFrameScrl, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListTitle, 0 );
-    attrset->setAttr( NCstyle::ListPlain, 0 );
-    attrset->setAttr( NCstyle::ListLabel, 0 );
-    attrset->setAttr( NCstyle::ListData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListHint, 0 );
-    attrset->setAttr( NCstyle::ListSelPlain, 0 );
-    attrset->setAttr( NCstyle::ListSelLabel, 0 );
-    attrset->setAttr( NCstyle::ListSelData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelHint, 0 );
-    attrset->setAttr( NCstyle::ListActiveTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActivePlain, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveLabel, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveData, 0 );
-    attrset->setAttr( NCstyle::ListActiveHint, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelPlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveSelLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveSelData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextLink, 0 );
-    attrset->setAttr( NCstyle::RichTextArmedlink, 0 );
-    attrset->setAttr( NCstyle::RichTextActiveArmedlink, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextVisitedLink, 0 );
-    attrset->setAttr( NCstyle::RichTextB, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ProgbarCh, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ProgbarBgch, 4194481 );
-    attrset->setAttr( NCstyle::TextCursor, 0 | A_REVERSE | A_BOLD );
-    // PopupStyle
-    attrset = &styleSet[NCstyle::PopupStyle].getAttrLocal();
-    attrset->setAttr( NCstyle::DialogBorder, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveBorder, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogText, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogHeadline, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogDisabled, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogHint, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActivePlain, 0 );
-    attrset->setAttr( NCstyle::DialogActiveLabel, 0 );
-    attrset->setAttr( NCstyle::DialogActiveData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveScrl, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFramePlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogFrameData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameHint, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogFrameScrl, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFramePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::DialogActiveFrameData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::DialogActiveFrameScrl, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListTitle, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelLabel, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListSelData, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListSelHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveTitle, 0 );
-    attrset->setAttr( NCstyle::ListActivePlain, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveLabel, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ListActiveData, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveHint, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelPlain, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelLabel, 0 );
-    attrset->setAttr( NCstyle::ListActiveSelData, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ListActiveSelHint, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextPlain, 0 | A_REVERSE | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextTitle, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextLink, 0 );
-    attrset->setAttr( NCstyle::RichTextArmedlink, 0 );
-    attrset->setAttr( NCstyle::RichTextActiveArmedlink, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::RichTextVisitedLink, 0 );
-    attrset->setAttr( NCstyle::RichTextB, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBI, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::RichTextBIT, 0 | A_REVERSE );
-    attrset->setAttr( NCstyle::ProgbarCh, 0 | A_BOLD );
-    attrset->setAttr( NCstyle::ProgbarBgch, 4194481 );
-    attrset->setAttr( NCstyle::TextCursor, 0 | A_REVERSE | A_BOLD );
-}
-
+    {
+	// DefaultStyle
+	{
+	    /* DialogBorder */ 0|A_REVERSE|A_BOLD,
+	    /* DialogTitle */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveBorder */ 0|A_REVERSE,
+	    /* DialogActiveTitle */ 0|A_REVERSE,
+	    /* DialogText */ 0|A_REVERSE|A_BOLD,
+	    /* DialogHeadline */ 0|A_REVERSE,
+	    /* DialogDisabled */ 0|A_REVERSE|A_BOLD,
+	    /* DialogPlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogData */ 0|A_REVERSE,
+	    /* DialogHint */ 0|A_REVERSE|A_BOLD,
+	    /* DialogScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActivePlain */ 0,
+	    /* DialogActiveLabel */ 0,
+	    /* DialogActiveData */ 0|A_BOLD,
+	    /* DialogActiveHint */ 0|A_BOLD,
+	    /* DialogActiveScrl */ 0|A_BOLD,
+	    /* DialogFramePlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameData */ 0|A_REVERSE,
+	    /* DialogFrameHint */ 0|A_REVERSE,
+	    /* DialogFrameScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFramePlain */ 0|A_REVERSE,
+	    /* DialogActiveFrameLabel */ 0|A_REVERSE,
+	    /* DialogActiveFrameData */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameHint */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameScrl */ 0|A_REVERSE,
+	    /* ListTitle */ 0|A_REVERSE|A_BOLD,
+	    /* ListPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListData */ 0|A_REVERSE,
+	    /* ListHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelData */ 0|A_REVERSE,
+	    /* ListSelHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveTitle */ 0,
+	    /* ListActivePlain */ 0|A_REVERSE,
+	    /* ListActiveLabel */ 0|A_REVERSE,
+	    /* ListActiveData */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveSelPlain */ 0,
+	    /* ListActiveSelLabel */ 0,
+	    /* ListActiveSelData */ 0|A_BOLD,
+	    /* ListActiveSelHint */ 0|A_BOLD,
+	    /* RichTextPlain */ 0|A_REVERSE|A_BOLD,
+	    /* RichTextTitle */ 0|A_REVERSE,
+	    /* RichTextLink */ 0,
+	    /* RichTextArmedlink */ 0,
+	    /* RichTextActiveArmedlink */ 0|A_BOLD,
+	    /* RichTextVisitedLink */ 0,
+	    /* RichTextB */ 0|A_REVERSE,
+	    /* RichTextI */ 0|A_REVERSE,
+	    /* RichTextT */ 0|A_REVERSE,
+	    /* RichTextBI */ 0|A_REVERSE,
+	    /* RichTextBT */ 0|A_REVERSE,
+	    /* RichTextIT */ 0|A_REVERSE,
+	    /* RichTextBIT */ 0|A_REVERSE,
+	    /* ProgbarCh */ 0|A_BOLD,
+	    /* ProgbarBgch */ 4194481,
+	    /* TextCursor */ 0|A_REVERSE|A_BOLD,
+	},
+	// InfoStyle
+	{
+	    /* DialogBorder */ 0|A_REVERSE|A_BOLD,
+	    /* DialogTitle */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveBorder */ 0|A_REVERSE,
+	    /* DialogActiveTitle */ 0|A_REVERSE,
+	    /* DialogText */ 0|A_REVERSE|A_BOLD,
+	    /* DialogHeadline */ 0|A_REVERSE,
+	    /* DialogDisabled */ 0|A_REVERSE|A_BOLD,
+	    /* DialogPlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogData */ 0|A_REVERSE,
+	    /* DialogHint */ 0|A_REVERSE,
+	    /* DialogScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActivePlain */ 0,
+	    /* DialogActiveLabel */ 0,
+	    /* DialogActiveData */ 0|A_BOLD,
+	    /* DialogActiveHint */ 0|A_BOLD,
+	    /* DialogActiveScrl */ 0|A_BOLD,
+	    /* DialogFramePlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameData */ 0|A_REVERSE,
+	    /* DialogFrameHint */ 0|A_REVERSE,
+	    /* DialogFrameScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFramePlain */ 0|A_REVERSE,
+	    /* DialogActiveFrameLabel */ 0|A_REVERSE,
+	    /* DialogActiveFrameData */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameHint */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameScrl */ 0|A_REVERSE,
+	    /* ListTitle */ 0|A_REVERSE|A_BOLD,
+	    /* ListPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListData */ 0|A_REVERSE,
+	    /* ListHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelData */ 0|A_REVERSE,
+	    /* ListSelHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveTitle */ 0,
+	    /* ListActivePlain */ 0|A_REVERSE,
+	    /* ListActiveLabel */ 0|A_REVERSE,
+	    /* ListActiveData */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveSelPlain */ 0,
+	    /* ListActiveSelLabel */ 0,
+	    /* ListActiveSelData */ 0|A_BOLD,
+	    /* ListActiveSelHint */ 0|A_BOLD,
+	    /* RichTextPlain */ 0|A_REVERSE|A_BOLD,
+	    /* RichTextTitle */ 0|A_REVERSE,
+	    /* RichTextLink */ 0,
+	    /* RichTextArmedlink */ 0,
+	    /* RichTextActiveArmedlink */ 0|A_BOLD,
+	    /* RichTextVisitedLink */ 0,
+	    /* RichTextB */ 0|A_REVERSE,
+	    /* RichTextI */ 0|A_REVERSE,
+	    /* RichTextT */ 0|A_REVERSE,
+	    /* RichTextBI */ 0|A_REVERSE,
+	    /* RichTextBT */ 0|A_REVERSE,
+	    /* RichTextIT */ 0|A_REVERSE,
+	    /* RichTextBIT */ 0|A_REVERSE,
+	    /* ProgbarCh */ 0|A_BOLD,
+	    /* ProgbarBgch */ 4194481,
+	    /* TextCursor */ 0|A_REVERSE|A_BOLD,
+	},
+	// WarnStyle
+	{
+	    /* DialogBorder */ 0,
+	    /* DialogTitle */ 0,
+	    /* DialogActiveBorder */ 0|A_BOLD,
+	    /* DialogActiveTitle */ 0|A_BOLD,
+	    /* DialogText */ 0,
+	    /* DialogHeadline */ 0|A_BOLD,
+	    /* DialogDisabled */ 0,
+	    /* DialogPlain */ 0,
+	    /* DialogLabel */ 0,
+	    /* DialogData */ 0|A_BOLD,
+	    /* DialogHint */ 0|A_BOLD,
+	    /* DialogScrl */ 0,
+	    /* DialogActivePlain */ 0|A_REVERSE,
+	    /* DialogActiveLabel */ 0|A_REVERSE,
+	    /* DialogActiveData */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveHint */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFramePlain */ 0,
+	    /* DialogFrameLabel */ 0,
+	    /* DialogFrameData */ 0|A_BOLD,
+	    /* DialogFrameHint */ 0|A_BOLD,
+	    /* DialogFrameScrl */ 0,
+	    /* DialogActiveFramePlain */ 0|A_BOLD,
+	    /* DialogActiveFrameLabel */ 0|A_BOLD,
+	    /* DialogActiveFrameData */ 0,
+	    /* DialogActiveFrameHint */ 0,
+	    /* DialogActiveFrameScrl */ 0|A_BOLD,
+	    /* ListTitle */ 0,
+	    /* ListPlain */ 0,
+	    /* ListLabel */ 0,
+	    /* ListData */ 0|A_BOLD,
+	    /* ListHint */ 0,
+	    /* ListSelPlain */ 0,
+	    /* ListSelLabel */ 0,
+	    /* ListSelData */ 0|A_BOLD,
+	    /* ListSelHint */ 0,
+	    /* ListActiveTitle */ 0|A_REVERSE,
+	    /* ListActivePlain */ 0|A_BOLD,
+	    /* ListActiveLabel */ 0|A_BOLD,
+	    /* ListActiveData */ 0,
+	    /* ListActiveHint */ 0,
+	    /* ListActiveSelPlain */ 0|A_REVERSE,
+	    /* ListActiveSelLabel */ 0|A_REVERSE,
+	    /* ListActiveSelData */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveSelHint */ 0|A_REVERSE|A_BOLD,
+	    /* RichTextPlain */ 0|A_REVERSE|A_BOLD,
+	    /* RichTextTitle */ 0|A_REVERSE,
+	    /* RichTextLink */ 0,
+	    /* RichTextArmedlink */ 0,
+	    /* RichTextActiveArmedlink */ 0|A_BOLD,
+	    /* RichTextVisitedLink */ 0,
+	    /* RichTextB */ 0|A_REVERSE,
+	    /* RichTextI */ 0|A_REVERSE,
+	    /* RichTextT */ 0|A_REVERSE,
+	    /* RichTextBI */ 0|A_REVERSE,
+	    /* RichTextBT */ 0|A_REVERSE,
+	    /* RichTextIT */ 0|A_REVERSE,
+	    /* RichTextBIT */ 0|A_REVERSE,
+	    /* ProgbarCh */ 0|A_BOLD,
+	    /* ProgbarBgch */ 4194481,
+	    /* TextCursor */ 0|A_REVERSE|A_BOLD,
+	},
+	// PopupStyle
+	{
+	    /* DialogBorder */ 0|A_REVERSE|A_BOLD,
+	    /* DialogTitle */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveBorder */ 0|A_REVERSE,
+	    /* DialogActiveTitle */ 0|A_REVERSE,
+	    /* DialogText */ 0|A_REVERSE|A_BOLD,
+	    /* DialogHeadline */ 0|A_REVERSE,
+	    /* DialogDisabled */ 0|A_REVERSE|A_BOLD,
+	    /* DialogPlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogData */ 0|A_REVERSE,
+	    /* DialogHint */ 0|A_REVERSE,
+	    /* DialogScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActivePlain */ 0,
+	    /* DialogActiveLabel */ 0,
+	    /* DialogActiveData */ 0|A_BOLD,
+	    /* DialogActiveHint */ 0|A_BOLD,
+	    /* DialogActiveScrl */ 0|A_BOLD,
+	    /* DialogFramePlain */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameLabel */ 0|A_REVERSE|A_BOLD,
+	    /* DialogFrameData */ 0|A_REVERSE,
+	    /* DialogFrameHint */ 0|A_REVERSE,
+	    /* DialogFrameScrl */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFramePlain */ 0|A_REVERSE,
+	    /* DialogActiveFrameLabel */ 0|A_REVERSE,
+	    /* DialogActiveFrameData */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameHint */ 0|A_REVERSE|A_BOLD,
+	    /* DialogActiveFrameScrl */ 0|A_REVERSE,
+	    /* ListTitle */ 0|A_REVERSE|A_BOLD,
+	    /* ListPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListData */ 0|A_REVERSE,
+	    /* ListHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelPlain */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelLabel */ 0|A_REVERSE|A_BOLD,
+	    /* ListSelData */ 0|A_REVERSE,
+	    /* ListSelHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveTitle */ 0,
+	    /* ListActivePlain */ 0|A_REVERSE,
+	    /* ListActiveLabel */ 0|A_REVERSE,
+	    /* ListActiveData */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveHint */ 0|A_REVERSE|A_BOLD,
+	    /* ListActiveSelPlain */ 0,
+	    /* ListActiveSelLabel */ 0,
+	    /* ListActiveSelData */ 0|A_BOLD,
+	    /* ListActiveSelHint */ 0|A_BOLD,
+	    /* RichTextPlain */ 0|A_REVERSE|A_BOLD,
+	    /* RichTextTitle */ 0|A_REVERSE,
+	    /* RichTextLink */ 0,
+	    /* RichTextArmedlink */ 0,
+	    /* RichTextActiveArmedlink */ 0|A_BOLD,
+	    /* RichTextVisitedLink */ 0,
+	    /* RichTextB */ 0|A_REVERSE,
+	    /* RichTextI */ 0|A_REVERSE,
+	    /* RichTextT */ 0|A_REVERSE,
+	    /* RichTextBI */ 0|A_REVERSE,
+	    /* RichTextBT */ 0|A_REVERSE,
+	    /* RichTextIT */ 0|A_REVERSE,
+	    /* RichTextBIT */ 0|A_REVERSE,
+	    /* ProgbarCh */ 0|A_BOLD,
+	    /* ProgbarBgch */ 4194481,
+	    /* TextCursor */ 0|A_REVERSE|A_BOLD,
+	},
+    }
+};
 #endif // NCstyle_mono_h
@@ -32,8 +32,10 @@
 
 #define  YUILogComponent "ncurses"
 #include <yui/YUILog.h>
+#include <yui/YStartupProfiler.h>
 #include "NCurses.h"
 #include "NCDialog.h"
+#include "NCHeadless.h"
 
 #include "stdutil.h"
 #include <signal.h>
@@ -51,6 +53,7 @@ std::set<NCDialog*> NCurses::_knownDlgs;
 const NCursesEvent NCursesEvent::Activated( NCursesEvent::button, YEvent::Activated );
 const NCursesEvent NCursesEvent::SelectionChanged( NCursesEvent::button, YEvent::SelectionChanged );
 const NCursesEvent NCursesEvent::ValueChanged( NCursesEvent::button, YEvent::ValueChanged );
+const NCursesEvent NCursesEvent::FilterChanged( NCursesEvent::button, YEvent::FilterChanged );
 
 
 
@@ -161,6 +164,8 @@ NCurses::~NCurses()
     if ( theTerm )
 	::delscreen( theTerm );
 
+    NCHeadless::destroy();
+
     yuiMilestone() << "NCurses down" << std::endl;
 }
 
@@ -185,6 +190,8 @@ int NCurses::ripinit_bottom( WINDOW * w, int c )
 
 void NCurses::init()
 {
+    YStartupPhase phase( "NCurses::init" );
+
     yuiMilestone() << "Launch NCurses..."
 #ifdef VERSION
     << "(ui-ncurses-" << VERSION << ")"
@@ -205,7 +212,17 @@ void NCurses::init()
 
     yuiMilestone() << "isatty(stdin)" << ( isatty( 0 ) ? "yes" : "no" ) << std::endl;
 
-    if ( isatty( 0 ) )
+    if ( NCHeadless::create() )
+    {
+	theTerm = NCHeadless::instance()->newTerm( envTerm );
+
+	if ( theTerm == NULL )
+	    throw NCursesError( "headless newterm() failed" );
+
+	if ( set_term( theTerm ) == NULL )
+	    throw NCursesError( "set_term() failed" );
+    }
+    else if ( isatty( 0 ) )
     {
 	char * mytty = ttyname( 0 );
 
@@ -418,6 +435,9 @@ void NCurses::Update()
     {
 	//myself->stdpan->refresh();
 	myself->stdpan->redraw();
+
+	if ( NCHeadless::instance() )
+	    NCHeadless::instance()->endFrame();
     }
 }
 
@@ -431,6 +451,10 @@ void NCurses::Refresh()
 	SetStatusLine( myself->status_line );
 	::clearok( ::stdscr, true );
 	myself->stdpan->refresh();
+
+	if ( NCHeadless::instance() )
+	    NCHeadless::instance()->endFrame();
+
 	yuiDebug() << "done refresh ..." << std::endl;
     }
 }
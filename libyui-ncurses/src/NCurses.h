@@ -134,6 +134,7 @@ public:
     static const NCursesEvent Activated;
     static const NCursesEvent SelectionChanged;
     static const NCursesEvent ValueChanged;
+    static const NCursesEvent FilterChanged;
 };
 
 extern std::ostream & operator<<( std::ostream & str, const NCursesEvent & obj );
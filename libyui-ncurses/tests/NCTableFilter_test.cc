@@ -0,0 +1,140 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for filtering NCTable, it runs the UI headless
+// (Y2NCURSES_HEADLESS is set by CMake)
+
+#define BOOST_TEST_MODULE NCTableFilter_tests
+#include <boost/test/unit_test.hpp>
+
+#include <yui/YDialog.h>
+#include <yui/YEvent.h>
+#include <yui/YItem.h>
+#include <yui/YTableHeader.h>
+#include <yui/YTableItem.h>
+#include <yui/YWidgetFactory.h>
+
+#include "NCHeadless.h"
+#include "NCTable.h"
+#include "YNCursesUI.h"
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// a dialog with a table of a few items
+struct TableDialog {
+    TableDialog()
+    {
+        static YUI * ui = createUI( false );
+        BOOST_REQUIRE( ui );
+
+        YWidgetFactory * factory = YUI::widgetFactory();
+
+        dialog = factory->createPopupDialog();
+
+        YTableHeader * header = new YTableHeader();
+        header->addColumn( "Name" );
+
+        table = dynamic_cast<NCTable *>( factory->createTable( dialog, header ) );
+        BOOST_REQUIRE( table );
+
+        foo = new YTableItem( "foo" );
+        bar = new YTableItem( "bar" );
+        baz = new YTableItem( "baz" );
+
+        YItemCollection items;
+        items.push_back( foo );
+        items.push_back( bar );
+        items.push_back( baz );
+        table->addItems( items );
+    }
+
+    ~TableDialog()
+    {
+        dialog->destroy();
+    }
+
+    YDialog * dialog;
+    NCTable * table;
+    YTableItem * foo;
+    YTableItem * bar;
+    YTableItem * baz;
+};
+
+BOOST_FIXTURE_TEST_CASE( empty_filter_result, TableDialog )
+{
+    BOOST_REQUIRE( NCHeadless::instance() );
+
+    table->setFilter( "zzz" );
+    BOOST_CHECK( ! table->getCurrentItemPointer() );
+
+    // moving around in the empty table must not draw a line
+    NCHeadless::instance()->pushKey( KEY_DOWN );
+    NCHeadless::instance()->pushKey( KEY_END );
+    NCHeadless::instance()->pushKey( KEY_UP );
+    NCHeadless::instance()->pushKey( KEY_HOME );
+    NCHeadless::instance()->pushKey( KEY_NPAGE );
+
+    // no more keys: the dialog is cancelled
+    YEvent * event = dialog->waitForEvent();
+    BOOST_REQUIRE( event );
+    BOOST_CHECK_EQUAL( event->eventType(), YEvent::CancelEvent );
+    BOOST_CHECK( ! table->getCurrentItemPointer() );
+
+    // the lines come back when the filter is removed
+    table->setFilter( "" );
+    BOOST_CHECK( table->getCurrentItemPointer() );
+}
+
+BOOST_FIXTURE_TEST_CASE( changed_label, TableDialog )
+{
+    BOOST_REQUIRE( NCHeadless::instance() );
+
+    // the table is sorted: "bar", "baz", "foo"
+    table->setFilter( "ba" );
+    BOOST_CHECK_EQUAL( table->getCurrentItemPointer(), bar );
+
+    // "foo" matches the filter now: it is shown, "bar" stays the current item
+    foo->cell( 0 )->setLabel( "bat" );
+    static_cast<YTable *>( table )->cellChanged( foo->cell( 0 ) );
+    BOOST_CHECK_EQUAL( table->getCurrentItemPointer(), bar );
+
+    NCHeadless::instance()->pushKey( KEY_END );
+
+    YEvent * event = dialog->waitForEvent();
+    BOOST_REQUIRE( event );
+    BOOST_CHECK_EQUAL( table->getCurrentItemPointer(), foo );
+
+    // "bar" does not match any more: it is hidden
+    bar->cell( 0 )->setLabel( "qux" );
+    static_cast<YTable *>( table )->cellChanged( bar->cell( 0 ) );
+    BOOST_CHECK_EQUAL( table->getCurrentItemPointer(), foo );
+
+    NCHeadless::instance()->pushKey( KEY_HOME );
+
+    event = dialog->waitForEvent();
+    BOOST_REQUIRE( event );
+    BOOST_CHECK_EQUAL( table->getCurrentItemPointer(), baz );
+}
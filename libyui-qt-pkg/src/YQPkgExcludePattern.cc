@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*
+  File:	      YQPkgExcludePattern.cc
+
+  Textdomain "qt-pkg"
+
+*/
+
+
+#include <QRegularExpression>
+
+#include "YQPkgExcludePattern.h"
+
+
+QString
+combinableExcludePattern( const QRegExp & regexp )
+{
+    // Wildcards would have to be converted first
+    if ( regexp.patternSyntax() != QRegExp::RegExp &&
+	 regexp.patternSyntax() != QRegExp::RegExp2 )
+	return QString();
+
+    if ( ! regexp.isValid() || hasUnsafeEscape( regexp.pattern() ) )
+	return QString();
+
+    // Checked on its own: An unbalanced ")" would be hidden by the
+    // parentheses around it, but it would change the other alternatives
+    if ( ! QRegularExpression( regexp.pattern() ).isValid() )
+	return QString();
+
+    QString pattern = regexp.caseSensitivity() == Qt::CaseInsensitive ?
+	"(?i:%1)" : "(?:%1)";
+
+    return pattern.arg( regexp.pattern() );
+}
+
+
+bool
+hasUnsafeEscape( const QString & pattern )
+{
+    for ( int i = 0; i < pattern.size() - 1; ++i )
+    {
+	if ( pattern[ i ] != '\\' )
+	    continue;
+
+	QChar next = pattern[ ++i ];	// skip the escaped character
+
+	if ( next.isDigit() || next == 'x' )
+	    return true;
+    }
+
+    return false;
+}
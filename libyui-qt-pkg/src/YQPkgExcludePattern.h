@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*
+  File:	      YQPkgExcludePattern.h
+
+  Textdomain "qt-pkg"
+
+*/
+
+
+#ifndef YQPkgExcludePattern_h
+#define YQPkgExcludePattern_h
+
+#include <QRegExp>
+#include <QString>
+
+
+/**
+ * Return the pattern of 'regexp' as a subpattern for a QRegularExpression
+ * that combines the exclude rules of a column with "|", or an empty string
+ * if it can't be combined safely.
+ *
+ * The combined expression only rules out the items that don't match any
+ * rule, so it must match whenever 'regexp' matches exactly. This is only
+ * guaranteed for regular expressions (not wildcards) that are valid
+ * QRegularExpressions on their own and that don't use escapes that depend
+ * on the group numbers or that QRegularExpression reads differently (see
+ * hasUnsafeEscape()).
+ **/
+QString combinableExcludePattern( const QRegExp & regexp );
+
+/**
+ * Return 'true' if 'pattern' contains an escape sequence that can't be
+ * used in a combined expression: Backreferences ("\1" .. "\9") since the
+ * groups are numbered differently there, octal ("\0") and hex ("\x")
+ * escapes since QRegExp allows more digits than QRegularExpression.
+ **/
+bool hasUnsafeEscape( const QString & pattern );
+
+
+#endif // YQPkgExcludePattern_h
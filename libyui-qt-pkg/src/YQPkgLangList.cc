@@ -236,6 +236,27 @@ YQPkgLangListItem::status() const
 
 void
 YQPkgLangListItem::setStatus( ZyppStatus newStatus, bool sendSignals )
+{
+    if ( newStatus != S_Install && newStatus != S_NoInst )
+        return;
+
+    if ( setPoolStatus( newStatus ) )
+    {
+	applyChanges();
+
+	if ( sendSignals )
+	{
+	    _pkgObjList->updateItemStates();
+	    _pkgObjList->sendUpdatePackages();
+	}
+    }
+
+    setStatusIcon();
+    _pkgObjList->sendStatusChanged();
+}
+
+bool
+YQPkgLangListItem::setPoolStatus( ZyppStatus newStatus )
 {
     ZyppStatus oldStatus = status();
 
@@ -254,22 +275,10 @@ YQPkgLangListItem::setStatus( ZyppStatus newStatus, bool sendSignals )
             }
             break;
         default:
-            return;
-    }
-
-    if ( oldStatus != newStatus )
-    {
-	applyChanges();
-
-	if ( sendSignals )
-	{
-	    _pkgObjList->updateItemStates();
-	    _pkgObjList->sendUpdatePackages();
-	}
+            return false;
     }
 
-    setStatusIcon();
-    _pkgObjList->sendStatusChanged();
+    return oldStatus != status();
 }
 
 bool
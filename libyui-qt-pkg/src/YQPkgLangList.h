@@ -151,6 +151,7 @@ public:
      **/
     virtual ZyppStatus status() const;
     virtual void setStatus( ZyppStatus newStatus, bool sendSignals = true );
+    virtual bool setPoolStatus( ZyppStatus newStatus );
 
     /**
      * Returns 'true' if this selectable's status is set by a selection
@@ -42,6 +42,7 @@
 #include <QDebug>
 #include <QKeyEvent>
 
+#include "YQPkgExcludePattern.h"
 #include "YQPkgObjList.h"
 #include "YQPkgTextDialog.h"
 #include "YQIconPool.h"
@@ -55,6 +56,10 @@ using std::string;
 #define VERBOSE_EXCLUDE_RULES	0
 #define EXTRA_SOLVE_COLLECTIONS	0
 
+// The exclude rules matching an item are cached as bits of a quint64,
+// any further rules are checked each time
+#define MAX_CACHED_EXCLUDE_RULES	64
+
 
 YQPkgObjList::YQPkgObjList( QWidget * parent )
     : QY2ListView( parent )
@@ -92,6 +97,8 @@ YQPkgObjList::YQPkgObjList( QWidget * parent )
     _brokenIconCol	= -42;
     _satisfiedIconCol	= -42;
     _excludedItemsCount = 0;
+    _excludeRulesCompiled = false;
+    _excludeRulesSerial = 0;
     _debug		= false;
 
     createActions();
@@ -313,37 +320,37 @@ YQPkgObjList::setAllItemStatus( ZyppStatus newStatus, bool force )
     YQUI::ui()->busyCursor();
     QTreeWidgetItemIterator it( this );
 
+    // Any item with a changed status: For patterns, patches etc. applying
+    // the changes means a solver run - do that only once for all items.
+    YQPkgObjListItem * changedItem = 0;
+
     while ( *it )
     {
 	YQPkgObjListItem * item = dynamic_cast<YQPkgObjListItem *> (*it);
 
 	if ( item && item->editable() && newStatus != item->status() )
 	{
-	    if ( newStatus == S_Update )
+	    if ( newStatus == S_Update && ! force )
 	    {
-                if ( force )
-                {
-	            item->setStatus( newStatus,
-	  			     false );	// sendSignals
-                }
-                else
-                {
-                    if ( item->selectable()->installedObj() && item->status() != S_Protected && item->selectable()->updateCandidateObj() )
-                    {
-                        item->selectable()->setOnSystem( item->selectable()->updateCandidateObj() );
-                    }
-                }
-            }
+		if ( item->selectable()->installedObj() && item->status() != S_Protected && item->selectable()->updateCandidateObj() )
+		{
+		    item->selectable()->setOnSystem( item->selectable()->updateCandidateObj() );
+		}
+	    }
 	    else
 	    {
-		item->setStatus( newStatus,
-				 false );	// sendSignals
+		if ( item->setPoolStatus( newStatus ) )
+		    changedItem = item;
 	    }
 	}
 
 	++it;
     }
 
+    if ( changedItem )
+	changedItem->applyChanges();
+
+    // This updates the status icons of all items
     emit updateItemStates();
     emit updatePackages();
 
@@ -725,6 +732,112 @@ void
 YQPkgObjList::addExcludeRule( YQPkgObjList::ExcludeRule * rule )
 {
     _excludeRules.push_back( rule );
+    excludeRulesChanged();
+}
+
+
+void
+YQPkgObjList::excludeRulesChanged()
+{
+    _excludeRulesCompiled = false;
+    ++_excludeRulesSerial;	// invalidates the matches cached in the items
+}
+
+
+void
+YQPkgObjList::compileExcludeRules()
+{
+    _compiledExcludeRules.clear();
+    std::map<int, QStringList> patterns;	// by column
+
+    for ( int i = 0; i < (int) _excludeRules.size() && i < MAX_CACHED_EXCLUDE_RULES; ++i )
+    {
+	ExcludeRule * rule = _excludeRules[ i ];
+	CompiledExcludeRules * compiled = 0;
+
+	for ( CompiledExcludeRules & candidate: _compiledExcludeRules )
+	{
+	    if ( candidate.column == rule->column() )
+		compiled = &candidate;
+	}
+
+	if ( ! compiled )
+	{
+	    _compiledExcludeRules.push_back( CompiledExcludeRules() );
+	    compiled = &_compiledExcludeRules.back();
+	    compiled->column   = rule->column();
+	    compiled->combined = true;
+	}
+
+	compiled->rules.push_back( i );
+
+	// Rules that can't be combined safely (wildcards, backreferences, ...)
+	// are checked one by one, like all the others of the same column
+	QString pattern = combinableExcludePattern( rule->regexp() );
+
+	if ( ! pattern.isEmpty() )
+	    patterns[ compiled->column ] << pattern;
+	else
+	    compiled->combined = false;
+    }
+
+    for ( CompiledExcludeRules & compiled: _compiledExcludeRules )
+    {
+	if ( ! compiled.combined )
+	    continue;
+
+	// Anchored like QRegExp::exactMatch() in ExcludeRule::match()
+	compiled.regexp = QRegularExpression( "\\A(?:" + patterns[ compiled.column ].join( "|" ) + ")\\z" );
+
+	if ( compiled.regexp.isValid() )
+	{
+	    compiled.regexp.optimize();
+	}
+	else
+	{
+	    yuiWarning() << "Can't combine the exclude rules for column " << compiled.column
+			 << ": " << compiled.regexp.errorString() << endl;
+	    compiled.combined = false;
+	}
+    }
+
+    _excludeRulesCompiled = true;
+}
+
+
+quint64
+YQPkgObjList::excludeRuleMatches( YQPkgObjListItem * item )
+{
+    if ( item->excludeRulesSerial() == _excludeRulesSerial )
+	return item->excludeRuleMatches();
+
+    if ( ! _excludeRulesCompiled )
+	compileExcludeRules();
+
+    quint64 matches = 0;
+
+    for ( const CompiledExcludeRules & compiled: _compiledExcludeRules )
+    {
+	QString text = item->text( compiled.column );
+
+	if ( text.isEmpty() )
+	    continue;
+
+	// Most items don't match any rule: Check all rules of this column at once
+	if ( compiled.combined && ! compiled.regexp.match( text ).hasMatch() )
+	    continue;
+
+	// The rules may overlap, so find out which of them match
+	for ( int i: compiled.rules )
+	{
+	    if ( _excludeRules[ i ]->matchText( text ) )
+		matches |= Q_UINT64_C( 1 ) << i;
+	}
+    }
+
+    item->setExcludeRuleMatches( matches, _excludeRulesSerial );
+
+    return matches;
 }
 
 
@@ -784,14 +897,20 @@ YQPkgObjList::applyExcludeRules( QTreeWidgetItem * listViewItem )
 #if VERBOSE_EXCLUDE_RULES
 	ExcludeRule * matchingRule = 0;
 #endif
+	// No regexp matching here unless the rules changed
+	quint64 matches = _excludeRules.empty() ? 0 : excludeRuleMatches( item );
 
-	for ( ExcludeRuleList::iterator rule_it = _excludeRules.begin();
-	      rule_it != _excludeRules.end() && ! exclude;
-	      ++rule_it )
+	for ( int i = 0; i < (int) _excludeRules.size() && ! exclude; ++i )
 	{
-	    ExcludeRule * rule = *rule_it;
+	    ExcludeRule * rule = _excludeRules[ i ];
+
+	    if ( ! rule->isEnabled() )
+		continue;
 
-	    if ( rule->match( item ) )
+	    bool match = i < MAX_CACHED_EXCLUDE_RULES ?
+		( matches & ( Q_UINT64_C( 1 ) << i ) ) != 0 : rule->match( item );
+
+	    if ( match )
 	    {
 		exclude = true;
 #if VERBOSE_EXCLUDE_RULES
@@ -850,6 +969,8 @@ YQPkgObjListItem::YQPkgObjListItem( YQPkgObjList * pkgObjList,
     , _pkgObjList( pkgObjList )
     , _selectable( selectable )
     , _zyppObj( zyppObj )
+    , _excludeRuleMatches( 0 )
+    , _excludeRulesSerial( -1 )
     , _editable( true )
     , _excluded( false )
 {
@@ -865,6 +986,8 @@ YQPkgObjListItem::YQPkgObjListItem( YQPkgObjList *	pkgObjList,
     , _pkgObjList( pkgObjList )
     , _selectable( selectable )
     , _zyppObj( zyppObj )
+    , _excludeRuleMatches( 0 )
+    , _excludeRulesSerial( -1 )
     , _editable( true )
     , _excluded( false )
 {
@@ -877,6 +1000,8 @@ YQPkgObjListItem::YQPkgObjListItem( YQPkgObjList *	pkgObjList )
     , _pkgObjList( pkgObjList )
     , _selectable( 0 )
     , _zyppObj( 0 )
+    , _excludeRuleMatches( 0 )
+    , _excludeRulesSerial( -1 )
     , _editable( true )
     , _excluded( false )
 {
@@ -1051,10 +1176,7 @@ YQPkgObjListItem::bySelection() const
 void
 YQPkgObjListItem::setStatus( ZyppStatus newStatus, bool sendSignals )
 {
-    ZyppStatus oldStatus = selectable()->status();
-    selectable()->setStatus( newStatus );
-
-    if ( oldStatus != selectable()->status() )
+    if ( setPoolStatus( newStatus ) )
     {
 	applyChanges();
 
@@ -1069,6 +1191,16 @@ YQPkgObjListItem::setStatus( ZyppStatus newStatus, bool sendSignals )
 }
 
 
+bool
+YQPkgObjListItem::setPoolStatus( ZyppStatus newStatus )
+{
+    ZyppStatus oldStatus = selectable()->status();
+    selectable()->setStatus( newStatus );
+
+    return oldStatus != selectable()->status();
+}
+
+
 void
 YQPkgObjListItem::solveResolvableCollections()
 {
@@ -1540,6 +1672,7 @@ void
 YQPkgObjList::ExcludeRule::setRegexp( const QRegExp & regexp )
 {
     _regexp = regexp;
+    _parent->excludeRulesChanged();
 }
 
 
@@ -1547,6 +1680,7 @@ void
 YQPkgObjList::ExcludeRule::setColumn( int column )
 {
     _column = column;
+    _parent->excludeRulesChanged();
 }
 
 
@@ -1556,8 +1690,13 @@ YQPkgObjList::ExcludeRule::match( QTreeWidgetItem * item )
     if ( ! _enabled )
 	return false;
 
-    QString text = item->text( _column );
+    return matchText( item->text( _column ) );
+}
+
 
+bool
+YQPkgObjList::ExcludeRule::matchText( const QString & text ) const
+{
     if ( text.isEmpty() )
 	return false;
 
@@ -27,11 +27,13 @@
 
 #include <QPixmap>
 #include <QRegExp>
+#include <QRegularExpression>
 #include <QMenu>
 #include <QEvent>
 
 #include <map>
 #include <list>
+#include <vector>
 
 #include <yui/FSize.h>
 #include <yui/qt/QY2ListView.h>
@@ -111,6 +113,10 @@ public:
      * Sets the status of all (toplevel) list items to 'newStatus', if possible.
      * Only one single statusChanged() signal is emitted.
      *
+     * The status is changed in the zypp pool for all items first, then the
+     * changes are applied (e.g. by a solver run) once, and the status icons
+     * of all items are updated in one pass.
+     *
      * 'force' overrides sensible defaults like setting only zypp::ResObjects to
      * 'update' that really come with a newer version.
      **/
@@ -162,6 +168,30 @@ public:
      **/
     void exclude( YQPkgObjListItem * item, bool exclude );
 
+    /**
+     * Notification that an exclude rule was added or its regular expression
+     * or column changed: The rules have to be compiled again, and the rules
+     * that match each item have to be checked again.
+     *
+     * Enabling or disabling a rule doesn't need this.
+     **/
+    void excludeRulesChanged();
+
+    /**
+     * Compile all exclude rules into one regular expression for each column
+     * they check.
+     **/
+    void compileExcludeRules();
+
+    /**
+     * Return the exclude rules that match 'item', one bit for each rule
+     * (the index in _excludeRules), no matter if the rule is enabled.
+     *
+     * This is calculated with the compiled rules when the item is added to
+     * the list and then cached in the item until the rules change.
+     **/
+    quint64 excludeRuleMatches( YQPkgObjListItem * item );
+
 
 public slots:
 
@@ -364,10 +394,26 @@ protected:
     bool        _debug;
     int		_excludedItemsCount;
 
-    typedef list<ExcludeRule *> ExcludeRuleList;
+    typedef std::vector<ExcludeRule *> ExcludeRuleList;
 
     ExcludeRuleList	_excludeRules;
 
+    /**
+     * The exclude rules that check one column, combined into one regular
+     * expression that matches if any of them matches.
+     **/
+    struct CompiledExcludeRules
+    {
+	int			column;
+	QRegularExpression	regexp;
+	bool			combined;	// 'false': check each rule
+	std::vector<int>	rules;		// indices in _excludeRules
+    };
+
+    std::vector<CompiledExcludeRules> _compiledExcludeRules;
+    bool		_excludeRulesCompiled;
+    int			_excludeRulesSerial;
+
     QMenu *	_installedContextMenu;
     QMenu *	_notInstalledContextMenu;
 
@@ -397,6 +443,9 @@ public:
 
 class YQPkgObjListItem: public QY2ListViewItem
 {
+    // For applying the changes of many items at once in setAllItemStatus()
+    friend class YQPkgObjList;
+
 public:
 
     /**
@@ -474,6 +523,15 @@ public:
      **/
     virtual void setStatus( ZyppStatus newStatus, bool sendSignals = true );
 
+    /**
+     * Set the status in the zypp pool only: Unlike setStatus(), this does
+     * not apply the changes and does not update the status icon. This is
+     * for changing many items at once.
+     *
+     * Returns 'true' if the status changed.
+     **/
+    virtual bool setPoolStatus( ZyppStatus newStatus );
+
 
     /**
      * Set a status icon according to the package's status.
@@ -584,6 +642,24 @@ public:
      **/
     void setExcluded( bool exclude = true );
 
+    /**
+     * Return the exclude rules of the parent list that match this item as
+     * cached by YQPkgObjList::excludeRuleMatches().
+     **/
+    quint64 excludeRuleMatches() const { return _excludeRuleMatches; }
+
+    /**
+     * Return the state of the exclude rules of the parent list when the
+     * matches were cached, -1 if they never were.
+     **/
+    int excludeRulesSerial() const { return _excludeRulesSerial; }
+
+    /**
+     * Cache the exclude rules that match this item.
+     **/
+    void setExcludeRuleMatches( quint64 matches, int rulesSerial )
+	{ _excludeRuleMatches = matches; _excludeRulesSerial = rulesSerial; }
+
 
     // Handle Debug isBroken and isSatisfied flags
 
@@ -659,6 +735,8 @@ protected:
     YQPkgObjList *	_pkgObjList;
     ZyppSel		_selectable;
     ZyppObj		_zyppObj;
+    quint64		_excludeRuleMatches;
+    int			_excludeRulesSerial;
     bool		_editable:1;
     bool		_candidateIsNewer:1;
     bool		_installedIsNewer:1;
@@ -737,6 +815,12 @@ public:
      **/
     bool match( QTreeWidgetItem * item );
 
+    /**
+     * Check a text against the regular expression of this exclude rule,
+     * no matter if it is enabled.
+     **/
+    bool matchText( const QString & text ) const;
+
 private:
 
     YQPkgObjList *	_parent;
@@ -0,0 +1,103 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for combining the exclude rules of YQPkgObjList
+
+#define BOOST_TEST_MODULE YQPkgExcludePattern_tests
+#include <boost/test/unit_test.hpp>
+
+#include <QRegularExpression>
+#include <QStringList>
+
+#include "YQPkgExcludePattern.h"
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// combined like in YQPkgObjList::compileExcludeRules()
+static QRegularExpression combine( const QStringList & patterns )
+{
+    return QRegularExpression( "\\A(?:" + patterns.join( "|" ) + ")\\z" );
+}
+
+BOOST_AUTO_TEST_CASE( plain_rules )
+{
+    QRegExp debuginfo( ".*-debuginfo$" );
+    QRegExp devel( ".*-DEVEL", Qt::CaseInsensitive );
+
+    QString first  = combinableExcludePattern( debuginfo );
+    QString second = combinableExcludePattern( devel );
+
+    BOOST_CHECK( ! first.isEmpty() );
+    BOOST_CHECK( ! second.isEmpty() );
+
+    QRegularExpression combined = combine( QStringList() << first << second );
+
+    BOOST_CHECK( combined.isValid() );
+    BOOST_CHECK( combined.match( "foo-debuginfo" ).hasMatch() );
+    BOOST_CHECK( combined.match( "foo-devel" ).hasMatch() );
+    BOOST_CHECK( ! combined.match( "foo" ).hasMatch() );
+    // exact match only
+    BOOST_CHECK( ! combined.match( "foo-debuginfo-x" ).hasMatch() );
+}
+
+BOOST_AUTO_TEST_CASE( backreference_rule )
+{
+    QRegExp other( "x(y)" );
+    QRegExp backref( "(a)\\1" );
+
+    BOOST_CHECK( backref.exactMatch( "aa" ) );
+
+    // in the combined expression "\1" would refer to the group of the other rule
+    QRegularExpression naive = combine( QStringList() << "(?:x(y))" << "(?:(a)\\1)" );
+    BOOST_CHECK( ! naive.match( "aa" ).hasMatch() );
+
+    BOOST_CHECK( ! combinableExcludePattern( other ).isEmpty() );
+    BOOST_CHECK( combinableExcludePattern( backref ).isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( unsafe_escapes )
+{
+    BOOST_CHECK( hasUnsafeEscape( "(a)\\1" ) );
+    BOOST_CHECK( hasUnsafeEscape( "\\0101" ) );
+    BOOST_CHECK( hasUnsafeEscape( "\\x0041" ) );
+
+    BOOST_CHECK( ! hasUnsafeEscape( "\\.\\*\\d+" ) );
+    // an escaped backslash followed by a digit is no backreference
+    BOOST_CHECK( ! hasUnsafeEscape( "a\\\\1" ) );
+    BOOST_CHECK( ! hasUnsafeEscape( "trailing\\" ) );
+}
+
+BOOST_AUTO_TEST_CASE( not_combinable )
+{
+    // wildcards
+    BOOST_CHECK( combinableExcludePattern( QRegExp( "*-devel", Qt::CaseSensitive, QRegExp::Wildcard ) ).isEmpty() );
+
+    // an unbalanced ")" would change the other alternatives
+    BOOST_CHECK( combinableExcludePattern( QRegExp( "a)|(b" ) ).isEmpty() );
+
+    // invalid for QRegExp, so the rule never matches anyway
+    BOOST_CHECK( combinableExcludePattern( QRegExp( "a(" ) ).isEmpty() );
+}
@@ -14,12 +14,15 @@
 */
 
 
+#include <QApplication>
+#include <QEvent>
 #include <QThread>
 #include <QSocketNotifier>
 
 #define  YUILogComponent "qt-rest-api"
 #include <yui/YUILog.h>
 
+#include <yui/YWidget.h>
 #include <yui/rest-api/YHttpServer.h>
 
 #include "YQHttpUI.h"
@@ -51,6 +54,7 @@ void YQHttpUI::initUI()
     YQHttpUISignalReceiver *receiver = new YQHttpUISignalReceiver();
     // handle the HTTP REST API events
     receiver->createHttpNotifiers();
+    qApp->installEventFilter( receiver );
 
     _signalReceiver = receiver;
     _busyCursorTimer = new QTimer( _signalReceiver );
@@ -103,6 +107,23 @@ YQHttpUISignalReceiver::httpData()
     createHttpNotifiers();
 }
 
+bool YQHttpUISignalReceiver::eventFilter( QObject * obj, QEvent * event )
+{
+    switch ( event->type() )
+    {
+        case QEvent::KeyPress:
+        case QEvent::MouseButtonRelease:
+        case QEvent::Wheel:
+            YWidget::markChanged();
+            break;
+
+        default:
+            break;
+    }
+
+    return YQUISignalReceiver::eventFilter( obj, event );
+}
+
 void YQHttpUISignalReceiver::clearHttpNotifiers() {
     yuiDebug() << "Clearing HTTP notifiers..." << std::endl;
 
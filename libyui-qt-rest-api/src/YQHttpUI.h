@@ -81,6 +81,12 @@ public:
     void clearHttpNotifiers();
     void createHttpNotifiers();
 
+    /**
+     * Application wide event filter, watches the user input which might
+     * change the widgets to invalidate the REST API caches.
+     **/
+    virtual bool eventFilter( QObject * obj, QEvent * event );
+
 private:
     std::vector<QSocketNotifier*>  _http_notifiers;
 };
@@ -0,0 +1,195 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Benchmark for populating the Table and Tree widgets of the Qt UI.
+
+  Usage:
+
+    yui-qt-table [ITEMS]
+
+  Fills a Table with ITEMS flat items (default 100000) like the "Pizza"
+  items of examples/Table-many-items.cc, then a Table and a Tree with
+  ITEMS / 5 disks with 4 partitions each like examples/Table-nested-items.cc.
+  For each of them it measures adding the items, showing the dialog and
+  selecting the last item, and the memory used.
+
+  Unless DISPLAY or QT_QPA_PLATFORM are set, this runs on the "offscreen"
+  Qt platform, so no X server is needed.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include <sys/resource.h>
+
+#include <yui/YUI.h>
+#include <yui/YWidgetFactory.h>
+#include <yui/YDialog.h>
+#include <yui/YLayoutBox.h>
+#include <yui/YTable.h>
+#include <yui/YTree.h>
+#include <yui/YTreeItem.h>
+#include <yui/YAlignment.h>
+
+// Maximum resident set size so far in MB
+static double max_rss_mb()
+{
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+
+    return usage.ru_maxrss / 1024.0;
+}
+
+static void run( const char *name, std::function<void()> action )
+{
+    auto start = std::chrono::steady_clock::now();
+    action();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    printf( "  %-12s %10.1f ms  max RSS %8.1f MB\n", name, elapsed.count(), max_rss_mb() );
+}
+
+static YItemCollection flat_table_items( int count )
+{
+    YItemCollection items;
+
+    for ( int i = 1; i <= count; ++i )
+    {
+        char no[20];
+        char name[80];
+        snprintf( no,   sizeof( no ),   "%06d", i );
+        snprintf( name, sizeof( name ), "Pizza #%06d", i );
+        items.push_back( new YTableItem( no, name ) );
+    }
+
+    return items;
+}
+
+static YItemCollection nested_table_items( int disks )
+{
+    YItemCollection items;
+
+    for ( int i = 0; i < disks; ++i )
+    {
+        std::string disk = "/dev/disk" + std::to_string( i );
+        YTableItem *parent = new YTableItem( disk, "931.5G" );
+        parent->setOpen( i % 2 == 0 );
+
+        new YTableItem( parent, disk + "p1",   "2.0G", "swap", "[swap]" );
+        new YTableItem( parent, disk + "p2",  "29.4G", "ext4", "/" );
+        new YTableItem( parent, disk + "p3",  "29.4G", "ext4", "/old-root" );
+        new YTableItem( parent, disk + "p4", "870.7G", "xfs",  "/work" );
+
+        items.push_back( parent );
+    }
+
+    return items;
+}
+
+static YItemCollection nested_tree_items( int disks )
+{
+    YItemCollection items;
+
+    for ( int i = 0; i < disks; ++i )
+    {
+        std::string disk = "/dev/disk" + std::to_string( i );
+        YTreeItem *parent = new YTreeItem( disk, i % 2 == 0 );
+
+        for ( int part = 1; part <= 4; ++part )
+            new YTreeItem( parent, disk + "p" + std::to_string( part ) );
+
+        items.push_back( parent );
+    }
+
+    return items;
+}
+
+// The last toplevel item or its last child if it has any
+static YItem *last_item( YSelectionWidget *widget )
+{
+    YItem *item = widget->itemAt( widget->itemsCount() - 1 );
+
+    if ( item && item->hasChildren() )
+        item = *( item->childrenEnd() - 1 );
+
+    return item;
+}
+
+static YTableHeader *create_header()
+{
+    YTableHeader *header = new YTableHeader();
+    header->addColumn( "Device" );
+    header->addColumn( "Size", YAlignEnd );
+    header->addColumn( "Type" );
+    header->addColumn( "Mount Point" );
+
+    return header;
+}
+
+// 'create' creates the widget below 'parent', 'items' creates its items
+static void bench( const char *name,
+                   std::function<YSelectionWidget *( YWidget *parent )> create,
+                   std::function<YItemCollection()> items )
+{
+    printf( "%s:\n", name );
+
+    YDialog *dialog = YUI::widgetFactory()->createPopupDialog();
+    YAlignment *minSize = YUI::widgetFactory()->createMinSize( dialog, 60, 20 );
+    YSelectionWidget *widget = create( minSize );
+    YItemCollection collection = items();
+
+    run( "add items", [&]() { widget->addItems( collection ); } );
+    run( "show", [&]() { dialog->open(); dialog->pollEvent(); } );
+    run( "select last", [&]() { widget->selectItem( last_item( widget ) ); dialog->pollEvent(); } );
+    run( "delete items", [&]() { widget->deleteAllItems(); dialog->pollEvent(); } );
+
+    dialog->destroy();
+}
+
+int main( int argc, char **argv )
+{
+    int count = argc > 1 ? atoi( argv[1] ) : 100000;
+
+    if ( ! getenv( "DISPLAY" ) && ! getenv( "QT_QPA_PLATFORM" ) )
+        setenv( "QT_QPA_PLATFORM", "offscreen", 1 );
+
+    // The UI loader only picks the Qt UI if there is a display
+    if ( ! getenv( "DISPLAY" ) )
+        setenv( "DISPLAY", ":0", 1 );
+
+    setenv( "YUI_PREFERED_BACKEND", "qt", 1 );
+
+    YUI::ui();  // load the UI before measuring anything
+    printf( "items: %d, max RSS with the UI loaded: %.1f MB\n", count, max_rss_mb() );
+
+    bench( "Table, flat items",
+           []( YWidget *parent ) { return YUI::widgetFactory()->createTable( parent, create_header() ); },
+           [=]() { return flat_table_items( count ); } );
+
+    bench( "Table, nested items",
+           []( YWidget *parent ) { return YUI::widgetFactory()->createTable( parent, create_header() ); },
+           [=]() { return nested_table_items( count / 5 ); } );
+
+    bench( "Tree, nested items",
+           []( YWidget *parent ) { return YUI::widgetFactory()->createTree( parent, "Disks" ); },
+           [=]() { return nested_tree_items( count / 5 ); } );
+
+    return 0;
+}
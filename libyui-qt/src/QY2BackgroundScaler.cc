@@ -0,0 +1,226 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:		QY2BackgroundScaler.cc
+
+/-*/
+
+
+#define YUILogComponent "qt-styler"
+#include <yui/YUILog.h>
+
+#include <QMetaObject>
+#include <QRunnable>
+
+#include "QY2BackgroundScaler.h"
+
+// Maximum size of the cached smooth images
+#define MAX_CACHE_KB	( 64 * 1024 )
+
+using std::endl;
+
+
+namespace
+{
+    /**
+     * Worker thread job: Smooth scaling of one image.
+     *
+     * Only QImages are used here, QPixmaps must stay in the GUI thread.
+     */
+    class ScaleJob: public QRunnable
+    {
+    public:
+
+	ScaleJob( QObject * receiver, const QString & name, const QImage & image, const QSize & size )
+	    : _receiver( receiver )
+	    , _name( name )
+	    , _image( image )
+	    , _size( size )
+	    {}
+
+	virtual void run()
+	{
+	    QImage result = _image.scaled( _size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation );
+
+	    // Back to the GUI thread. The receiver waits for all jobs in its
+	    // destructor, and the event is discarded if it is gone by then.
+
+	    QMetaObject::invokeMethod( _receiver, "slotScaled", Qt::QueuedConnection,
+				       Q_ARG( QString, _name ),
+				       Q_ARG( QSize,   _size ),
+				       Q_ARG( QImage,  result ) );
+	}
+
+    private:
+
+	QObject * _receiver;
+	QString	  _name;
+	QImage	  _image;
+	QSize	  _size;
+    };
+}
+
+
+QY2BackgroundScaler::QY2BackgroundScaler( QObject * parent )
+    : QObject( parent )
+{
+    // One worker is enough, there is one job per image at most
+    _threadPool.setMaxThreadCount( 1 );
+    _cache.setMaxCost( MAX_CACHE_KB );
+}
+
+
+QY2BackgroundScaler::~QY2BackgroundScaler()
+{
+    _threadPool.waitForDone();
+}
+
+
+QImage
+QY2BackgroundScaler::scaled( const QString & name,
+			     const QImage &  image,
+			     const QSize &   size,
+			     bool *	     smooth )
+{
+    if ( smooth )
+	*smooth = true;
+
+    if ( image.isNull() || size.isEmpty() )
+	return QImage();
+
+    QString key = cacheKey( name, size );
+    QImage * cached = _cache.object( key );
+
+    if ( cached )
+	return *cached;
+
+    QImage uncached = _uncached.value( name );
+
+    if ( uncached.size() == size )
+	return uncached;
+
+    if ( size == image.size() )
+    {
+	// Nothing to scale
+	QImage converted = image.convertToFormat( QImage::Format_ARGB32 );
+
+	if ( ! insert( key, converted ) )
+	    _uncached.insert( name, converted );
+
+	return converted;
+    }
+
+    // Scaled before, but it didn't stay in the cache: Scaling it again
+    // would only push out the other sizes of the same or other images
+    if ( ! _scaledKeys.contains( key ) )
+	startJob( name, image, size );
+
+    QImage & placeholder = _placeholders[ name ];
+
+    if ( placeholder.size() != size )
+	placeholder = image.scaled( size, Qt::IgnoreAspectRatio, Qt::FastTransformation );
+
+    if ( smooth )
+	*smooth = false;
+
+    return placeholder;
+}
+
+
+void
+QY2BackgroundScaler::startJob( const QString & name, const QImage & image, const QSize & size )
+{
+    if ( _running.contains( name ) )
+    {
+	// Only the last size requested while a job is running is of interest
+	if ( _running.value( name ) != size )
+	    _queued.insert( name, qMakePair( image, size ) );
+	else
+	    _queued.remove( name );
+
+	return;
+    }
+
+    yuiDebug() << "Scaling " << qPrintable( name ) << " to "
+	       << size.width() << "x" << size.height() << endl;
+
+    _running.insert( name, size );
+    _threadPool.start( new ScaleJob( this, name, image, size ) );
+}
+
+
+void
+QY2BackgroundScaler::slotScaled( const QString & name, const QSize & size, const QImage & result )
+{
+    QString key = cacheKey( name, size );
+
+    _running.remove( name );
+    _scaledKeys.insert( key );
+
+    if ( ! insert( key, result ) )
+    {
+	yuiWarning() << "Scaled image " << qPrintable( key ) << " is too large for the cache" << endl;
+	_uncached.insert( name, result );
+    }
+
+    if ( _queued.contains( name ) )
+    {
+	QPair<QImage, QSize> next = _queued.take( name );
+
+	if ( ! _scaledKeys.contains( cacheKey( name, next.second ) ) )
+	    startJob( name, next.first, next.second );
+    }
+
+    emit scaledImageReady( name );
+}
+
+
+bool
+QY2BackgroundScaler::insert( const QString & key, const QImage & image )
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    qsizetype bytes = image.sizeInBytes();
+#else
+    int bytes = image.byteCount();
+#endif
+    int costKB = 1 + bytes / 1024;
+
+    // QCache deletes the image right away if it is too large
+    return _cache.insert( key, new QImage( image ), costKB );
+}
+
+
+void
+QY2BackgroundScaler::clear()
+{
+    // Results of the running jobs are still cached when they arrive,
+    // but they will simply not be used
+
+    _cache.clear();
+    _placeholders.clear();
+    _uncached.clear();
+    _scaledKeys.clear();
+    _queued.clear();
+}
+
+
+QString
+QY2BackgroundScaler::cacheKey( const QString & name, const QSize & size )
+{
+    return QString( "%1_%2_%3" ).arg( name ).arg( size.width() ).arg( size.height() );
+}
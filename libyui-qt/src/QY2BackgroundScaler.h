@@ -0,0 +1,139 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:		QY2BackgroundScaler.h
+
+/-*/
+
+
+#ifndef QY2BackgroundScaler_h
+#define QY2BackgroundScaler_h
+
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QPair>
+#include <QSet>
+#include <QSize>
+#include <QString>
+#include <QThreadPool>
+
+
+/**
+ * Smooth scaling of the background images of the styler in a worker thread.
+ *
+ * Smooth scaling a large background image takes long enough to make resizing
+ * a window stutter. Until the smooth version of a size is ready, a fast
+ * scaled placeholder is used, and scaledImageReady() tells when to render
+ * the background again.
+ *
+ * The smooth images are kept in a cache of limited size by image and size,
+ * so widgets with the same background image share them. Each size of an
+ * image is smooth scaled only once: If it doesn't stay in the cache, the
+ * placeholder is used for it, so widgets that need more images than the
+ * cache can hold don't scale them over and over again.
+ */
+class QY2BackgroundScaler : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * Constructor.
+     */
+    QY2BackgroundScaler( QObject * parent = 0 );
+
+    /**
+     * Destructor. Waits for the running jobs.
+     */
+    virtual ~QY2BackgroundScaler();
+
+    /**
+     * Returns 'image' scaled to 'size'.
+     *
+     * \param name Name of the image for the cache, e.g. its file name.
+     * \param image The original image.
+     * \param size Requested size.
+     * \param smooth If not 0, set to true if the result is the smooth
+     *        version and to false if it is a placeholder.
+     */
+    QImage scaled( const QString & name,
+		   const QImage &  image,
+		   const QSize &   size,
+		   bool *	   smooth = 0 );
+
+    /**
+     * Forget all scaled images, e.g. after the style sheet changed.
+     * This also allows scaling the same sizes again.
+     */
+    void clear();
+
+signals:
+
+    /**
+     * Emitted when the smooth version of image 'name' is ready.
+     */
+    void scaledImageReady( const QString & name );
+
+protected slots:
+
+    /**
+     * Take over the result of a worker thread job.
+     */
+    void slotScaled( const QString & name, const QSize & size, const QImage & result );
+
+protected:
+
+    /**
+     * Start scaling 'image' to 'size' in a worker thread, or after the
+     * running job for 'name' if there is one.
+     */
+    void startJob( const QString & name, const QImage & image, const QSize & size );
+
+    /**
+     * Returns the cache key for image 'name' in 'size'.
+     */
+    static QString cacheKey( const QString & name, const QSize & size );
+
+    /**
+     * Add 'image' to the cache for 'key'. Returns false if it is too large
+     * for the cache.
+     */
+    bool insert( const QString & key, const QImage & image );
+
+    QThreadPool				_threadPool;
+    QCache<QString, QImage>		_cache;		// cost: KB
+
+    // Fast scaled placeholder per image name
+    QHash<QString, QImage>		_placeholders;
+
+    // Last smooth image per image name that was too large for the cache
+    QHash<QString, QImage>		_uncached;
+
+    // Cache keys of the images that were already smooth scaled
+    QSet<QString>			_scaledKeys;
+
+    // Size being scaled per image name and the next job for that name
+    QHash<QString, QSize>		_running;
+    QHash<QString, QPair<QImage, QSize> > _queued;
+};
+
+
+#endif // QY2BackgroundScaler_h
@@ -29,6 +29,7 @@
 #include <yui/YSettings.h>
 
 #include "QY2Styler.h"
+#include "QY2BackgroundScaler.h"
 #include <QDebug>
 #include <QFile>
 #include <QString>
@@ -40,9 +41,20 @@
 #include <QPixmapCache>
 #include <QFileInfo>
 #include <QRegularExpression>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QSaveFile>
+#include <QStandardPaths>
 
 #define LOGGING_CAUSES_QT4_THREADING_PROBLEMS	1
 
+// Format of the compiled style sheet cache files; increase when changing it
+#define COMPILED_STYLE_SHEET_MAGIC	"libyui-qt compiled style sheet"
+#define COMPILED_STYLE_SHEET_VERSION	1
+
 std::ostream & operator<<( std::ostream & stream, const QString     & str     );
 std::ostream & operator<<( std::ostream & stream, const QStringList & strList );
 std::ostream & operator<<( std::ostream & stream, const QWidget     * widget  );
@@ -58,6 +70,12 @@ QY2Styler::QY2Styler( QObject * parent,
     QPixmapCache::setCacheLimit( 5 * 1024 );
     // yuiDebug() << "Styler created" << endl;
 
+    _scaler = new QY2BackgroundScaler( this );
+    YUI_CHECK_NEW( _scaler );
+
+    connect( _scaler,	&QY2BackgroundScaler::scaledImageReady,
+             this,	&QY2Styler::slotScaledImageReady );
+
     setDefaultStyleSheet(defaultStyleSheet);
     setAlternateStyleSheet(alternateStyleSheet);
     _currentStyleSheet = QString( "" );
@@ -72,6 +90,8 @@ QY2Styler::styler()
     if ( ! styler )
     {
         // yuiDebug() << "Creating QY2Styler singleton" << endl;
+        QElapsedTimer timer;
+        timer.start();
 
         QString y2style = getenv("Y2STYLE");
         QString y2altstyle = getenv("Y2ALTSTYLE");
@@ -83,6 +103,8 @@ QY2Styler::styler()
             styler->loadDefaultStyleSheet();
         else
             styler->loadAlternateStyleSheet();
+
+        yuiMilestone() << "Styler set up in " << timer.elapsed() << " ms" << endl;
     }
     return styler;
 }
@@ -131,21 +153,195 @@ bool QY2Styler::loadAlternateStyleSheet()
 
 bool QY2Styler::loadStyleSheet( const QString & filename )
 {
-    QFile file( themeDir() + filename );
+    QElapsedTimer timer;
+    timer.start();
 
-    if ( file.open( QIODevice::ReadOnly ) )
+    CompiledStyleSheet compiled;
+
+    if ( findCompiledStyleSheet( filename, compiled ) )
+    {
+        yuiMilestone() << "Using compiled style sheet \"" << themeDir() + filename << "\"" << endl;
+    }
+    else
     {
+        QFile file( themeDir() + filename );
+
+        if ( ! file.open( QIODevice::ReadOnly ) )
+        {
+            yuiMilestone() << "Couldn't open style sheet \"" << file.fileName() << "\"" << endl;
+            return false;
+        }
+
         yuiMilestone() << "Using style sheet \"" << file.fileName() << "\"" << endl;
-        QString text = file.readAll();
-        _currentStyleSheet = QString(filename);
-        setStyleSheet( text );
+
+        QStringList files;
+        files << file.fileName();
+
+        compiled.style = buildStyleSheet( QString( file.readAll() ), files );
+        processUrls( compiled.style, &files );
+        compiled.textStyle   = _textStyle;
+        compiled.backgrounds = _backgrounds;
+
+        foreach( const QString & path, files )
+            compiled.files.insert( path, modificationTime( path ) );
+
+        storeCompiledStyleSheet( filename, compiled );
+    }
+
+    _currentStyleSheet = QString(filename);
+    _style     = compiled.style;
+    _textStyle = compiled.textStyle;
+    _backgrounds = compiled.backgrounds;
+    _scaler->clear();
+
+    applyStyleSheet();
+
+    yuiMilestone() << "Style sheet loaded in " << timer.elapsed() << " ms" << endl;
+
+    return true;
+}
+
+
+bool QY2Styler::findCompiledStyleSheet( const QString & filename, CompiledStyleSheet & compiled )
+{
+    QHash<QString, CompiledStyleSheet>::const_iterator it = _compiledStyleSheets.constFind( filename );
+
+    if ( it != _compiledStyleSheets.constEnd() && isUpToDate( it.value() ) )
+    {
+        compiled = it.value();
         return true;
     }
-    else
+
+    QString path = compiledStyleSheetPath( filename );
+
+    if ( ! path.isEmpty() && readCompiledStyleSheet( path, compiled ) && isUpToDate( compiled ) )
+    {
+        _compiledStyleSheets.insert( filename, compiled );
+        return true;
+    }
+
+    return false;
+}
+
+
+void QY2Styler::storeCompiledStyleSheet( const QString & filename, const CompiledStyleSheet & compiled )
+{
+    _compiledStyleSheets.insert( filename, compiled );
+
+    QString path = compiledStyleSheetPath( filename );
+
+    if ( ! path.isEmpty() )
+        writeCompiledStyleSheet( path, compiled );
+}
+
+
+bool QY2Styler::isUpToDate( const CompiledStyleSheet & compiled ) const
+{
+    for ( QHash<QString, qint64>::const_iterator it = compiled.files.constBegin();
+          it != compiled.files.constEnd();
+          ++it )
+    {
+        if ( modificationTime( it.key() ) != it.value() )
+        {
+            yuiDebug() << "Style sheet file changed: " << it.key() << endl;
+            return false;
+        }
+    }
+
+    return ! compiled.files.isEmpty();
+}
+
+
+qint64 QY2Styler::modificationTime( const QString & path )
+{
+    QFileInfo fileInfo( path );
+
+    return fileInfo.exists() ? fileInfo.lastModified().toMSecsSinceEpoch() : -1;
+}
+
+
+QString QY2Styler::compiledStyleSheetPath( const QString & filename ) const
+{
+    QString cacheDir = QStandardPaths::writableLocation( QStandardPaths::GenericCacheLocation );
+
+    if ( cacheDir.isEmpty() )
+        return "";
+
+    // One file per theme directory and style sheet
+    QByteArray hash = QCryptographicHash::hash( ( themeDir() + filename ).toUtf8(),
+                                                QCryptographicHash::Sha1 ).toHex();
+
+    return cacheDir + "/libyui-qt/stylesheets/" + QString::fromLatin1( hash ) + ".cache";
+}
+
+
+bool QY2Styler::readCompiledStyleSheet( const QString & path, CompiledStyleSheet & compiled ) const
+{
+    QFile file( path );
+
+    if ( ! file.open( QIODevice::ReadOnly ) )
+        return false;
+
+    QDataStream stream( &file );
+    stream.setVersion( QDataStream::Qt_5_0 );
+
+    QString magic;
+    qint32  version;
+    qint32  backgroundCount;
+
+    stream >> magic >> version;
+
+    if ( magic != COMPILED_STYLE_SHEET_MAGIC || version != COMPILED_STYLE_SHEET_VERSION )
+        return false;
+
+    stream >> compiled.files >> compiled.style >> compiled.textStyle >> backgroundCount;
+
+    for ( int i = 0; i < backgroundCount && stream.status() == QDataStream::Ok; i++ )
     {
-        yuiMilestone() << "Couldn't open style sheet \"" << file.fileName() << "\"" << endl;
+        QString name;
+        BackgrInfo background;
+
+        stream >> name >> background.filename >> background.full;
+        compiled.backgrounds.insert( name, background );
+    }
+
+    if ( stream.status() != QDataStream::Ok )
+    {
+        yuiWarning() << "Ignoring broken compiled style sheet " << path << endl;
         return false;
     }
+
+    return true;
+}
+
+
+void QY2Styler::writeCompiledStyleSheet( const QString & path, const CompiledStyleSheet & compiled ) const
+{
+    if ( ! QDir().mkpath( QFileInfo( path ).path() ) )
+        return;
+
+    // Written to a temporary file first: Another process might read it
+    QSaveFile file( path );
+
+    if ( ! file.open( QIODevice::WriteOnly ) )
+        return;
+
+    QDataStream stream( &file );
+    stream.setVersion( QDataStream::Qt_5_0 );
+
+    stream << QString( COMPILED_STYLE_SHEET_MAGIC ) << (qint32) COMPILED_STYLE_SHEET_VERSION;
+    stream << compiled.files << compiled.style << compiled.textStyle;
+    stream << (qint32) compiled.backgrounds.size();
+
+    for ( QHash<QString, BackgrInfo>::const_iterator it = compiled.backgrounds.constBegin();
+          it != compiled.backgrounds.constEnd();
+          ++it )
+    {
+        stream << it.key() << it.value().filename << it.value().full;
+    }
+
+    if ( ! file.commit() )
+        yuiDebug() << "Couldn't write compiled style sheet " << path << endl;
 }
 
 
@@ -190,7 +386,14 @@ void QY2Styler::setStyleSheet( const QString & text )
 {
     _style = buildStyleSheet(text);
     processUrls( _style );
+    _scaler->clear();
+
+    applyStyleSheet();
+}
+
 
+void QY2Styler::applyStyleSheet()
+{
     QWidget *child;
     QList< QWidget* > childlist;
 
@@ -212,7 +415,7 @@ void QY2Styler::toggleAlternateStyleSheet()
 }
 
 
-void QY2Styler::processUrls( QString & text )
+void QY2Styler::processUrls( QString & text, QStringList * files )
 {
     QString result;
     QStringList lines = text.split( '\n' );
@@ -254,6 +457,9 @@ void QY2Styler::processUrls( QString & text )
             QString filename = richTextRegex.cap( 1 );
             QFile file( themeDir() + "/" + filename );
 
+            if ( files )
+                *files << file.fileName();
+
             if ( file.open(  QIODevice::ReadOnly ) )
             {
 		yuiDebug() << "Reading " << file.fileName();
@@ -306,28 +512,47 @@ void QY2Styler::registerChildWidget( QWidget * parent, QWidget * widget )
 
 
 QImage
-QY2Styler::getScaled( const QString name, const QSize & size )
+QY2Styler::getScaled( const QString name, const QSize & size, bool * smooth )
 {
-    QImage image = _backgrounds[name].pix;
+    const BackgrInfo & background = _backgrounds[name];
 
-    if ( size != image.size() )
-        image = image.scaled( size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation );
-    else
-        image = image.convertToFormat( QImage::Format_ARGB32 );
+    // The scaled images are shared by all widgets with the same image file
+    QImage image = _scaler->scaled( background.filename, background.pix, size, smooth );
 
     if ( image.isNull() )
-	yuiError() << "Can't load pixmap from " <<  name << endl;
-#if 1
-    else
-	yuiMilestone() << "Loaded pixmap from \"" << name
-		       << "\"  size: " << image.size().width() << "x" << image.size().height()
-		       << endl;
-#endif
+	yuiError() << "Can't scale pixmap from " <<  name << endl;
 
     return image;
 }
 
 
+void
+QY2Styler::slotScaledImageReady( const QString & filename )
+{
+    for ( QMap<QWidget*, QList< QWidget* > >::const_iterator it = _children.constBegin();
+          it != _children.constEnd();
+          ++it )
+    {
+        QWidget * parent = it.key();
+
+        if ( ! parent->isVisible() )
+            continue;
+
+        // Only if the parent or one of the children uses that image
+        bool affected = _backgrounds.value( parent->objectName() ).filename == filename;
+
+        foreach( QWidget * child, it.value() )
+        {
+            if ( _backgrounds.value( child->objectName() ).filename == filename )
+                affected = true;
+        }
+
+        if ( affected )
+            renderParent( parent );
+    }
+}
+
+
 void QY2Styler::renderParent( QWidget * wid )
 {
     // yuiDebug() << "Rendering " << wid << endl;
@@ -344,15 +569,7 @@ void QY2Styler::renderParent( QWidget * wid )
     if ( _backgrounds[name].full )
         fillRect = wid->rect();
 
-    QImage back;
-
-    if ( _backgrounds[name].lastscale != fillRect.size() )
-    {
-        _backgrounds[name].scaled = getScaled( name, fillRect.size() );
-        _backgrounds[name].lastscale = fillRect.size();
-    }
-
-    back = _backgrounds[name].scaled;
+    QImage back = getScaled( name, fillRect.size() );
 
     QPainter pain( &back );
     QWidget *child;
@@ -379,8 +596,12 @@ void QY2Styler::renderParent( QWidget * wid )
         }
 	else
 	{
-            scaled = QPixmap::fromImage( getScaled( name, fillRect.size() ) );
-            QPixmapCache::insert( key, scaled );
+            bool smooth;
+            scaled = QPixmap::fromImage( getScaled( name, fillRect.size(), &smooth ) );
+
+            // The placeholder is replaced as soon as the smooth version is ready
+            if ( smooth )
+                QPixmapCache::insert( key, scaled );
         }
         pain.drawPixmap( wid->mapFromGlobal( child->mapToGlobal( fillRect.topLeft() ) ), scaled );
     }
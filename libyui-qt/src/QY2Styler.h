@@ -31,10 +31,13 @@
 #include <QString>
 #include <QImage>
 #include <QMap>
+#include <QStringList>
 
 #define HIGH_CONTRAST_STYLE_SHEET "highcontrast.qss"
 #define DEFAULT_STYLE_SHEET "style.qss"
 
+class QY2BackgroundScaler;
+
 class QY2Styler : public QObject
 {
     Q_OBJECT
@@ -156,16 +159,37 @@ public:
 
     bool updateRendering( QWidget *wid );
 
+protected slots:
+
+    /**
+     * Render the backgrounds again after the smooth version of a
+     * background image is ready.
+     */
+    void slotScaledImageReady( const QString & filename );
+
 protected:
     void renderParent( QWidget *wid );
-    QImage getScaled( const QString name, const QSize & size );
+
+    /**
+     * Returns the background image for widgets named 'name' scaled to
+     * 'size': The smooth version if it is ready, otherwise a fast scaled
+     * placeholder (and 'smooth' is set to false if it is not 0).
+     */
+    QImage getScaled( const QString name, const QSize & size, bool * smooth = 0 );
 
     /**
      * Search and replace some self-defined macros in the style sheet.
      * Among other things, expands the file name inside url( filename.png ) in
      * the style sheet with the full path.
+     *
+     * The files read here are added to 'files' if it is not 0.
      **/
-    void processUrls( QString & text );
+    void processUrls( QString & text, QStringList * files = 0 );
+
+    /**
+     * Apply the current style sheet to the registered widgets.
+     */
+    void applyStyleSheet();
 
     /**
      * Build a stylesheet from a string.
@@ -202,11 +226,58 @@ private:
     {
 	QString filename;
 	QImage pix;
-        QImage scaled;
-        QSize lastscale;
 	bool full;
     };
 
+    /**
+     * A style sheet with all imports and macros resolved, and the files it
+     * was built from with their modification times (msec since the epoch,
+     * -1 if missing).
+     */
+    struct CompiledStyleSheet
+    {
+        QString style;
+        QString textStyle;
+        QHash<QString, BackgrInfo> backgrounds;	// without images
+        QHash<QString, qint64> files;
+    };
+
+    /**
+     * Find the compiled version of style sheet 'filename' in memory or in
+     * the on-disk cache. Returns false if there is none or if any of its
+     * files changed.
+     */
+    bool findCompiledStyleSheet( const QString & filename, CompiledStyleSheet & compiled );
+
+    /**
+     * Remember the compiled version of style sheet 'filename' in memory
+     * and in the on-disk cache.
+     */
+    void storeCompiledStyleSheet( const QString & filename, const CompiledStyleSheet & compiled );
+
+    /**
+     * Returns true if none of the files of 'compiled' changed.
+     */
+    bool isUpToDate( const CompiledStyleSheet & compiled ) const;
+
+    /**
+     * Returns the modification time of 'path' in msec since the epoch
+     * or -1 if it does not exist.
+     */
+    static qint64 modificationTime( const QString & path );
+
+    /**
+     * Returns the path of the on-disk cache file for style sheet
+     * 'filename' or an empty string if there is no cache directory.
+     */
+    QString compiledStyleSheetPath( const QString & filename ) const;
+
+    bool readCompiledStyleSheet( const QString & path, CompiledStyleSheet & compiled ) const;
+    void writeCompiledStyleSheet( const QString & path, const CompiledStyleSheet & compiled ) const;
+
+    QY2BackgroundScaler * _scaler;
+    QHash<QString, CompiledStyleSheet> _compiledStyleSheets;
+
     QHash<QString,BackgrInfo> _backgrounds;
     QMap<QWidget*, QList< QWidget* > > _children;
     // remember all registered widgets to allow styling not only for
@@ -0,0 +1,279 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQColumnSizer.cc
+
+/-*/
+
+
+#define YUILogComponent "qt-ui"
+#include <yui/YUILog.h>
+
+#include <stdlib.h>	// getenv()
+#include <algorithm>
+#include <vector>
+
+#include <QFontMetrics>
+#include <QHeaderView>
+#include <QStyle>
+#include <QTreeView>
+
+#include <yui/YTable.h>
+#include <yui/YTableItem.h>
+
+#include "utf8.h"
+#include "YQColumnSizer.h"
+
+// Number of the first and of the last rows of a batch that are measured
+#define SAMPLE_ROWS	50
+
+// Space between an icon and the text
+#define ICON_SPACING	4
+
+using std::endl;
+
+
+namespace
+{
+    /**
+     * The cell with the longest label of a column among the rows that are
+     * not measured.
+     **/
+    struct LongestCell
+    {
+	LongestCell(): cell( 0 ), length( 0 ), depth( 0 ) {}
+
+	const YTableCell *	cell;
+	size_t			length;
+	int			depth;
+    };
+
+
+    /**
+     * Find the longest label of each column in the items 'begin' to 'end'
+     * and their children. Comparing the lengths is much cheaper than
+     * measuring the text.
+     **/
+    void findLongestCells( YItemConstIterator		begin,
+			   YItemConstIterator		end,
+			   int				depth,
+			   std::vector<LongestCell> &	longest )
+    {
+	for ( YItemConstIterator it = begin; it != end; ++it )
+	{
+	    const YTableItem * item = dynamic_cast<const YTableItem *>( *it );
+
+	    if ( ! item )
+		continue;
+
+	    for ( YTableCellConstIterator cellIt = item->cellsBegin(); cellIt != item->cellsEnd(); ++cellIt )
+	    {
+		const YTableCell * cell = *cellIt;
+		int column = cell->column();
+
+		if ( column < 0 || column >= (int) longest.size() )
+		    continue;
+
+		size_t length = cell->label().size();
+
+		if ( length > longest[ column ].length || ! longest[ column ].cell )
+		{
+		    longest[ column ].cell   = cell;
+		    longest[ column ].length = length;
+		    longest[ column ].depth  = depth;
+		}
+	    }
+
+	    if ( item->hasChildren() )
+		findLongestCells( item->childrenBegin(), item->childrenEnd(), depth + 1, longest );
+	}
+    }
+}
+
+
+YQColumnSizer::YQColumnSizer( QTreeView * view, YTable * table )
+    : _view( view )
+    , _table( table )
+    , _exact( getenv( "YQ_EXACT_COLUMN_WIDTHS" ) != 0 )
+    , _measuredCells( 0 )
+{
+    reset();
+}
+
+
+YQColumnSizer::~YQColumnSizer()
+{
+    // NOP
+}
+
+
+void
+YQColumnSizer::reset()
+{
+    _widths.fill( 0, _table->columns() );
+}
+
+
+void
+YQColumnSizer::itemsAdded( YItemConstIterator begin, YItemConstIterator end )
+{
+    int measuredBefore = _measuredCells;
+    QFontMetrics metrics( _view->font() );
+
+    measureItems( metrics, begin, end, 0 );
+
+    yuiDebug() << "Measured " << _measuredCells - measuredBefore << " cells of "
+	       << end - begin << " new toplevel items" << endl;
+}
+
+
+void
+YQColumnSizer::cellChanged( const YTableCell * cell )
+{
+    QFontMetrics metrics( _view->font() );
+
+    measureCell( metrics, cell, depth( cell->parent() ) );
+}
+
+
+void
+YQColumnSizer::measureItems( const QFontMetrics & metrics,
+			     YItemConstIterator	  begin,
+			     YItemConstIterator	  end,
+			     int		  depth )
+{
+    int count = end - begin;
+
+    if ( _exact || count <= 2 * SAMPLE_ROWS )
+    {
+	for ( YItemConstIterator it = begin; it != end; ++it )
+	    measureItem( metrics, *it, depth );
+
+	return;
+    }
+
+    // The first and the last rows are the ones the user sees first
+
+    for ( YItemConstIterator it = begin; it != begin + SAMPLE_ROWS; ++it )
+	measureItem( metrics, *it, depth );
+
+    for ( YItemConstIterator it = end - SAMPLE_ROWS; it != end; ++it )
+	measureItem( metrics, *it, depth );
+
+    // Of the rows in between, only the longest label of each column
+
+    std::vector<LongestCell> longest( _widths.size() );
+    findLongestCells( begin + SAMPLE_ROWS, end - SAMPLE_ROWS, depth, longest );
+
+    for ( const LongestCell & candidate: longest )
+    {
+	if ( candidate.cell )
+	    measureCell( metrics, candidate.cell, candidate.depth );
+    }
+}
+
+
+void
+YQColumnSizer::measureItem( const QFontMetrics & metrics, YItem * item, int depth )
+{
+    YTableItem * tableItem = dynamic_cast<YTableItem *>( item );
+
+    if ( ! tableItem )
+	return;
+
+    for ( YTableCellConstIterator it = tableItem->cellsBegin(); it != tableItem->cellsEnd(); ++it )
+	measureCell( metrics, *it, depth );
+
+    if ( item->hasChildren() )
+	measureItems( metrics, item->childrenBegin(), item->childrenEnd(), depth + 1 );
+}
+
+
+void
+YQColumnSizer::measureCell( const QFontMetrics & metrics, const YTableCell * cell, int depth )
+{
+    int column = cell->column();
+
+    if ( column < 0 || column >= _widths.size() )
+	return;
+
+    _measuredCells++;
+
+    // Same margins as QStyledItemDelegate
+
+    QStyle * style = _view->style();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    int width = metrics.horizontalAdvance( fromUTF8( cell->label() ) );
+#else
+    int width = metrics.width( fromUTF8( cell->label() ) );
+#endif
+    width += 2 * ( style->pixelMetric( QStyle::PM_FocusFrameHMargin, 0, _view ) + 1 );
+
+    if ( cell->hasIconName() )
+	width += style->pixelMetric( QStyle::PM_SmallIconSize, 0, _view ) + ICON_SPACING;
+
+    if ( column == 0 )
+	width += depth * _view->indentation();
+
+    _widths[ column ] = std::max( _widths[ column ], width );
+}
+
+
+int
+YQColumnSizer::width( int column ) const
+{
+    return column >= 0 && column < _widths.size() ? _widths[ column ] : 0;
+}
+
+
+void
+YQColumnSizer::apply( int column )
+{
+    QHeaderView * header = _view->header();
+
+    for ( int col = 0; col < _widths.size(); col++ )
+    {
+	if ( column >= 0 && col != column )
+	    continue;
+
+	int sectionWidth = _widths[ col ];
+
+	if ( col == 0 && _view->rootIsDecorated() )
+	    sectionWidth += _view->indentation();
+
+	if ( ! header->isHidden() )
+	    sectionWidth = std::max( sectionWidth, header->sectionSizeHint( col ) );
+
+	header->resizeSection( col, sectionWidth );
+    }
+}
+
+
+int
+YQColumnSizer::depth( const YItem * item )
+{
+    int itemDepth = 0;
+
+    while ( item && item->parent() )
+    {
+	item = item->parent();
+	itemDepth++;
+    }
+
+    return itemDepth;
+}
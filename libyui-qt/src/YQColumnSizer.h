@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQColumnSizer.h
+
+/-*/
+
+#ifndef YQColumnSizer_h
+#define YQColumnSizer_h
+
+#include <QVector>
+
+#include <yui/YItem.h>
+
+class QFontMetrics;
+class QTreeView;
+class YTable;
+class YTableCell;
+
+
+/**
+ * Column widths of a YQTable, calculated from the table items.
+ *
+ * QTreeView::resizeColumnToContents() measures the rows again each time
+ * it is called. This keeps the widest width of each column seen so far
+ * instead and measures only the items that are added or changed, and of a
+ * large batch of new items only a bounded sample: The first and the last
+ * rows and the cell with the longest text of each column.
+ *
+ * The widths only grow until reset(): A changed cell that was the widest one
+ * so far is not measured again if it became narrower.
+ **/
+class YQColumnSizer
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * Exact sizing is enabled if the environment variable
+     * YQ_EXACT_COLUMN_WIDTHS is set.
+     **/
+    YQColumnSizer( QTreeView * view, YTable * table );
+
+    /**
+     * Destructor.
+     **/
+    virtual ~YQColumnSizer();
+
+    /**
+     * Measure all new items instead of a sample of them.
+     **/
+    void setExact( bool exact ) { _exact = exact; }
+
+    /**
+     * Return 'true' if all new items are measured.
+     **/
+    bool exact() const { return _exact; }
+
+    /**
+     * Forget all widths, e.g. after all items were deleted.
+     **/
+    void reset();
+
+    /**
+     * Notification that the toplevel items 'begin' to 'end' (and their
+     * children) were added.
+     **/
+    void itemsAdded( YItemConstIterator begin, YItemConstIterator end );
+
+    /**
+     * Notification that 'cell' changed.
+     **/
+    void cellChanged( const YTableCell * cell );
+
+    /**
+     * Return the width needed for the content of 'column' (without the
+     * header).
+     **/
+    int width( int column ) const;
+
+    /**
+     * Resize 'column' of the view (-1 for all columns) to the width of its
+     * content and its header.
+     **/
+    void apply( int column = -1 );
+
+    /**
+     * Return the number of the cells measured so far.
+     **/
+    int measuredCells() const { return _measuredCells; }
+
+
+protected:
+
+    /**
+     * Measure the items 'begin' to 'end' and their children at 'depth',
+     * or only a sample of them if there are many and the sizing is not
+     * exact.
+     **/
+    void measureItems( const QFontMetrics & metrics,
+		       YItemConstIterator  begin,
+		       YItemConstIterator  end,
+		       int		   depth );
+
+    /**
+     * Measure all cells of 'item' at 'depth' (0 for toplevel items).
+     **/
+    void measureItem( const QFontMetrics & metrics, YItem * item, int depth );
+
+    /**
+     * Measure 'cell' of an item at 'depth'.
+     **/
+    void measureCell( const QFontMetrics & metrics, const YTableCell * cell, int depth );
+
+    /**
+     * Return the depth of 'item' in the item tree (0 for toplevel items).
+     **/
+    static int depth( const YItem * item );
+
+    //
+    // Data members
+    //
+
+    QTreeView *		_view;
+    YTable *		_table;
+    bool		_exact;
+    int			_measuredCells;
+    QVector<int>	_widths;
+};
+
+
+#endif // YQColumnSizer_h
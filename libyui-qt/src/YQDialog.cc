@@ -31,6 +31,7 @@
 #include <yui/YApplication.h>
 #include <yui/YDialogSpy.h>
 #include <yui/YEvent.h>
+#include <yui/YStartupProfiler.h>
 
 #include <QPushButton>
 #include <QMessageBox>
@@ -41,6 +42,7 @@
 
 #include "YQDialog.h"
 #include "YQGenericButton.h"
+#include "YQLayoutScheduler.h"
 #include "YQMainWinDock.h"
 #include "YQUI.h"
 #include "YQWizard.h"
@@ -127,6 +129,8 @@ YQDialog::YQDialog( YDialogType 	dialogType,
 
 YQDialog::~YQDialog()
 {
+    YQUI::ui()->layoutScheduler()->cancel( this );
+
     if ( isMainDialog() )
     {
 	YQMainWinDock::mainWinDock()->remove( this );
@@ -175,6 +179,9 @@ YQDialog::chooseParent( YDialogType dialogType )
 void
 YQDialog::openInternal()
 {
+    // The initial layout has just been calculated
+    YQUI::ui()->layoutScheduler()->cancel( this );
+
     ensureOnlyOneDefaultButton();
     QWidget::show();
     QWidget::raise(); // FIXME: is this really necessary?
@@ -281,6 +288,27 @@ YQDialog::setSize( int newWidth, int newHeight )
 }
 
 
+void
+YQDialog::requestLayout()
+{
+    YQUI::ui()->layoutScheduler()->scheduleLayout( this );
+}
+
+
+void
+YQDialog::startMultipleChanges()
+{
+    YQUI::ui()->layoutScheduler()->suspend();
+}
+
+
+void
+YQDialog::doneMultipleChanges()
+{
+    YQUI::ui()->layoutScheduler()->resume();
+}
+
+
 void
 YQDialog::resizeEvent( QResizeEvent * event )
 {
@@ -296,6 +324,14 @@ YQDialog::resizeEvent( QResizeEvent * event )
 }
 
 
+void
+YQDialog::paintEvent( QPaintEvent * event )
+{
+    QWidget::paintEvent( event );
+    YStartupProfiler::dialogPainted();
+}
+
+
 YQGenericButton *
 YQDialog::findDefaultButton()
 {
@@ -767,6 +803,7 @@ YEvent *
 YQDialog::waitForEventInternal( int timeout_millisec )
 {
     YQUI::ui()->forceUnblockEvents();
+    YQUI::ui()->layoutScheduler()->flush();
     _eventLoop->wakeUp();
 
     YEvent * event  = 0;
@@ -816,6 +853,7 @@ YQDialog::waitForEventInternal( int timeout_millisec )
 YEvent *
 YQDialog::pollEventInternal()
 {
+    YQUI::ui()->layoutScheduler()->flush();
     _eventLoop->wakeUp();
 
     YEvent * event = 0;
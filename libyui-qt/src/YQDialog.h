@@ -46,6 +46,8 @@ class YQDialog : public QWidget, public YDialog
 {
     Q_OBJECT
 
+    friend class YQLayoutScheduler;
+
 public:
     /**
      * Constructor.
@@ -108,6 +110,22 @@ public:
      **/
     virtual void setSize( int newWidth, int newHeight );
 
+    /**
+     * Notification that the application is going to perform multiple
+     * changes: Defer the pending layout passes and column resizes until
+     * doneMultipleChanges().
+     *
+     * Reimplemented from YWidget.
+     **/
+    virtual void startMultipleChanges();
+
+    /**
+     * Notification that the multiple changes are done.
+     *
+     * Reimplemented from YWidget.
+     **/
+    virtual void doneMultipleChanges();
+
     /**
      * Return this dialog's (first) default button or 0 if none
      **/
@@ -267,6 +285,14 @@ protected:
      **/
     virtual YEvent * pollEventInternal();
 
+    /**
+     * Request a new layout calculation: This is deferred to the next
+     * event loop iteration, so several requests result in one layout pass.
+     *
+     * Reimplemented from YDialog.
+     **/
+    virtual void requestLayout();
+
     /**
      * Activate this dialog: Make sure that it is shown as the topmost dialog
      * of this application and that it can receive input.
@@ -283,6 +309,7 @@ protected:
     virtual void keyPressEvent	( QKeyEvent	* event );
     virtual void focusInEvent	( QFocusEvent	* event );
     virtual void resizeEvent	( QResizeEvent	* event );
+    virtual void paintEvent	( QPaintEvent	* event );
 
 
     //
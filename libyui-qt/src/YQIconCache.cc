@@ -0,0 +1,244 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQIconCache.cc
+
+/-*/
+
+
+#define YUILogComponent "qt-ui"
+#include <yui/YUILog.h>
+#include <yui/YUIException.h>
+
+#include <QApplication>
+
+#include "utf8.h"
+#include "YQIconCache.h"
+
+// Maximum size of the cached pixmaps
+#define MAX_PIXMAP_CACHE_KB	( 32 * 1024 )
+
+using std::string;
+using std::endl;
+
+
+YQIconCache::YQIconCache( QObject * parent )
+    : QObject( parent )
+    , _hits( 0 )
+    , _misses( 0 )
+{
+    _pixmaps.setMaxCost( MAX_PIXMAP_CACHE_KB );
+}
+
+
+YQIconCache::~YQIconCache()
+{
+    yuiDebug() << "Icon cache: " << _hits << " hits, " << _misses << " misses" << endl;
+}
+
+
+YQIconCache *
+YQIconCache::iconCache()
+{
+    static YQIconCache * iconCache = 0;
+
+    if ( ! iconCache )
+    {
+	iconCache = new YQIconCache( qApp );
+	YUI_CHECK_NEW( iconCache );
+    }
+
+    return iconCache;
+}
+
+
+QIcon
+YQIconCache::icon( const string & name )
+{
+    QString key = fromUTF8( name );
+    QHash<QString, QIcon>::const_iterator it = _icons.constFind( key );
+
+    if ( it != _icons.constEnd() )
+    {
+	_hits++;
+	return it.value();
+    }
+
+    _misses++;
+
+    QIcon icon = loadIcon( name );
+    _icons.insert( key, icon );
+
+    return icon;
+}
+
+
+QIcon
+YQIconCache::fileIcon( const string & path )
+{
+    QString key = fromUTF8( path );
+    QHash<QString, QIcon>::const_iterator it = _fileIcons.constFind( key );
+
+    if ( it != _fileIcons.constEnd() )
+    {
+	_hits++;
+	return it.value();
+    }
+
+    _misses++;
+
+    QIcon icon( key );
+    _fileIcons.insert( key, icon );
+
+    return icon;
+}
+
+
+QPixmap
+YQIconCache::pixmap( const string &	name,
+		     const QSize &	size,
+		     QIcon::Mode	mode,
+		     QIcon::State	state )
+{
+    QString key = QString( "icon:%1:%2x%3:%4:%5" )
+	.arg( fromUTF8( name ) )
+	.arg( size.width() ).arg( size.height() )
+	.arg( (int) mode ).arg( (int) state );
+
+    const QPixmap * cached = cachedPixmap( key );
+
+    if ( cached )
+	return *cached;
+
+    QIcon iconFound = icon( name );
+    QPixmap pixmap;
+
+    if ( ! iconFound.isNull() )
+	pixmap = iconFound.pixmap( size, mode, state );
+
+    cachePixmap( key, pixmap );
+
+    return pixmap;
+}
+
+
+QPixmap
+YQIconCache::filePixmap( const string & path, const QSize & size, QIcon::Mode mode )
+{
+    QString key = QString( "file:%1:%2x%3:%4" )
+	.arg( fromUTF8( path ) )
+	.arg( size.width() ).arg( size.height() )
+	.arg( (int) mode );
+
+    const QPixmap * cached = cachedPixmap( key );
+
+    if ( cached )
+	return *cached;
+
+    QPixmap pixmap;
+
+    if ( mode != QIcon::Normal )
+    {
+	pixmap = filePixmap( path, size );
+
+	if ( ! pixmap.isNull() )
+	    pixmap = QIcon( pixmap ).pixmap( pixmap.size(), mode, QIcon::Off );
+    }
+    else if ( size.isValid() )
+    {
+	// Scale the cached original, not the file again
+	pixmap = filePixmap( path );
+
+	if ( ! pixmap.isNull() )
+	    pixmap = pixmap.scaled( size, Qt::KeepAspectRatio );
+    }
+    else
+    {
+	pixmap = QPixmap( fromUTF8( path ) );
+    }
+
+    cachePixmap( key, pixmap );
+
+    return pixmap;
+}
+
+
+const QPixmap *
+YQIconCache::cachedPixmap( const QString & key )
+{
+    const QPixmap * pixmap = _pixmaps.object( key );
+
+    if ( pixmap )
+	_hits++;
+    else
+	_misses++;
+
+    return pixmap;
+}
+
+
+void
+YQIconCache::cachePixmap( const QString & key, const QPixmap & pixmap )
+{
+    int costKB = 1;
+
+    if ( ! pixmap.isNull() )
+	costKB += pixmap.width() * pixmap.height() * pixmap.depth() / 8 / 1024;
+
+    _pixmaps.insert( key, new QPixmap( pixmap ), costKB );
+}
+
+
+void
+YQIconCache::clear()
+{
+    _icons.clear();
+    _fileIcons.clear();
+    _pixmaps.clear();
+}
+
+
+QIcon
+YQIconCache::loadIcon( const string & iconName ) const
+{
+    QIcon icon;
+    const QString resource = ":/";
+
+    if ( QIcon::hasThemeIcon( iconName.c_str() ) )
+    {
+	yuiDebug() << "Trying theme icon from: " << iconName << endl;
+	icon = QIcon::fromTheme( iconName.c_str() );
+    }
+
+    if ( icon.isNull() )
+    {
+	yuiDebug() << "Trying icon from resource: " << iconName << endl;
+	icon = QIcon( resource + iconName.c_str() );
+    }
+
+    if ( icon.isNull() )
+    {
+	yuiDebug() << "Trying icon from path: " << iconName << endl;
+	icon = QIcon( iconName.c_str() );
+    }
+
+    if ( icon.isNull() )
+	yuiWarning() << "Couldn't load icon: " << iconName << endl;
+
+    return icon;
+}
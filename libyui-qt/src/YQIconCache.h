@@ -0,0 +1,147 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQIconCache.h
+
+/-*/
+
+#ifndef YQIconCache_h
+#define YQIconCache_h
+
+#include <string>
+
+#include <QCache>
+#include <QHash>
+#include <QIcon>
+#include <QObject>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+
+
+/**
+ * Process-wide cache for the icons and pixmaps of the Qt UI.
+ *
+ * Looking up an icon in the icon theme, the Qt resources and the file system
+ * is expensive, yet the same few icons are used for many items. Each icon is
+ * looked up only once, and icons that could not be found are remembered
+ * as well. The pixmaps rendered from them are cached by name, size, mode
+ * and state.
+ **/
+class YQIconCache : public QObject
+{
+    Q_OBJECT
+
+protected:
+
+    /**
+     * Constructor. Use the static iconCache() function instead.
+     **/
+    YQIconCache( QObject * parent );
+
+public:
+
+    /**
+     * Destructor.
+     **/
+    virtual ~YQIconCache();
+
+    /**
+     * Return the singleton of this class; create it if it does not
+     * exist yet.
+     **/
+    static YQIconCache * iconCache();
+
+    /**
+     * Return icon 'name' from the icon theme, the Qt resources or the file
+     * system (see YQUI::loadIcon()) or a null icon if there is none.
+     **/
+    QIcon icon( const std::string & name );
+
+    /**
+     * Return the icon from file 'path' only, without trying the icon theme
+     * or the Qt resources, or a null icon if there is none.
+     **/
+    QIcon fileIcon( const std::string & path );
+
+    /**
+     * Return a pixmap of icon 'name' (see icon()) with 'size' in 'mode'
+     * and 'state' or a null pixmap if there is no such icon.
+     **/
+    QPixmap pixmap( const std::string & name,
+		    const QSize &	size,
+		    QIcon::Mode		mode  = QIcon::Normal,
+		    QIcon::State	state = QIcon::Off );
+
+    /**
+     * Return the image in file 'path' as a pixmap, scaled to fit into 'size'
+     * keeping its aspect ratio if 'size' is valid, in 'mode' (e.g. greyed
+     * out for QIcon::Disabled), or a null pixmap if the image cannot be
+     * loaded.
+     **/
+    QPixmap filePixmap( const std::string & path,
+			const QSize &	    size = QSize(),
+			QIcon::Mode	    mode = QIcon::Normal );
+
+    /**
+     * Forget all icons and pixmaps, e.g. after the icon theme changed.
+     **/
+    void clear();
+
+    /**
+     * Return the number of the lookups answered from the cache.
+     **/
+    int hits() const { return _hits; }
+
+    /**
+     * Return the number of the lookups that had to load an icon or pixmap.
+     **/
+    int misses() const { return _misses; }
+
+
+protected:
+
+    /**
+     * Look up icon 'name' without the cache.
+     **/
+    QIcon loadIcon( const std::string & name ) const;
+
+    /**
+     * Return the cached pixmap for 'key' or 0 if there is none yet.
+     * Update the statistics.
+     **/
+    const QPixmap * cachedPixmap( const QString & key );
+
+    /**
+     * Add 'pixmap' (also a null pixmap) to the cache for 'key'.
+     **/
+    void cachePixmap( const QString & key, const QPixmap & pixmap );
+
+    //
+    // Data members
+    //
+
+    QHash<QString, QIcon>	_icons;		// null icons for the misses
+    QHash<QString, QIcon>	_fileIcons;	// dito
+    QCache<QString, QPixmap>	_pixmaps;	// cost: KB
+    int				_hits;
+    int				_misses;
+};
+
+
+#endif // YQIconCache_h
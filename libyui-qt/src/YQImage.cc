@@ -33,6 +33,7 @@
 
 #include "utf8.h"
 #include "YQUI.h"
+#include "YQIconCache.h"
 #include "YQImage.h"
 
 using std::string;
@@ -94,13 +95,17 @@ YQImage::setImage( const string & fileName, bool animated )
             yuiDebug() << "Loading pixmap from absolute path: \""
                        << imageFileName() << "\"" << endl;
 
-            pixmap = QPixmap( fromUTF8 ( imageFileName() ) );
+            pixmap = YQIconCache::iconCache()->filePixmap( imageFileName(),
+                                                           autoScale() ? size() : QSize() );
         }
         else
         {
             yuiDebug() << "Using icon loader for \"" << imageFileName() << "\"" << endl;
 
-            pixmap = YQUI::ui()->loadIcon( imageFileName() ).pixmap( 22 );
+            pixmap = YQIconCache::iconCache()->pixmap( imageFileName(), QSize( 22, 22 ) );
+
+            if ( autoScale() && ! pixmap.isNull() )
+                pixmap = pixmap.scaled( size(), Qt::KeepAspectRatio );
         }
 
         if ( pixmap.isNull() )
@@ -110,13 +115,6 @@ YQImage::setImage( const string & fileName, bool animated )
         }
         else
         {
-            if ( autoScale() )
-            {
-                QImage scaledImg = pixmap.toImage();
-                scaledImg = scaledImg.scaled( this->width(), this->height(), Qt::KeepAspectRatio );
-                pixmap = pixmap.fromImage( scaledImg );
-            }
-
             _pixmapWidth  = pixmap.size().width();
             _pixmapHeight = pixmap.size().height();
 
@@ -200,9 +198,7 @@ void YQImage::setEnabled( bool enable )
     else
     {
 	// Trigger image re-display
-	QPixmap pixmap( fromUTF8( imageFileName() ) );
-	QIcon icon(pixmap);
-	QLabel::setPixmap( icon.pixmap( pixmap.size(), QIcon::Disabled, QIcon::Off) );
+	QLabel::setPixmap( YQIconCache::iconCache()->filePixmap( imageFileName(), QSize(), QIcon::Disabled ) );
     }
 }
 
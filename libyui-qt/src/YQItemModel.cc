@@ -0,0 +1,829 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQItemModel.cc
+
+/-*/
+
+
+#define YUILogComponent "qt-ui"
+#include <yui/YUILog.h>
+
+#include <algorithm>
+
+#include <QHeaderView>
+#include <QTimer>
+
+#include <yui/YTable.h>
+#include <yui/YTableItem.h>
+#include <yui/YUIException.h>
+
+#include "utf8.h"
+#include "YQColumnSizer.h"
+#include "YQIconCache.h"
+#include "YQItemModel.h"
+
+// Number of the toplevel rows made available to the view at once
+#define FETCH_CHUNK_SIZE	500
+
+using std::endl;
+
+
+namespace
+{
+    /**
+     * Sort key of an item, converted only once for all comparisons.
+     **/
+    struct SortEntry
+    {
+	QString		key;
+	qlonglong	number;
+	bool		isNumber;
+	YItem *		item;
+    };
+
+
+    /**
+     * Same order as QY2ListViewItem::compare(): Numbers before strings,
+     * numbers by value, strings locale aware.
+     **/
+    bool lessThan( const SortEntry & a, const SortEntry & b )
+    {
+	if ( a.isNumber && b.isNumber )
+	    return a.number < b.number;
+
+	if ( a.isNumber != b.isNumber )
+	    return a.isNumber;
+
+	return QString::localeAwareCompare( a.key, b.key ) < 0;
+    }
+}
+
+
+YQItemModel::YQItemModel( YSelectionWidget * widget, int columns, QObject * parent )
+    : QAbstractItemModel( parent )
+    , _widget( widget )
+    , _table( dynamic_cast<YTable *>( widget ) )
+    , _columns( columns )
+    , _checkable( false )
+    , _fetched( 0 )
+    , _sortColumn( -1 )
+    , _sortOrder( Qt::AscendingOrder )
+    , _resortPending( false )
+{
+    YUI_CHECK_PTR( _widget );
+}
+
+
+YQItemModel::~YQItemModel()
+{
+    // NOP
+}
+
+
+YItem *
+YQItemModel::item( const QModelIndex & index ) const
+{
+    if ( ! index.isValid() )
+	return 0;
+
+    return static_cast<YItem *>( index.internalPointer() );
+}
+
+
+YItem *
+YQItemModel::childAt( YItem * parent, int row ) const
+{
+    if ( row < 0 )
+	return 0;
+
+    QHash<YItem *, std::vector<YItem *> >::const_iterator sorted = _sorted.constFind( parent );
+
+    if ( sorted != _sorted.constEnd() )
+	return row < (int) sorted.value().size() ? sorted.value()[ row ] : 0;
+
+    if ( ! parent )
+	return _widget->itemAt( row );
+
+    if ( row >= childCount( parent ) )
+	return 0;
+
+    return *( parent->childrenBegin() + row );
+}
+
+
+int
+YQItemModel::childCount( YItem * parent ) const
+{
+    if ( ! parent )
+	return _widget->itemsCount();
+
+    return parent->childrenEnd() - parent->childrenBegin();
+}
+
+
+int
+YQItemModel::rowOf( YItem * item ) const
+{
+    YItem * parent = item->parent();
+
+    // The toplevel items know their position in the widget's items
+    if ( ! parent && _sortColumn < 0 && _widget->itemAt( item->index() ) == item )
+	return item->index();
+
+    QHash<YItem *, int>::const_iterator cached = _rowCache.constFind( item );
+
+    if ( cached != _rowCache.constEnd() )
+	return cached.value();
+
+    // Cache the rows of all siblings at once, they are likely needed soon
+
+    int count = childCount( parent );
+    int row   = -1;
+
+    for ( int i = 0; i < count; i++ )
+    {
+	YItem * child = childAt( parent, i );
+	_rowCache.insert( child, i );
+
+	if ( child == item )
+	    row = i;
+    }
+
+    return row;
+}
+
+
+bool
+YQItemModel::isFetched( YItem * item ) const
+{
+    while ( item->parent() )
+	item = item->parent();
+
+    int row = rowOf( item );
+
+    return row >= 0 && row < _fetched;
+}
+
+
+QModelIndex
+YQItemModel::indexOf( YItem * item, int column, bool fetch )
+{
+    if ( ! item )
+	return QModelIndex();
+
+    YItem * toplevel = item;
+
+    while ( toplevel->parent() )
+	toplevel = toplevel->parent();
+
+    int toplevelRow = rowOf( toplevel );
+
+    if ( toplevelRow < 0 )
+	return QModelIndex();
+
+    if ( toplevelRow >= _fetched )
+    {
+	if ( ! fetch )
+	    return QModelIndex();
+
+	beginInsertRows( QModelIndex(), _fetched, toplevelRow );
+	_fetched = toplevelRow + 1;
+	endInsertRows();
+    }
+
+    int row = ( item == toplevel ) ? toplevelRow : rowOf( item );
+
+    return createIndex( row, column, item );
+}
+
+
+void
+YQItemModel::itemsAdded()
+{
+    int total = _widget->itemsCount();
+
+    if ( _sortColumn >= 0 )
+    {
+	// Append the new items for now and sort them in later
+
+	std::vector<YItem *> & toplevel = _sorted[ 0 ];
+
+	for ( int i = toplevel.size(); i < total; i++ )
+	    toplevel.push_back( _widget->itemAt( i ) );
+
+	if ( ! _resortPending )
+	{
+	    _resortPending = true;
+	    QTimer::singleShot( 0, this, &pclass(this)::slotResort );
+	}
+    }
+
+    // Provide the first rows right away, the view fetches more on demand
+
+    if ( _fetched < FETCH_CHUNK_SIZE && _fetched < total )
+	fetchMore( QModelIndex() );
+}
+
+
+void
+YQItemModel::beginReset()
+{
+    beginResetModel();
+
+    _fetched = 0;
+    _sorted.clear();
+    _rowCache.clear();
+}
+
+
+void
+YQItemModel::endReset()
+{
+    _fetched = std::min( FETCH_CHUNK_SIZE, _widget->itemsCount() );
+
+    if ( _sortColumn >= 0 )
+	sortChildren( 0 );
+
+    endResetModel();
+}
+
+
+void
+YQItemModel::itemChanged( YItem * item, int column )
+{
+    QModelIndex first = indexOf( item, std::max( column, 0 ), false );
+
+    if ( ! first.isValid() )	// not fetched yet: nothing to update
+	return;
+
+    QModelIndex last = column < 0 ? first.sibling( first.row(), _columns - 1 ) : first;
+
+    emit dataChanged( first, last );
+}
+
+
+void
+YQItemModel::itemsChanged()
+{
+    childrenChanged( QModelIndex() );
+}
+
+
+void
+YQItemModel::childrenChanged( const QModelIndex & parent )
+{
+    int rows = rowCount( parent );
+
+    if ( rows < 1 )
+	return;
+
+    // dataChanged() covers only the rows below one parent,
+    // so the children of each row need a signal of their own
+
+    emit dataChanged( index( 0, 0, parent ), index( rows - 1, _columns - 1, parent ) );
+
+    for ( int row = 0; row < rows; row++ )
+    {
+	QModelIndex child = index( row, 0, parent );
+	YItem *     yitem = item( child );
+
+	if ( yitem && yitem->hasChildren() )
+	    childrenChanged( child );
+    }
+}
+
+
+QModelIndex
+YQItemModel::index( int row, int column, const QModelIndex & parent ) const
+{
+    if ( row < 0 || column < 0 || column >= _columns )
+	return QModelIndex();
+
+    if ( parent.isValid() && parent.column() != 0 )
+	return QModelIndex();
+
+    YItem * parentItem = item( parent );
+
+    if ( ! parentItem && row >= _fetched )
+	return QModelIndex();
+
+    YItem * child = childAt( parentItem, row );
+
+    return child ? createIndex( row, column, child ) : QModelIndex();
+}
+
+
+QModelIndex
+YQItemModel::parent( const QModelIndex & index ) const
+{
+    YItem * child = item( index );
+
+    if ( ! child || ! child->parent() )
+	return QModelIndex();
+
+    YItem * parentItem = child->parent();
+
+    return createIndex( rowOf( parentItem ), 0, parentItem );
+}
+
+
+int
+YQItemModel::rowCount( const QModelIndex & parent ) const
+{
+    if ( parent.column() > 0 )
+	return 0;
+
+    YItem * parentItem = item( parent );
+
+    return parentItem ? childCount( parentItem ) : _fetched;
+}
+
+
+int
+YQItemModel::columnCount( const QModelIndex & parent ) const
+{
+    return _columns;
+}
+
+
+bool
+YQItemModel::hasChildren( const QModelIndex & parent ) const
+{
+    if ( ! parent.isValid() )
+	return _fetched > 0;
+
+    if ( parent.column() > 0 )
+	return false;
+
+    return item( parent )->hasChildren();
+}
+
+
+QVariant
+YQItemModel::data( const QModelIndex & index, int role ) const
+{
+    YItem * yitem = item( index );
+
+    if ( ! yitem )
+	return QVariant();
+
+    switch ( role )
+    {
+	case Qt::DisplayRole:
+	    return text( yitem, index.column() );
+
+	case Qt::DecorationRole:
+	{
+	    QIcon itemIcon = icon( yitem, index.column() );
+
+	    if ( ! itemIcon.isNull() )
+		return itemIcon;
+
+	    break;
+	}
+
+	case Qt::TextAlignmentRole:
+	    if ( _table )
+	    {
+		switch ( _table->alignment( index.column() ) )
+		{
+		    case YAlignBegin:	return int( Qt::AlignLeft   | Qt::AlignVCenter );
+		    case YAlignCenter:	return int( Qt::AlignCenter | Qt::AlignVCenter );
+		    case YAlignEnd:	return int( Qt::AlignRight  | Qt::AlignVCenter );
+
+		    case YAlignUnchanged: break;
+		}
+	    }
+	    break;
+
+	case Qt::CheckStateRole:
+	    if ( _checkable && index.column() == 0 )
+		return yitem->selected() ? Qt::Checked : Qt::Unchecked;
+
+	    break;
+    }
+
+    return QVariant();
+}
+
+
+bool
+YQItemModel::setData( const QModelIndex & index, const QVariant & value, int role )
+{
+    YItem * yitem = item( index );
+
+    if ( ! yitem || role != Qt::CheckStateRole || ! _checkable )
+	return false;
+
+    emit checkStateToggled( yitem, value.toInt() == Qt::Checked );
+
+    return true;
+}
+
+
+QVariant
+YQItemModel::headerData( int section, Qt::Orientation orientation, int role ) const
+{
+    if ( _table && orientation == Qt::Horizontal && role == Qt::DisplayRole )
+	return fromUTF8( _table->header( section ) );
+
+    return QVariant();
+}
+
+
+Qt::ItemFlags
+YQItemModel::flags( const QModelIndex & index ) const
+{
+    if ( ! index.isValid() )
+	return Qt::NoItemFlags;
+
+    Qt::ItemFlags itemFlags = Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+
+    if ( _checkable && index.column() == 0 )
+	itemFlags |= Qt::ItemIsUserCheckable;
+
+    return itemFlags;
+}
+
+
+bool
+YQItemModel::canFetchMore( const QModelIndex & parent ) const
+{
+    return ! parent.isValid() && _fetched < _widget->itemsCount();
+}
+
+
+void
+YQItemModel::fetchMore( const QModelIndex & parent )
+{
+    if ( parent.isValid() )
+	return;
+
+    int count = std::min( FETCH_CHUNK_SIZE, _widget->itemsCount() - _fetched );
+
+    if ( count <= 0 )
+	return;
+
+    beginInsertRows( QModelIndex(), _fetched, _fetched + count - 1 );
+    _fetched += count;
+    endInsertRows();
+}
+
+
+void
+YQItemModel::sort( int column, Qt::SortOrder order )
+{
+    if ( column >= _columns )
+	column = -1;
+
+    emit layoutAboutToBeChanged();
+
+    QModelIndexList oldIndexes = persistentIndexList();
+
+    _sortColumn = column;
+    _sortOrder	= order;
+    _sorted.clear();
+    _rowCache.clear();
+
+    if ( _sortColumn >= 0 )
+	sortChildren( 0 );
+
+    // Keep the selection and the expanded items, but only for the rows
+    // that are still fetched
+
+    QModelIndexList newIndexes;
+
+    for ( const QModelIndex & oldIndex: oldIndexes )
+    {
+	YItem * yitem = item( oldIndex );
+
+	if ( yitem && isFetched( yitem ) )
+	    newIndexes << createIndex( rowOf( yitem ), oldIndex.column(), yitem );
+	else
+	    newIndexes << QModelIndex();
+    }
+
+    changePersistentIndexList( oldIndexes, newIndexes );
+
+    emit layoutChanged();
+}
+
+
+void
+YQItemModel::slotResort()
+{
+    if ( _resortPending && _sortColumn >= 0 )
+	sort( _sortColumn, _sortOrder );
+
+    _resortPending = false;
+}
+
+
+void
+YQItemModel::sortChildren( YItem * parent )
+{
+    YItemIterator begin = parent ? parent->childrenBegin() : _widget->itemsBegin();
+    YItemIterator end	= parent ? parent->childrenEnd()   : _widget->itemsEnd();
+
+    if ( begin == end )
+	return;
+
+    std::vector<SortEntry> entries;
+    entries.reserve( end - begin );
+
+    for ( YItemIterator it = begin; it != end; ++it )
+    {
+	SortEntry entry;
+	entry.key	= sortKey( *it, _sortColumn );
+	entry.number	= entry.key.toLongLong( &entry.isNumber );
+	entry.item	= *it;
+	entries.push_back( entry );
+    }
+
+    if ( _sortOrder == Qt::AscendingOrder )
+	std::stable_sort( entries.begin(), entries.end(), lessThan );
+    else
+	std::stable_sort( entries.begin(), entries.end(),
+			  []( const SortEntry & a, const SortEntry & b ) { return lessThan( b, a ); } );
+
+    std::vector<YItem *> & order = _sorted[ parent ];
+    order.reserve( entries.size() );
+
+    for ( const SortEntry & entry: entries )
+    {
+	order.push_back( entry.item );
+
+	if ( entry.item->hasChildren() )
+	    sortChildren( entry.item );
+    }
+}
+
+
+QString
+YQItemModel::sortKey( YItem * item, int column ) const
+{
+    YTableItem * tableItem = dynamic_cast<YTableItem *>( item );
+
+    if ( tableItem )
+    {
+	const YTableCell * cell = tableItem->cell( column );
+
+	if ( cell && cell->hasSortKey() )
+	    return fromUTF8( cell->sortKey() );
+    }
+
+    return text( item, column ).trimmed();
+}
+
+
+QString
+YQItemModel::text( YItem * item, int column ) const
+{
+    if ( _table )
+    {
+	YTableItem * tableItem = dynamic_cast<YTableItem *>( item );
+	const YTableCell * cell = tableItem ? tableItem->cell( column ) : 0;
+
+	return cell ? fromUTF8( cell->label() ) : QString();
+    }
+
+    return column == 0 ? fromUTF8( item->label() ) : QString();
+}
+
+
+QIcon
+YQItemModel::icon( YItem * item, int column ) const
+{
+    std::string iconName;
+
+    if ( _table )
+    {
+	YTableItem * tableItem = dynamic_cast<YTableItem *>( item );
+	const YTableCell * cell = tableItem ? tableItem->cell( column ) : 0;
+
+	if ( ! cell || ! cell->hasIconName() )
+	    return QIcon();
+
+	iconName = cell->iconName();
+    }
+    else
+    {
+	if ( column != 0 || ! item->hasIconName() )
+	    return QIcon();
+
+	iconName = item->iconName();
+    }
+
+    // The view asks for the icons whenever it paints the rows:
+    // The icon cache looks up each one only once
+
+    QIcon itemIcon;
+
+    if ( ! _table )
+	itemIcon = YQIconCache::iconCache()->fileIcon( _widget->iconFullPath( iconName ) );
+
+    if ( itemIcon.isNull() )
+	itemIcon = YQIconCache::iconCache()->icon( iconName );
+
+    return itemIcon;
+}
+
+
+
+
+YQItemView::YQItemView( QWidget * parent )
+    : QTreeView( parent )
+    , _columnSizer( 0 )
+    , _filtering( false )
+{
+    // All rows have the same height: The view does not need to ask the
+    // model for the size of each row to lay them out
+    setUniformRowHeights( true );
+}
+
+
+YQItemView::~YQItemView()
+{
+    delete _columnSizer;
+}
+
+
+void
+YQItemView::setColumnSizer( YQColumnSizer * sizer )
+{
+    if ( sizer != _columnSizer )
+	delete _columnSizer;
+
+    _columnSizer = sizer;
+}
+
+
+void
+YQItemView::resizeColumnsToContents( int column )
+{
+    if ( _columnSizer )
+    {
+	_columnSizer->apply( column );
+	return;
+    }
+
+    if ( column >= 0 )
+	resizeColumnToContents( column );
+    else
+    {
+	for ( int col = 0; col < header()->count(); col++ )
+	    resizeColumnToContents( col );
+    }
+}
+
+
+QSize
+YQItemView::minimumSizeHint() const
+{
+    return QSize( 0, 0 );
+}
+
+
+void
+YQItemView::setFilter( const QString & filter )
+{
+    if ( filter == _filter )
+	return;
+
+    _filter = filter;
+
+    if ( model() )
+	applyFilter( QModelIndex() );
+}
+
+
+bool
+YQItemView::applyFilter( const QModelIndex & parent )
+{
+    QAbstractItemModel * itemModel = model();
+    bool anyShown = false;
+
+    _filtering = true;
+
+    // Rows that are not fetched yet cannot be hidden: Fetch all of them
+    // so the matching ones are found no matter where they are
+
+    if ( ! _filter.isEmpty() )
+    {
+	while ( itemModel->canFetchMore( parent ) )
+	    itemModel->fetchMore( parent );
+    }
+
+    int rows = itemModel->rowCount( parent );
+
+    for ( int row = 0; row < rows; row++ )
+    {
+	QModelIndex index = itemModel->index( row, 0, parent );
+	bool show = itemModel->hasChildren( index ) && applyFilter( index );
+
+	if ( ! show )
+	    show = _filter.isEmpty() || rowMatches( row, parent );
+
+	if ( isRowHidden( row, parent ) == show )
+	    setRowHidden( row, parent, ! show );
+
+	anyShown |= show;
+    }
+
+    if ( ! parent.isValid() )
+	_filtering = false;
+
+    return anyShown;
+}
+
+
+bool
+YQItemView::rowMatches( int row, const QModelIndex & parent ) const
+{
+    QAbstractItemModel * itemModel = model();
+    int columns = itemModel->columnCount( parent );
+
+    for ( int col = 0; col < columns; col++ )
+    {
+	QString text = itemModel->data( itemModel->index( row, col, parent ), Qt::DisplayRole ).toString();
+
+	if ( text.contains( _filter, Qt::CaseInsensitive ) )
+	    return true;
+    }
+
+    return false;
+}
+
+
+void
+YQItemView::rowsInserted( const QModelIndex & parent, int start, int end )
+{
+    QTreeView::rowsInserted( parent, start, end );
+
+    if ( _filter.isEmpty() || _filtering )
+	return;
+
+    // A new child may make its parents visible again: Start from the top
+
+    applyFilter( QModelIndex() );
+}
+
+
+void
+YQItemView::reset()
+{
+    QTreeView::reset();
+
+    if ( ! _filter.isEmpty() && ! _filtering && model() )
+	applyFilter( QModelIndex() );
+}
+
+
+void
+YQItemView::dataChanged( const QModelIndex & topLeft,
+			 const QModelIndex & bottomRight,
+			 const QVector<int> & roles )
+{
+    QTreeView::dataChanged( topLeft, bottomRight, roles );
+
+    if ( _filter.isEmpty() || _filtering || ! topLeft.isValid() )
+	return;
+
+    // Only check the changed rows and make their parents visible if they
+    // match now; parents that no longer have matching children stay visible
+    // until the filter is applied the next time
+
+    QModelIndex parent = topLeft.parent();
+
+    for ( int row = topLeft.row(); row <= bottomRight.row(); row++ )
+    {
+	bool show = rowMatches( row, parent );
+
+	if ( ! show && model()->hasChildren( model()->index( row, 0, parent ) ) )
+	    show = ! isRowHidden( row, parent );	// kept for its children
+
+	setRowHidden( row, parent, ! show );
+
+	if ( show )
+	{
+	    for ( QModelIndex index = parent; index.isValid(); index = index.parent() )
+		setRowHidden( index.row(), index.parent(), false );
+	}
+    }
+}
@@ -0,0 +1,370 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQItemModel.h
+
+/-*/
+
+#ifndef YQItemModel_h
+#define YQItemModel_h
+
+#include <vector>
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QIcon>
+#include <QStringList>
+#include <QTreeView>
+
+#include <yui/YItem.h>
+
+class YQColumnSizer;
+class YSelectionWidget;
+class YTable;
+
+
+/**
+ * Item model for the Qt item views that works directly on the items of a
+ * YSelectionWidget: YTableItems of a YTable or YTreeItems of a YTree.
+ *
+ * Unlike a QTreeWidget, this does not create a Qt counterpart for each item:
+ * The view asks for the data of the visible rows only, and the model takes
+ * them directly from the original items.
+ *
+ * The toplevel rows are made available to the view in chunks
+ * (canFetchMore() / fetchMore()), so adding a huge number of items does
+ * not make the view lay out all of them at once.
+ *
+ * The model does not own the items. The widget has to call beginReset() and
+ * endReset() around deleting or replacing all items and itemsAdded() after
+ * adding items.
+ **/
+class YQItemModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * Constructor. 'columns' is the number of columns; for a YTable the
+     * column headers and alignments are taken from the table.
+     **/
+    YQItemModel( YSelectionWidget * widget, int columns, QObject * parent = 0 );
+
+    /**
+     * Destructor.
+     **/
+    virtual ~YQItemModel();
+
+    /**
+     * Show a check box for each item that reflects its selected state
+     * (for multi-selection trees).
+     **/
+    void setCheckable( bool checkable ) { _checkable = checkable; }
+
+    /**
+     * Return 'true' if the items have a check box.
+     **/
+    bool checkable() const { return _checkable; }
+
+    /**
+     * Return the original item for 'index' or 0 if there is none.
+     **/
+    YItem * item( const QModelIndex & index ) const;
+
+    /**
+     * Return the model index of 'item' in 'column'.
+     *
+     * If the toplevel row of 'item' was not fetched yet, all rows up to it
+     * are fetched if 'fetch' is true; otherwise an invalid index is
+     * returned.
+     **/
+    QModelIndex indexOf( YItem * item, int column = 0, bool fetch = true );
+
+    /**
+     * Notification that items were added at the end of the widget's items.
+     **/
+    void itemsAdded();
+
+    /**
+     * Notification that all items are going to be deleted or replaced.
+     * This must be followed by endReset() when that is done.
+     **/
+    void beginReset();
+
+    /**
+     * Notification that the items were deleted or replaced.
+     **/
+    void endReset();
+
+    /**
+     * Notification that the data of 'item' changed in 'column'
+     * (-1 for all columns).
+     **/
+    void itemChanged( YItem * item, int column = -1 );
+
+    /**
+     * Notification that the data of many items changed,
+     * e.g. the selected state of all of them.
+     **/
+    void itemsChanged();
+
+    /**
+     * Return the number of the toplevel rows fetched so far.
+     **/
+    int fetchedRows() const { return _fetched; }
+
+
+    //
+    // Reimplemented from QAbstractItemModel
+    //
+
+    virtual QModelIndex index( int row, int column,
+			       const QModelIndex & parent = QModelIndex() ) const;
+
+    virtual QModelIndex parent( const QModelIndex & index ) const;
+
+    virtual int rowCount( const QModelIndex & parent = QModelIndex() ) const;
+
+    virtual int columnCount( const QModelIndex & parent = QModelIndex() ) const;
+
+    virtual bool hasChildren( const QModelIndex & parent = QModelIndex() ) const;
+
+    virtual QVariant data( const QModelIndex & index, int role = Qt::DisplayRole ) const;
+
+    virtual bool setData( const QModelIndex & index, const QVariant & value,
+			  int role = Qt::EditRole );
+
+    virtual QVariant headerData( int section, Qt::Orientation orientation,
+				 int role = Qt::DisplayRole ) const;
+
+    virtual Qt::ItemFlags flags( const QModelIndex & index ) const;
+
+    virtual bool canFetchMore( const QModelIndex & parent ) const;
+
+    virtual void fetchMore( const QModelIndex & parent );
+
+    /**
+     * Sort the items by 'column'. A negative column restores the insertion
+     * order. The items are not touched, only the order of the rows.
+     **/
+    virtual void sort( int column, Qt::SortOrder order = Qt::AscendingOrder );
+
+
+signals:
+
+    /**
+     * Emitted when the user toggled the check box of 'item'.
+     * The item is not changed; that is up to the receiver.
+     **/
+    void checkStateToggled( YItem * item, bool checked );
+
+
+protected slots:
+
+    /**
+     * Sort again after items were added to a sorted model.
+     **/
+    void slotResort();
+
+
+protected:
+
+    /**
+     * Return the child of 'parent' (0 for the toplevel) in 'row'.
+     **/
+    YItem * childAt( YItem * parent, int row ) const;
+
+    /**
+     * Return the number of children of 'parent' (0 for the toplevel items,
+     * including the ones not fetched yet).
+     **/
+    int childCount( YItem * parent ) const;
+
+    /**
+     * Return the row of 'item' within its parent.
+     **/
+    int rowOf( YItem * item ) const;
+
+    /**
+     * Return 'true' if the toplevel row of 'item' was fetched already.
+     **/
+    bool isFetched( YItem * item ) const;
+
+    /**
+     * Sort the children of 'parent' (0 for the toplevel) and recursively
+     * their children by the current sort column.
+     **/
+    void sortChildren( YItem * parent );
+
+    /**
+     * Emit dataChanged() for all rows below 'parent' and recursively
+     * for their children.
+     **/
+    void childrenChanged( const QModelIndex & parent );
+
+    /**
+     * Return the sort key of 'item' in 'column'.
+     **/
+    QString sortKey( YItem * item, int column ) const;
+
+    /**
+     * Return the label of 'item' in 'column'.
+     **/
+    QString text( YItem * item, int column ) const;
+
+    /**
+     * Return the icon of 'item' in 'column'.
+     **/
+    QIcon icon( YItem * item, int column ) const;
+
+    //
+    // Data members
+    //
+
+    YSelectionWidget *	_widget;
+    YTable *		_table;		// 0 if the widget is not a table
+    int			_columns;
+    bool		_checkable;
+    int			_fetched;
+
+    int			_sortColumn;	// -1 for the insertion order
+    Qt::SortOrder	_sortOrder;
+    bool		_resortPending;
+
+    // sorted children per parent item (0 for the toplevel items),
+    // empty if the items are in the insertion order
+    QHash<YItem *, std::vector<YItem *> >	_sorted;
+
+    // rows of the items, filled on demand for all children of a parent
+    mutable QHash<YItem *, int>			_rowCache;
+};
+
+
+/**
+ * Tree view for YQItemModel: All rows have the same height (so the view
+ * does not need to measure each row) and the view may be shrunk to any size,
+ * the layout is up to libyui.
+ *
+ * The column widths can be calculated by a YQColumnSizer instead of
+ * measuring the rows.
+ *
+ * The view can hide all rows that do not contain a filter string (see
+ * setFilter()).
+ **/
+class YQItemView : public QTreeView
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * Constructor.
+     **/
+    YQItemView( QWidget * parent );
+
+    /**
+     * Destructor.
+     **/
+    virtual ~YQItemView();
+
+    /**
+     * Set the column sizer for resizeColumnsToContents().
+     * The view takes over ownership of 'sizer'.
+     **/
+    void setColumnSizer( YQColumnSizer * sizer );
+
+    /**
+     * Return the column sizer or 0 if there is none.
+     **/
+    YQColumnSizer * columnSizer() const { return _columnSizer; }
+
+    /**
+     * Resize 'column' (-1 for all columns) to its content: With the column
+     * sizer if there is one, otherwise by measuring the rows.
+     **/
+    void resizeColumnsToContents( int column = -1 );
+
+    /**
+     * Returns the minimum size required for this widget.
+     *
+     * Reimplemented from QWidget.
+     **/
+    virtual QSize minimumSizeHint() const;
+
+    /**
+     * Set a filter string: Only rows that contain it in any column (ignoring
+     * case) and their parent rows are shown. An empty filter shows all rows
+     * again.
+     *
+     * All toplevel rows are fetched from the model while filtering.
+     **/
+    void setFilter( const QString & filter );
+
+    /**
+     * Return the current filter string.
+     **/
+    const QString & filter() const { return _filter; }
+
+    /**
+     * Notification that the model changed completely: Apply the filter
+     * again.
+     *
+     * Reimplemented from QTreeView.
+     **/
+    virtual void reset();
+
+    /**
+     * Notification that rows changed: Show or hide them according to the
+     * filter.
+     *
+     * Reimplemented from QTreeView.
+     **/
+    virtual void dataChanged( const QModelIndex & topLeft,
+			      const QModelIndex & bottomRight,
+			      const QVector<int> & roles = QVector<int>() );
+
+
+protected:
+
+    /**
+     * Hide the children of 'parent' that do not match the filter and have
+     * no matching children. Return 'true' if any child is still shown.
+     **/
+    bool applyFilter( const QModelIndex & parent );
+
+    /**
+     * Return 'true' if any column of 'row' contains the filter.
+     **/
+    bool rowMatches( int row, const QModelIndex & parent ) const;
+
+    /**
+     * Notification that rows were inserted: Apply the filter to them.
+     *
+     * Reimplemented from QTreeView.
+     **/
+    virtual void rowsInserted( const QModelIndex & parent, int start, int end );
+
+
+    YQColumnSizer * _columnSizer;
+    QString	    _filter;
+    bool	    _filtering;	// inside applyFilter()
+};
+
+
+#endif // YQItemModel_h
@@ -0,0 +1,231 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQLayoutScheduler.cc
+
+/-*/
+
+
+#define YUILogComponent "qt-ui"
+#include <yui/YUILog.h>
+
+#include <QTimer>
+
+#include "YQDialog.h"
+#include "YQItemModel.h"
+#include "YQLayoutScheduler.h"
+#include "YQUI.h"
+
+// Statistics window for the layout passes per second
+#define STATS_WINDOW_MILLISEC	1000
+
+using std::endl;
+
+
+YQLayoutScheduler::YQLayoutScheduler( QObject * parent )
+    : QObject( parent )
+    , _suspended( 0 )
+    , _requests( 0 )
+    , _layoutPasses( 0 )
+    , _windowPasses( 0 )
+    , _passesPerSecond( 0.0 )
+{
+    // A zero timeout fires as soon as all pending window system events
+    // are processed, i.e. once per event loop iteration
+    _timer = new QTimer( this );
+    _timer->setSingleShot( true );
+    _timer->setInterval( 0 );
+
+    connect( _timer,	&pclass(_timer)::timeout,
+	     this,	&pclass(this)::slotFlush );
+}
+
+
+YQLayoutScheduler::~YQLayoutScheduler()
+{
+    // NOP
+}
+
+
+void
+YQLayoutScheduler::scheduleLayout( YQDialog * dialog )
+{
+    if ( ! dialog )
+	return;
+
+    _requests++;
+
+    if ( ! _pendingLayouts.contains( dialog ) )
+	_pendingLayouts.append( dialog );
+
+    startFlushTimer();
+}
+
+
+void
+YQLayoutScheduler::scheduleColumnResize( YQItemView * view, int column )
+{
+    if ( ! view )
+	return;
+
+    for ( ColumnResize & resize: _pendingResizes )
+    {
+	if ( resize.view == view )
+	{
+	    if ( resize.column != column )
+		resize.column = -1;	// different columns: resize them all
+
+	    return;
+	}
+    }
+
+    ColumnResize resize;
+    resize.view   = view;
+    resize.column = column;
+    _pendingResizes.append( resize );
+
+    startFlushTimer();
+}
+
+
+void
+YQLayoutScheduler::cancel( YQDialog * dialog )
+{
+    _pendingLayouts.removeAll( dialog );
+}
+
+
+void
+YQLayoutScheduler::startFlushTimer()
+{
+    if ( ! _suspended && ! _timer->isActive() )
+	_timer->start();
+}
+
+
+void
+YQLayoutScheduler::suspend()
+{
+    _suspended++;
+}
+
+
+void
+YQLayoutScheduler::resume()
+{
+    if ( _suspended > 0 )
+	_suspended--;
+
+    if ( ! _pendingLayouts.isEmpty() || ! _pendingResizes.isEmpty() )
+	startFlushTimer();
+}
+
+
+void
+YQLayoutScheduler::slotFlush()
+{
+    flush();
+}
+
+
+void
+YQLayoutScheduler::flush()
+{
+    if ( _suspended )
+	return;
+
+    _timer->stop();
+
+    if ( _pendingLayouts.isEmpty() && _pendingResizes.isEmpty() )
+	return;
+
+    // Requests issued while carrying out these ones go to the next round
+
+    QList<ColumnResize> resizes;
+    QList< QPointer<YQDialog> > layouts;
+    resizes.swap( _pendingResizes );
+    layouts.swap( _pendingLayouts );
+
+    // Resize the columns first, the layout might depend on them
+
+    for ( const ColumnResize & resize: resizes )
+    {
+	if ( ! resize.view )	// deleted in the meantime
+	    continue;
+
+	resize.view->resizeColumnsToContents( resize.column );
+    }
+
+    int passes = 0;
+
+    for ( YQDialog * dialog: layouts )
+    {
+	if ( dialog )
+	{
+	    dialog->doLayout();
+	    passes++;
+	}
+    }
+
+    if ( passes > 0 )
+    {
+	yuiDebug() << _requests << " layout requests coalesced into "
+		   << passes << " layout passes" << endl;
+	countPasses( passes );
+    }
+
+    _requests = 0;
+}
+
+
+void
+YQLayoutScheduler::countPasses( int passes )
+{
+    _layoutPasses += passes;
+
+    if ( ! _window.isValid() )
+	_window.start();
+
+    _windowPasses += passes;
+    qint64 elapsed = _window.elapsed();
+
+    if ( elapsed >= STATS_WINDOW_MILLISEC )
+    {
+	_passesPerSecond = _windowPasses * 1000.0 / elapsed;
+	yuiDebug() << "Layout passes per second: " << _passesPerSecond << endl;
+
+	_windowPasses = 0;
+	_window.restart();
+    }
+}
+
+
+double
+YQLayoutScheduler::layoutPassesPerSecond() const
+{
+    if ( ! _window.isValid() )
+	return 0.0;
+
+    qint64 elapsed = _window.elapsed();
+
+    // The current window is over, but there was no pass to close it yet
+    if ( elapsed >= STATS_WINDOW_MILLISEC )
+	return _windowPasses * 1000.0 / elapsed;
+
+    return _passesPerSecond;
+}
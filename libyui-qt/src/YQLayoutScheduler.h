@@ -0,0 +1,158 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:	      YQLayoutScheduler.h
+
+/-*/
+
+#ifndef YQLayoutScheduler_h
+#define YQLayoutScheduler_h
+
+#include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QList>
+
+class QTimer;
+class YQDialog;
+class YQItemView;
+
+
+/**
+ * Deferred layout and column resize requests.
+ *
+ * Recalculating the layout of a dialog and resizing the columns of a table
+ * to their content are expensive operations, but the applications often
+ * trigger them many times in a row (e.g. when replacing several widgets or
+ * when adding items one by one). The requests are collected here and
+ * carried out only once per event loop iteration.
+ *
+ * The pending requests are not carried out between
+ * YWidget::startMultipleChanges() and YWidget::doneMultipleChanges() of a
+ * dialog, see suspend() and resume().
+ **/
+class YQLayoutScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * Constructor.
+     **/
+    YQLayoutScheduler( QObject * parent = 0 );
+
+    /**
+     * Destructor.
+     **/
+    virtual ~YQLayoutScheduler();
+
+    /**
+     * Request a layout pass for 'dialog'. Several requests for the same
+     * dialog result in one pass.
+     **/
+    void scheduleLayout( YQDialog * dialog );
+
+    /**
+     * Request resizing the columns of 'view' to their content.
+     * 'column' -1 means all columns.
+     **/
+    void scheduleColumnResize( YQItemView * view, int column = -1 );
+
+    /**
+     * Forget the pending requests for 'dialog', e.g. when it is deleted
+     * or when its layout has just been calculated anyway.
+     **/
+    void cancel( YQDialog * dialog );
+
+    /**
+     * Carry out all pending requests now unless the scheduler is suspended.
+     **/
+    void flush();
+
+    /**
+     * Suspend carrying out the requests until the matching resume().
+     * The calls can be nested.
+     **/
+    void suspend();
+
+    /**
+     * Resume after suspend(). The pending requests are carried out in the
+     * next event loop iteration after the outermost resume().
+     **/
+    void resume();
+
+    /**
+     * Return 'true' if the scheduler is suspended.
+     **/
+    bool isSuspended() const { return _suspended > 0; }
+
+    /**
+     * Total number of the layout passes carried out so far.
+     **/
+    int layoutPasses() const { return _layoutPasses; }
+
+    /**
+     * Number of the layout passes per second, measured over the last
+     * second with layout passes.
+     **/
+    double layoutPassesPerSecond() const;
+
+
+protected slots:
+
+    /**
+     * Carry out the pending requests (timer slot).
+     **/
+    void slotFlush();
+
+
+protected:
+
+    /**
+     * Start the timer for the next event loop iteration.
+     **/
+    void startFlushTimer();
+
+    /**
+     * Update the layout pass statistics after 'passes' new passes.
+     **/
+    void countPasses( int passes );
+
+
+    struct ColumnResize
+    {
+	QPointer<YQItemView>	view;
+	int			column;
+    };
+
+    QList< QPointer<YQDialog> >	_pendingLayouts;
+    QList<ColumnResize>		_pendingResizes;
+
+    QTimer *		_timer;
+    int			_suspended;
+    int			_requests;
+
+    int			_layoutPasses;
+    int			_windowPasses;
+    double		_passesPerSecond;
+    QElapsedTimer	_window;
+};
+
+
+#endif // YQLayoutScheduler_h
@@ -36,9 +36,11 @@
 #include "YQSignalBlocker.h"
 #include <yui/YUIException.h>
 
-#include "QY2ListView.h"
+#include "YQColumnSizer.h"
+#include "YQItemModel.h"
 #include "YQTable.h"
 #include "YQApplication.h"
+#include "YQLayoutScheduler.h"
 
 
 #define INDENTATION_WIDTH 10
@@ -60,64 +62,71 @@ YQTable::YQTable( YWidget *             parent,
 
     layout->setMargin( YQWidgetMargin );
 
-    _qt_listView = new QY2ListView( this );
+    _qt_listView = new YQItemView( this );
     YUI_CHECK_NEW( _qt_listView );
     layout->addWidget( _qt_listView );
     _qt_listView->setAllColumnsShowFocus( true );
     _qt_listView->setExpandsOnDoubleClick( false );
     _qt_listView->setIndentation( INDENTATION_WIDTH );
+    _qt_listView->setRootIsDecorated( false );
     _qt_listView->header()->setStretchLastSection( false );
 
-    setKeepSorting(  keepSorting() );
+    // The model takes the column headers and the cells directly from the
+    // table and its items, no Qt item is created for the items
 
-    if ( multiSelectionMode )
-	_qt_listView->setSelectionMode( QAbstractItemView::ExtendedSelection );
+    _model = new YQItemModel( this, columns(), this );
+    YUI_CHECK_NEW( _model );
+    _qt_listView->setModel( _model );
 
-    _qt_listView->setContextMenuPolicy( Qt::CustomContextMenu );
+    // The column widths are tracked while adding items, the rows are not
+    // measured again each time the columns are resized
 
-    //
-    // Add columns
-    //
+    _columnSizer = new YQColumnSizer( _qt_listView, this );
+    YUI_CHECK_NEW( _columnSizer );
+    _qt_listView->setColumnSizer( _columnSizer );
 
-    QStringList headers;
-    _qt_listView->setColumnCount( columns() );
+    _qt_listView->header()->setSectionResizeMode( QHeaderView::Interactive );
+    _qt_listView->header()->setSortIndicator( 0, Qt::AscendingOrder );
 
-    for ( int i=0; i < columns(); i++ )
-    {
-        headers << fromUTF8( header(i) );
-    }
+    setKeepSorting(  keepSorting() );
 
-    _qt_listView->setHeaderLabels( headers );
-    _qt_listView->header()->setSectionResizeMode( QHeaderView::Interactive );
-    _qt_listView->sortItems( 0, Qt::AscendingOrder);
+    if ( multiSelectionMode )
+	_qt_listView->setSelectionMode( QAbstractItemView::ExtendedSelection );
+
+    _qt_listView->setContextMenuPolicy( Qt::CustomContextMenu );
 
 
     //
     // Connect signals and slots
     //
 
-    connect( _qt_listView, 	&pclass(_qt_listView)::itemDoubleClicked,
+    connect( _qt_listView, 	&pclass(_qt_listView)::doubleClicked,
 	     this, 		&pclass(this)::slotActivated );
 
     connect( _qt_listView,      &pclass(_qt_listView)::customContextMenuRequested,
              this,      	&pclass(this)::slotContextMenu );
 
-    connect( _qt_listView,	&pclass(_qt_listView)::itemExpanded,
+    connect( _qt_listView,	&pclass(_qt_listView)::expanded,
 	     this,		&pclass(this)::slotItemExpanded );
 
-    connect( _qt_listView,	&pclass(_qt_listView)::itemCollapsed,
+    connect( _qt_listView,	&pclass(_qt_listView)::collapsed,
 	     this,		&pclass(this)::slotItemCollapsed );
 
+    connect( _model,		&pclass(_model)::rowsInserted,
+	     this,		&pclass(this)::slotRowsInserted );
+
+    QItemSelectionModel * selectionModel = _qt_listView->selectionModel();
+
     if ( multiSelectionMode )
     {
 	// This is the exceptional case - avoid performance drop in the normal case
-	connect( _qt_listView, 	&pclass(_qt_listView)::itemSelectionChanged,
-		 this,		&pclass(this)::slotSelectionChanged );
+	connect( selectionModel,	&pclass(selectionModel)::selectionChanged,
+		 this,			&pclass(this)::slotSelectionChanged );
     }
     else
     {
-        connect( _qt_listView, 	&pclass(_qt_listView)::currentItemChanged,
-                 this, 		&pclass(this)::slotSelected );
+        connect( selectionModel,	&pclass(selectionModel)::currentChanged,
+                 this, 			&pclass(this)::slotCurrentChanged );
     }
 }
 
@@ -132,8 +141,18 @@ void
 YQTable::setKeepSorting( bool keepSorting )
 {
     YTable::setKeepSorting( keepSorting );
-    _qt_listView->setSortByInsertionSequence( keepSorting );
     _qt_listView->setSortingEnabled( ! keepSorting );
+
+    if ( keepSorting )
+	_model->sort( -1 ); // Back to the insertion order
+}
+
+
+void
+YQTable::setFilter( const std::string & filter )
+{
+    YTable::setFilter( filter );
+    _qt_listView->setFilter( fromUTF8( filter ) );
 }
 
 
@@ -154,51 +173,27 @@ YQTable::addItem( YItem * yitem, bool batchMode, bool resizeColumnsToContent )
 
     YTable::addItem( item );
 
-    YQTableListViewItem * clone = new YQTableListViewItem( this, _qt_listView, item );
-    YUI_CHECK_NEW( clone );
-
-    if ( ! batchMode && item->selected() )
-    {
-	// YTable enforces single selection, if appropriate
-
-	YQSignalBlocker sigBlocker( _qt_listView );
-	YQTable::selectItem( YSelectionWidget::selectedItem(), true );
-    }
-
     if ( item->hasChildren() )
-    {
-        cloneChildItems( item, clone );
         _qt_listView->setRootIsDecorated( true );
-    }
 
     if ( ! batchMode )
-	_qt_listView->sortItems( 0, Qt::AscendingOrder);
-
-    if ( resizeColumnsToContent )
     {
-        for ( int i=0; i < columns(); i++ )
-	    _qt_listView->resizeColumnToContents( i );
-	// NOTE: resizeColumnToContents() is performance-critical!
-    }
-}
-
+	_model->itemsAdded();
+	_columnSizer->itemsAdded( itemsEnd() - 1, itemsEnd() );
 
-void
-YQTable::cloneChildItems( YTableItem * parentItem, YQTableListViewItem * parentItemClone )
-{
-    for ( YItemIterator it = parentItem->childrenBegin();
-          it != parentItem->childrenEnd();
-          ++it )
-    {
-        YTableItem * childItem = dynamic_cast<YTableItem *>( *it );
+	if ( item->selected() )
+	{
+	    // YTable enforces single selection, if appropriate
 
-        if ( childItem )
-        {
-            YQTableListViewItem * childClone = new YQTableListViewItem( this, parentItemClone, childItem );
-            YUI_CHECK_NEW( childClone );
+	    YQTable::selectItem( YSelectionWidget::selectedItem(), true );
+	}
+    }
 
-            cloneChildItems( childItem, childClone );
-        }
+    if ( resizeColumnsToContent )
+    {
+	// The widths are known already, but resizing the columns still
+	// lays out the view again: Adding several items resizes them only once
+	YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView );
     }
 }
 
@@ -206,7 +201,7 @@ YQTable::cloneChildItems( YTableItem * parentItem, YQTableListViewItem * parentI
 void
 YQTable::addItems( const YItemCollection & itemCollection )
 {
-    YQSignalBlocker sigBlocker( _qt_listView );
+    int oldCount = itemsCount();
 
     for ( YItemConstIterator it = itemCollection.begin();
 	  it != itemCollection.end();
@@ -219,70 +214,115 @@ YQTable::addItems( const YItemCollection & itemCollection )
         // => resize columns to content only once at the end of this function
     }
 
+    _model->itemsAdded();
+    _columnSizer->itemsAdded( itemsBegin() + oldCount, itemsEnd() );
+
     YItem * sel = YSelectionWidget::selectedItem();
 
     if ( sel )
 	YQTable::selectItem( sel, true );
 
-    for ( int i=0; i < columns(); i++ )
-	_qt_listView->resizeColumnToContents( i );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView );
 }
 
 
 void
 YQTable::selectItem( YItem * yitem, bool selected )
 {
-    YQSignalBlocker sigBlocker( _qt_listView );
+    YQSignalBlocker sigBlocker( _qt_listView->selectionModel() );
 
     YTableItem * item = dynamic_cast<YTableItem *> (yitem);
     YUI_CHECK_PTR( item );
 
-    YQTableListViewItem * clone = (YQTableListViewItem *) item->data();
-    YUI_CHECK_PTR( clone );
+    // This makes the row available to the view if it was not yet
+    QModelIndex index = _model->indexOf( item );
+    QItemSelectionModel::SelectionFlags rows = QItemSelectionModel::Rows;
 
-
-    if ( ! selected && clone == _qt_listView->currentItem() )
+    if ( ! selected && _model->item( _qt_listView->currentIndex() ) == item )
     {
 	deselectAllItems();
     }
+    else if ( selected )
+    {
+	if ( ! hasMultiSelection() )	// This deselects all other items!
+	    _qt_listView->selectionModel()->setCurrentIndex( index, QItemSelectionModel::ClearAndSelect | rows );
+	else
+	    _qt_listView->selectionModel()->select( index, QItemSelectionModel::Select | rows );
+
+	YTable::selectItem( item, true );
+    }
     else
     {
-	if ( ! hasMultiSelection() )
-	    _qt_listView->setCurrentItem( clone ); // This deselects all other items!
+	_qt_listView->selectionModel()->select( index, QItemSelectionModel::Deselect | rows );
+	YTable::selectItem( item, false );
+    }
+}
+
 
-	clone->setSelected( true );
-	YTable::selectItem( item, selected );
+void
+YQTable::showItemStates( const QModelIndex & parent, int first, int last )
+{
+    YQSignalBlocker sigBlocker( _qt_listView->selectionModel() );
+
+    for ( int row = first; row <= last; row++ )
+    {
+	QModelIndex index = _model->index( row, 0, parent );
+	YTreeItem * item  = dynamic_cast<YTreeItem *>( _model->item( index ) );
+
+	if ( ! item )
+	    continue;
+
+	if ( item->selected() )
+	{
+	    _qt_listView->selectionModel()->select( index, QItemSelectionModel::Select |
+						    QItemSelectionModel::Rows );
+	}
+
+	if ( item->hasChildren() )
+	{
+	    if ( item->isOpen() )
+		_qt_listView->expand( index );
+
+	    showItemStates( index, 0, _model->rowCount( index ) - 1 );
+	}
     }
 }
 
 
 void
-YQTable::slotItemExpanded( QTreeWidgetItem * qItem )
+YQTable::slotRowsInserted( const QModelIndex & parent, int first, int last )
+{
+    showItemStates( parent, first, last );
+}
+
+
+void
+YQTable::slotItemExpanded( const QModelIndex & index )
 {
-    YQTableListViewItem * item = dynamic_cast<YQTableListViewItem *> (qItem);
+    YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
 
     if ( item )
-	item->origItem()->setOpen( true );
+	item->setOpen( true );
 
-    _qt_listView->resizeColumnToContents( 0 );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView, 0 );
 }
 
 
-void YQTable::slotItemCollapsed( QTreeWidgetItem * qItem )
+void YQTable::slotItemCollapsed( const QModelIndex & index )
 {
-    YQTableListViewItem * item = dynamic_cast<YQTableListViewItem *> (qItem);
+    YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
 
     if ( item )
-	item->origItem()->setOpen( false );
+	item->setOpen( false );
 
-    _qt_listView->resizeColumnToContents( 0 );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView, 0 );
 }
 
 
 void
 YQTable::deselectAllItems()
 {
-    YQSignalBlocker sigBlocker( _qt_listView );
+    YQSignalBlocker sigBlocker( _qt_listView->selectionModel() );
 
     YTable::deselectAllItems();
     _qt_listView->clearSelection();
@@ -292,8 +332,12 @@ YQTable::deselectAllItems()
 void
 YQTable::deleteAllItems()
 {
-    _qt_listView->clear();
+    _model->beginReset();
     YTable::deleteAllItems();
+    _model->endReset();
+
+    _columnSizer->reset();
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView );
 }
 
 
@@ -303,31 +347,28 @@ YQTable::cellChanged( const YTableCell * cell )
     YTableItem * item = cell->parent();
     YUI_CHECK_PTR( item );
 
-    YQTableListViewItem * clone = (YQTableListViewItem *) item->data();
-    YUI_CHECK_PTR( clone );
+    _model->itemChanged( item, cell->column() );
 
-    clone->updateCell( cell );
+    _columnSizer->cellChanged( cell );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_listView, cell->column() );
 }
 
 
 void
-YQTable::selectOrigItem( QTreeWidgetItem * listViewItem )
+YQTable::selectOrigItem( const QModelIndex & index )
 {
-    if ( listViewItem )
-    {
-	YQTableListViewItem * tableListViewItem = dynamic_cast<YQTableListViewItem *> (listViewItem);
-	YUI_CHECK_PTR( tableListViewItem );
+    YItem * item = _model->item( index );
 
-	YTable::selectItem( tableListViewItem->origItem(), true );
-    }
+    if ( item )
+	YTable::selectItem( item, true );
 }
 
 
 void
-YQTable::slotSelected( QTreeWidgetItem * listViewItem  )
+YQTable::slotCurrentChanged( const QModelIndex & current )
 {
-    if ( listViewItem )
-	selectOrigItem( listViewItem );
+    if ( current.isValid() )
+	selectOrigItem( current );
     else
     {
 	// Qt might select nothing if a user clicks outside the items in the widget
@@ -355,19 +396,19 @@ YQTable::slotSelectionChanged()
     YSelectionWidget::deselectAllItems();
     yuiDebug() << endl;
 
-    QList<QTreeWidgetItem *> selItems = _qt_listView->selectedItems();
+    QModelIndexList selRows = _qt_listView->selectionModel()->selectedRows();
 
-    for ( QList<QTreeWidgetItem *>::iterator it = selItems.begin();
-	  it != selItems.end();
+    for ( QModelIndexList::const_iterator it = selRows.begin();
+	  it != selRows.end();
 	  ++it )
     {
-	YQTableListViewItem * tableListViewItem = dynamic_cast<YQTableListViewItem *> (*it);
+	YItem * item = _model->item( *it );
 
-	if ( tableListViewItem )
+	if ( item )
 	{
-	    tableListViewItem->origItem()->setSelected( true );
+	    item->setSelected( true );
 
-	    yuiDebug() << "Selected item: " << tableListViewItem->origItem()->label() << endl;
+	    yuiDebug() << "Selected item: " << item->label() << endl;
 	}
     }
 
@@ -385,9 +426,9 @@ YQTable::slotSelectionChanged()
 
 
 void
-YQTable::slotActivated( QTreeWidgetItem * listViewItem )
+YQTable::slotActivated( const QModelIndex & index )
 {
-    selectOrigItem( listViewItem );
+    selectOrigItem( index );
 
     if ( notify() )
     {
@@ -457,7 +498,6 @@ YQTable::slotContextMenu ( const QPoint & pos )
 
 
 
-
 YQTableListViewItem::YQTableListViewItem( YQTable *	table,
 					  QY2ListView * parent,
 					  YTableItem *	origItem )
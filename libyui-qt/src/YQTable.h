@@ -26,13 +26,14 @@
 #define YQTable_h
 
 #include <QFrame>
+#include <QModelIndex>
 #include "QY2ListView.h"
 #include <yui/YTable.h>
 
 
-class QY2ListView;
-class QTreeWidgetItem;
-class YQTableListViewItem;
+class YQColumnSizer;
+class YQItemModel;
+class YQItemView;
 
 
 class YQTable : public QFrame, public YTable
@@ -62,6 +63,15 @@ public:
      **/
     virtual void setKeepSorting( bool keepSorting );
 
+    /**
+     * Set a filter string: Only items that contain it in any of their cells
+     * are displayed. There is no interactive filtering in the Qt UI, so there
+     * are no FilterChanged events.
+     *
+     * Reimplemented from YTable.
+     **/
+    virtual void setFilter( const std::string & filter );
+
     /**
      * Add an item.
      *
@@ -148,7 +158,7 @@ protected slots:
     /**
      * Notification that an item is selected (single click or keyboard).
      **/
-    void slotSelected( QTreeWidgetItem * );
+    void slotCurrentChanged( const QModelIndex & current );
 
     /**
      * Notification that the item selection changed
@@ -159,17 +169,22 @@ protected slots:
     /**
      * Notification that an item is activated (double click or keyboard).
      **/
-    void slotActivated( QTreeWidgetItem * );
+    void slotActivated( const QModelIndex & index );
 
     /**
      * Propagate an "item expanded" event to the underlying YTableItem.
      **/
-    void slotItemExpanded( QTreeWidgetItem * item );
+    void slotItemExpanded( const QModelIndex & index );
 
     /**
      * Propagate an "item collapsed" event to the underlying YTableItem.
      **/
-    void slotItemCollapsed( QTreeWidgetItem * item );
+    void slotItemCollapsed( const QModelIndex & index );
+
+    /**
+     * Notification that the model made more rows available to the view.
+     **/
+    void slotRowsInserted( const QModelIndex & parent, int first, int last );
 
 
     /**
@@ -185,9 +200,9 @@ protected:
 
     /**
      * Select the original item (the YTableItem) that corresponds to the
-     * specified listViewItem.
+     * specified model index.
      **/
-    void selectOrigItem( QTreeWidgetItem * listViewItem );
+    void selectOrigItem( const QModelIndex & index );
 
     /**
      * Internal addItem() method that will not do expensive operations in batch
@@ -196,23 +211,28 @@ protected:
     void addItem( YItem * item, bool batchMode, bool resizeColumnsToContent );
 
     /**
-     * Clone (create Qt item counterparts) for all child items of 'parentItem'.
-     * Set their Qt item parent to 'parentItemClone'.
+     * Show the selected and open state of the original items in the rows
+     * 'first' to 'last' below 'parent' and recursively their children.
      **/
-    void cloneChildItems( YTableItem          * parentItem,
-                          YQTableListViewItem * parentItemClone );
+    void showItemStates( const QModelIndex & parent, int first, int last );
 
     //
     // Data members
     //
 
-    QY2ListView * _qt_listView;
+    YQItemView *	_qt_listView;
+    YQItemModel *	_model;
+    YQColumnSizer *	_columnSizer;	// owned by _qt_listView
 };
 
 
 
 /**
- * Visual representation of a YTableItem.
+ * Visual representation of a YTableItem in a QY2ListView.
+ *
+ * OBSOLETE: YQTable shows its items through a YQItemModel and no longer
+ * creates any YQTableListViewItems. This class is only kept for source
+ * compatibility; it will be removed in a future release.
  **/
 class YQTableListViewItem : public QY2ListViewItem
 {
@@ -276,5 +296,4 @@ protected:
 };
 
 
-
 #endif // YQLabel_h
@@ -24,7 +24,6 @@
 
 #include <QHeaderView>
 #include <QLabel>
-#include <QTreeWidget>
 #include <QVBoxLayout>
 #include <QString>
 #include <QIcon>
@@ -40,8 +39,8 @@
 #include "YQSignalBlocker.h"
 #include "YQWidgetCaption.h"
 #include "YQApplication.h"
-
-#define VERBOSE_TREE_ITEMS	0
+#include "YQLayoutScheduler.h"
+#include "YQItemModel.h"
 
 using std::string;
 
@@ -62,50 +61,55 @@ YQTree::YQTree( YWidget *	parent,
     layout->setSpacing( YQWidgetSpacing );
     layout->setMargin ( YQWidgetMargin	);
 
-    _nextSerialNo = 0;
-
     _caption	 = new YQWidgetCaption( this, label );
     YUI_CHECK_NEW( _caption );
     layout->addWidget( _caption );
 
-    _qt_treeWidget = new QTreeWidget( this );
+    _qt_treeWidget = new YQItemView( this );
     YUI_CHECK_NEW( _qt_treeWidget );
     layout->addWidget( _qt_treeWidget );
 
-    // _qt_treeWidget->setHeaderLabel("");
-    // _qt_treeWidget->addColumn( "" );
     _qt_treeWidget->header()->hide();
-    // _qt_treeWidget->setHeader(0L);
     _qt_treeWidget->setRootIsDecorated ( true );
 
     _qt_treeWidget->setContextMenuPolicy( Qt::CustomContextMenu );
 
+    // The model shows the original items directly and always in their
+    // insertion order: The tree widget cannot maintain a meaningful sorting
+    // order of its own. Better let the application handle this.
+
+    _model = new YQItemModel( this, 1, this );
+    YUI_CHECK_NEW( _model );
+    _model->setCheckable( multiSelectionMode );
+    _qt_treeWidget->setModel( _model );
+
     _caption->setBuddy ( _qt_treeWidget );
 
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemSelectionChanged,
+    QItemSelectionModel * selectionModel = _qt_treeWidget->selectionModel();
+
+    connect( selectionModel,	&pclass(selectionModel)::selectionChanged,
 	     this,		&pclass(this)::slotSelectionChanged );
 
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemClicked,
+    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::clicked,
 	     this,		&pclass(this)::slotItemClicked );
 
-//    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemChanged,
-//	     this,		&pclass(this)::slotItemChanged );
-
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemChanged,
-	     this,		&pclass(this)::slotItemChanged );
+    connect( _model,		&pclass(_model)::checkStateToggled,
+	     this,		&pclass(this)::slotCheckStateToggled );
 
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemDoubleClicked,
+    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::doubleClicked,
 	     this,		&pclass(this)::slotActivated );
 
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemExpanded,
+    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::expanded,
 	     this,		&pclass(this)::slotItemExpanded );
 
-    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::itemCollapsed,
+    connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::collapsed,
 	     this,		&pclass(this)::slotItemCollapsed );
 
     connect( _qt_treeWidget,	&pclass(_qt_treeWidget)::customContextMenuRequested,
 	     this,		&pclass(this)::slotContextMenu );
 
+    connect( _model,		&pclass(_model)::rowsInserted,
+	     this,		&pclass(this)::slotRowsInserted );
 }
 
 
@@ -122,43 +126,56 @@ void YQTree::setLabel( const string & label )
 }
 
 
+void YQTree::setFilter( const string & filter )
+{
+    YTree::setFilter( filter );
+    _qt_treeWidget->setFilter( fromUTF8( filter ) );
+}
+
+
 void YQTree::rebuildTree()
 {
     YQSignalBlocker sigBlocker( _qt_treeWidget );
-    _qt_treeWidget->clear();
 
-    buildDisplayTree( 0, itemsBegin(), itemsEnd() );
-    _qt_treeWidget->resizeColumnToContents( 0 );
+    // No Qt items to create: The model shows the original items directly
+    _model->beginReset();
+    _model->endReset();
+
+    showItemStates( QModelIndex(), 0, _model->rowCount() - 1 );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_treeWidget, 0 );
 }
 
 
-void YQTree::buildDisplayTree( YQTreeItem * parentItem, YItemIterator begin, YItemIterator end )
+void YQTree::showItemStates( const QModelIndex & parent, int first, int last )
 {
-    for ( YItemIterator it = begin; it < end; ++it )
-    {
-	YTreeItem * orig = dynamic_cast<YTreeItem *> (*it);
-	YUI_CHECK_PTR( orig );
+    YQSignalBlocker sigBlocker( _qt_treeWidget->selectionModel() );
 
-	YQTreeItem * clone;
+    for ( int row = first; row <= last; row++ )
+    {
+	QModelIndex index = _model->index( row, 0, parent );
+	YTreeItem * item  = dynamic_cast<YTreeItem *>( _model->item( index ) );
 
-	if ( parentItem )
-	    clone = new YQTreeItem( this, parentItem, orig, _nextSerialNo++ );
-	else
-	    clone = new YQTreeItem( this, _qt_treeWidget, orig, _nextSerialNo++ );
+	if ( ! item )
+	    continue;
 
-	YUI_CHECK_NEW( clone );
+	if ( item->hasChildren() && item->isOpen() )
+	    _qt_treeWidget->expand( index );
 
-	if (orig->selected())
-	{
-	    selectItem(clone);
-	}
+	if ( item->selected() )
+	    selectItem( index );
 
-	if ( orig->hasChildren() )
-	    buildDisplayTree( clone, orig->childrenBegin(), orig->childrenEnd() );
+	if ( item->hasChildren() )
+	    showItemStates( index, 0, _model->rowCount( index ) - 1 );
     }
 }
 
 
+void YQTree::slotRowsInserted( const QModelIndex & parent, int first, int last )
+{
+    showItemStates( parent, first, last );
+}
+
+
 void YQTree::selectItem( YItem * yItem, bool selected )
 {
     YQSignalBlocker sigBlocker( _qt_treeWidget );
@@ -167,99 +184,93 @@ void YQTree::selectItem( YItem * yItem, bool selected )
     YTreeItem * treeItem = dynamic_cast<YTreeItem *> (yItem);
     YUI_CHECK_PTR( treeItem );
 
-    YQTreeItem * yqTreeItem = (YQTreeItem *) treeItem->data();
-    YUI_CHECK_PTR( yqTreeItem );
-
-
     if ( selected )
     {
-	selectItem( yqTreeItem );
+	selectItem( _model->indexOf( treeItem ) );
     }
-    else if ( yqTreeItem == _qt_treeWidget->currentItem() )
+    else if ( treeItem == currentItem() )
     {
 	deselectAllItems();
     }
+    else
+    {
+	YTree::selectItem( treeItem, false );
+	_model->itemChanged( treeItem );
+    }
 }
 
 
-void YQTree::selectItem( YQTreeItem * item )
+void YQTree::selectItem( const QModelIndex & index )
 {
+    YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
+
     if ( item )
     {
 	YQSignalBlocker sigBlocker( _qt_treeWidget );
+	YQSignalBlocker selectionBlocker( _qt_treeWidget->selectionModel() );
 
-	_qt_treeWidget->setCurrentItem( item );
-	item->setSelected( true );
+	_qt_treeWidget->selectionModel()->setCurrentIndex( index, QItemSelectionModel::ClearAndSelect );
 
-	if ( hasMultiSelection() )
-	    item->setCheckState( 0, Qt::Checked );
-
-	if ( item->parent() )
-	    openBranch( (YQTreeItem *) item->parent() );
+	if ( index.parent().isValid() )
+	    openBranch( index.parent() );
 
-	YTree::selectItem( item->origItem(), true );
+	YTree::selectItem( item, true );
 
-	// yuiDebug() << "selected item: \"" << item->origItem()->label() << "\"" << endl;
+	if ( hasMultiSelection() )
+	    _model->itemChanged( item );	// update the check box
 
+	// yuiDebug() << "selected item: \"" << item->label() << "\"" << endl;
     }
 }
 
 
-void YQTree::openBranch( YQTreeItem * item )
+void YQTree::openBranch( QModelIndex index )
 {
-    while ( item )
+    while ( index.isValid() )
     {
-	item->setOpen( true ); // Takes care of origItem()->setOpen()
-	item = (YQTreeItem *) item->parent();
+	YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
+
+	if ( item )
+	    item->setOpen( true );
+
+	_qt_treeWidget->expand( index );
+	index = index.parent();
     }
 }
 
 
-void YQTree::slotItemExpanded( QTreeWidgetItem * qItem )
+void YQTree::slotItemExpanded( const QModelIndex & index )
 {
-    YQTreeItem * item = dynamic_cast<YQTreeItem *> (qItem);
+    YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
 
     if ( item )
 	item->setOpen( true );
 
-    _qt_treeWidget->resizeColumnToContents( 0 );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_treeWidget, 0 );
 }
 
 
-void YQTree::slotItemCollapsed( QTreeWidgetItem * qItem )
+void YQTree::slotItemCollapsed( const QModelIndex & index )
 {
-    YQTreeItem * item = dynamic_cast<YQTreeItem *> (qItem);
+    YTreeItem * item = dynamic_cast<YTreeItem *> ( _model->item( index ) );
 
     if ( item )
 	item->setOpen( false );
 
-    _qt_treeWidget->resizeColumnToContents( 0 );
+    YQUI::ui()->layoutScheduler()->scheduleColumnResize( _qt_treeWidget, 0 );
 }
 
 
 void YQTree::deselectAllItems()
 {
     YQSignalBlocker sigBlocker( _qt_treeWidget );
+    YQSignalBlocker selectionBlocker( _qt_treeWidget->selectionModel() );
 
     YTree::deselectAllItems();
     _qt_treeWidget->clearSelection();
 
     if ( hasMultiSelection() )
-    {
-	QTreeWidgetItemIterator it( _qt_treeWidget);
-	while (*it)
-	{
-	    YQTreeItem * treeItem = dynamic_cast<YQTreeItem *> (*it);
-
-	    if ( treeItem )
-	    {
-		treeItem->setCheckState( 0, Qt::Unchecked );
-		treeItem->origItem()->setSelected( false );
-	    }
-	    ++it;
-	}
-    }
-
+	_model->itemsChanged();		// update the check boxes
 }
 
 
@@ -267,74 +278,48 @@ void YQTree::deleteAllItems()
 {
     YQSignalBlocker sigBlocker( _qt_treeWidget );
 
-    _qt_treeWidget->clear();
+    _model->beginReset();
     YTree::deleteAllItems();
+    _model->endReset();
 }
 
 
-void YQTree::selectItem(QTreeWidgetItem * item, bool selected, bool recursive)
+void YQTree::selectItem( YItem * item, bool selected, bool recursive )
 {
-
-    YQTreeItem * treeItem = dynamic_cast<YQTreeItem *> (item);
-
-    if ( ! treeItem )
+    if ( ! item )
 	return;
 
-    YSelectionWidget::selectItem( treeItem->origItem(), selected );
+    YSelectionWidget::selectItem( item, selected );
 
     if ( recursive )
     {
-	for (int i=0; i < item->childCount(); ++i)
-	{
-	    QTreeWidgetItem* child = item->child(i);
-	    child->setCheckState(0, ( selected )? Qt::Checked : Qt::Unchecked );
-	    YQTree::selectItem( child, selected, recursive );
-	}
+	for ( YItemIterator it = item->childrenBegin(); it != item->childrenEnd(); ++it )
+	    YQTree::selectItem( *it, selected, recursive );
     }
-
 }
 
 
-void YQTree::slotItemChanged( QTreeWidgetItem * item )
+void YQTree::slotCheckStateToggled( YItem * item, bool checked )
 {
+    if ( recursiveSelection() )
+	YQUI::ui()->busyCursor();
 
-    YQSignalBlocker sigBlocker( _qt_treeWidget );
+    YQTree::selectItem( item, checked, recursiveSelection() );
 
-    if ( hasMultiSelection() )
-    {
-	if ( recursiveSelection() )
-	    YQUI::ui()->busyCursor();
-
-	if ( item->checkState(0) == Qt::Checked )
-	    YQTree::selectItem( item, true, recursiveSelection() );
-	else
-	    YQTree::selectItem( item, false, recursiveSelection() );
-
-
-	if ( recursiveSelection() )
-	    YQUI::ui()->normalCursor();
-
-    }
-    else
-    {
-	QList<QTreeWidgetItem *> items = _qt_treeWidget->selectedItems ();
-
-	if ( ! items.empty() )
-	{
-	    QTreeWidgetItem *qItem = items.first();
-	    selectItem( dynamic_cast<YQTreeItem *> (qItem) );
-	}
-    }
+    // The selected state of the parent and the children may have changed, too
+    _model->itemsChanged();
 
+    if ( recursiveSelection() )
+	YQUI::ui()->normalCursor();
 
     if ( notify() && ! YQUI::ui()->eventPendingFor( this ) )
 	YQUI::ui()->sendEvent( new YWidgetEvent( this, YEvent::ValueChanged ) );
 }
 
 
-void YQTree::slotItemClicked( QTreeWidgetItem * item, int column )
+void YQTree::slotItemClicked( const QModelIndex & index )
 {
-    _qt_treeWidget->setCurrentItem( item );
+    _qt_treeWidget->setCurrentIndex( index );
 
     if ( notify() && ! YQUI::ui()->eventPendingFor( this ) )
 	YQUI::ui()->sendEvent( new YWidgetEvent( this, YEvent::SelectionChanged ) );
@@ -343,13 +328,10 @@ void YQTree::slotItemClicked( QTreeWidgetItem * item, int column )
 
 void YQTree::slotSelectionChanged( )
 {
-    QList<QTreeWidgetItem *> items = _qt_treeWidget->selectedItems ();
+    QModelIndexList indexes = _qt_treeWidget->selectionModel()->selectedIndexes();
 
-    if ( ! hasMultiSelection() && ! items.empty() )
-    {
-	QTreeWidgetItem *qItem = items.first();
-	selectItem( dynamic_cast<YQTreeItem *> (qItem) );
-    }
+    if ( ! hasMultiSelection() && ! indexes.empty() )
+	selectItem( indexes.first() );
 
 
     if ( notify() && ! YQUI::ui()->eventPendingFor( this ) )
@@ -357,9 +339,9 @@ void YQTree::slotSelectionChanged( )
 }
 
 
-void YQTree::slotActivated( QTreeWidgetItem * qItem )
+void YQTree::slotActivated( const QModelIndex & index )
 {
-    selectItem( dynamic_cast<YQTreeItem *> (qItem) );
+    selectItem( index );
 
     if ( notify() )
 	YQUI::ui()->sendEvent( new YWidgetEvent( this, YEvent::Activated ) );
@@ -420,18 +402,7 @@ void YQTree::slotContextMenu ( const QPoint & pos )
 YTreeItem *
 YQTree::currentItem()
 {
-
-    QTreeWidgetItem * currentQItem = _qt_treeWidget->currentItem();
-
-    if ( currentQItem )
-    {
-	YQTreeItem * item = dynamic_cast<YQTreeItem *> (currentQItem);
-
-	if ( item )
-	    return item->origItem();
-    }
-
-    return 0;
+    return dynamic_cast<YTreeItem *> ( _model->item( _qt_treeWidget->currentIndex() ) );
 }
 
 
@@ -453,11 +424,6 @@ YQTreeItem::YQTreeItem( YQTree	*	tree,
     : QTreeWidgetItem( listView )
 {
     init( tree, orig, serial );
-
-#if VERBOSE_TREE_ITEMS
-    yuiDebug() << "Creating toplevel tree item \"" << orig->label() << "\"" << endl;
-#endif
-
 }
 
 
@@ -468,12 +434,6 @@ YQTreeItem::YQTreeItem( YQTree	*	tree,
     : QTreeWidgetItem( parentItem )
 {
     init( tree, orig, serial );
-#if VERBOSE_TREE_ITEMS
-    yuiDebug() << "Creating tree item \"" << orig->label()
-	       << "\" as child of \"" << parentItem->origItem()->label() << "\""
-	       << endl;
-
-#endif
 }
 
 
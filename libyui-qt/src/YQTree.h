@@ -26,13 +26,15 @@
 #define YQTree_h
 
 #include <QFrame>
+#include <QModelIndex>
 #include <QTreeWidget>
 
 #include <yui/YTree.h>
 
 
 class YQWidgetCaption;
-class YQTreeItem;
+class YQItemModel;
+class YQItemView;
 
 
 class YQTree : public QFrame, public YTree
@@ -61,6 +63,15 @@ public:
      **/
     virtual void setLabel( const std::string & label );
 
+    /**
+     * Set a filter string: Only items that contain it and their parent items
+     * are displayed. There is no interactive filtering in the Qt UI, so there
+     * are no FilterChanged events.
+     *
+     * Reimplemented from YTree.
+     **/
+    virtual void setFilter( const std::string & filter );
+
     /**
      * Rebuild the displayed tree from the internally stored YTreeItems.
      *
@@ -155,29 +166,34 @@ protected slots:
     void slotSelectionChanged();
 
     /**
-     * Propagate a tree item change.
+     * Propagate a check box change of a tree item.
      *
      * This will trigger a 'ValueChanged' event if 'notify' is set.
      **/
-    void slotItemChanged( QTreeWidgetItem * item);
-    void slotItemClicked( QTreeWidgetItem * item, int column );
+    void slotCheckStateToggled( YItem * item, bool checked );
+    void slotItemClicked( const QModelIndex & index );
 
     /**
      * Propagate a double click or pressing the space key on a tree item.
      *
      * This will trigger an 'Activated' event if 'notify' is set.
      **/
-    void slotActivated( QTreeWidgetItem * item);
+    void slotActivated( const QModelIndex & index );
 
     /**
      * Propagate an "item expanded" event to the underlying YTreeItem.
      **/
-    void slotItemExpanded( QTreeWidgetItem * item );
+    void slotItemExpanded( const QModelIndex & index );
 
     /**
      * Propagate an "item collapsed" event to the underlying YTreeItem.
      **/
-    void slotItemCollapsed( QTreeWidgetItem * item );
+    void slotItemCollapsed( const QModelIndex & index );
+
+    /**
+     * Notification that the model made more rows available to the view.
+     **/
+    void slotRowsInserted( const QModelIndex & parent, int first, int last );
 
     /**
      * Propagate a context menu selection
@@ -190,39 +206,43 @@ protected slots:
 protected:
 
     /**
-     * Select an item via the corresponding YQTreItem.
+     * Select an item via its model index.
      **/
-    void selectItem( YQTreeItem * item );
+    void selectItem( const QModelIndex & index );
 
     /**
      * Select or deselect an item, recursively
      **/
-    void selectItem(QTreeWidgetItem * item, bool selected, bool recursive);
+    void selectItem( YItem * item, bool selected, bool recursive );
 
     /**
-     * Open the branch of 'item' recursively to its toplevel item.
+     * Open the branch of 'index' recursively to its toplevel item.
      **/
-    void openBranch( YQTreeItem * item );
+    void openBranch( QModelIndex index );
 
     /**
-     * Build a tree of items that will be displayed (YQTreeItems) from the
-     * original items between iterators 'begin' and 'end' as child items of
-     * 'parentItem' (or as toplevel items if 'parentItem' is 0).
+     * Show the selected and open state of the original items in the rows
+     * 'first' to 'last' below 'parent' and recursively their children.
      **/
-    void buildDisplayTree( YQTreeItem *		parentItem,
-			   YItemIterator	begin,
-			   YItemIterator 	end );
+    void showItemStates( const QModelIndex & parent, int first, int last );
 
     //
     // Data members
     //
 
     YQWidgetCaption *	_caption;
-    QTreeWidget * 	_qt_treeWidget;
-    int			_nextSerialNo;
+    YQItemView *	_qt_treeWidget;
+    YQItemModel *	_model;
 };
 
 
+/**
+ * Visual representation of a YTreeItem in a QTreeWidget.
+ *
+ * OBSOLETE: YQTree shows its items through a YQItemModel and no longer
+ * creates any YQTreeItems. This class is only kept for source
+ * compatibility; it will be removed in a future release.
+ **/
 class YQTreeItem: public QTreeWidgetItem
 {
 public:
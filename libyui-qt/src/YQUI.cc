@@ -50,12 +50,15 @@
 #include <yui/YEvent.h>
 #include <yui/YCommandLine.h>
 #include <yui/YButtonBox.h>
+#include <yui/YStartupProfiler.h>
 #include <yui/YUISymbols.h>
 
 #include "YQUI.h"
 #include "QY2Styler.h"
 #include "YQApplication.h"
 #include "YQDialog.h"
+#include "YQIconCache.h"
+#include "YQLayoutScheduler.h"
 #include "YQWidgetFactory.h"
 #include "YQOptionalWidgetFactory.h"
 #include "YQWizardButton.h"
@@ -108,6 +111,8 @@ YQUI::YQUI( bool withThreads,  bool topmostConstructor )
 
     _ui				= this;
     _uiInitialized		= false;
+    _signalReceiver		= 0;
+    _layoutScheduler		= 0;
     _fatalError			= false;
     _fullscreen			= false;
     _noborder			= false;
@@ -132,6 +137,8 @@ void YQUI::initUI()
     _uiInitialized = true;
     yuiDebug() << "Initializing Qt part" << endl;
 
+    YStartupPhase phase( "YQUI::initUI" );
+
     YCommandLine cmdLine; // Retrieve command line args from /proc/<pid>/cmdline
     string progName;
 
@@ -163,6 +170,7 @@ void YQUI::initUI()
     _signalReceiver = new YQUISignalReceiver();
     _busyCursorTimer = new QTimer( _signalReceiver );
     _busyCursorTimer->setSingleShot( true );
+    _layoutScheduler = new YQLayoutScheduler( _signalReceiver );
 
     (void) QY2Styler::styler(); // Make sure QY2Styler singleton is created
 
@@ -302,7 +310,17 @@ YQUI::~YQUI()
 	qApp->deleteLater();
     }
 
-    delete _signalReceiver;
+    // The dialogs use the layout scheduler until they are deleted, so
+    // delete any left over dialogs now rather than in YUI::~YUI()
+    if ( YDialog::openDialogsCount() > 0 )
+    {
+	yuiError() << YDialog::openDialogsCount() << " open dialogs left over" << endl;
+	YDialog::deleteAllDialogs();
+    }
+
+    delete _signalReceiver;	// this includes the layout scheduler
+    _signalReceiver  = 0;
+    _layoutScheduler = 0;
 }
 
 
@@ -674,29 +692,5 @@ qMessageHandler( QtMsgType type, const QMessageLogContext &, const QString & msg
 
 QIcon YQUI::loadIcon( const string & iconName ) const
 {
-    QIcon icon;
-    const QString resource = ":/";
-
-    if ( QIcon::hasThemeIcon( iconName.c_str() ) )
-    {
-	yuiDebug() << "Trying theme icon from: " << iconName << endl;
-	icon = QIcon::fromTheme( iconName.c_str() );
-    }
-
-    if ( icon.isNull() )
-    {
-	yuiDebug() << "Trying icon from resource: " << iconName << endl;
-	icon = QIcon( resource + iconName.c_str() );
-    }
-
-    if ( icon.isNull() )
-    {
-	yuiDebug() << "Trying icon from path: " << iconName << endl;
-	icon = QIcon( iconName.c_str() );
-    }
-
-    if ( icon.isNull() )
-	yuiWarning() << "Couldn't load icon: " << iconName << endl;
-
-    return icon;
+    return YQIconCache::iconCache()->icon( iconName );
 }
@@ -55,6 +55,7 @@ class YQOptionalWidgetFactory;
 class YQWidgetFactory;
 class YQApplication;
 class YQUISignalReceiver;
+class YQLayoutScheduler;
 
 using std::string;
 using std::vector;
@@ -262,6 +263,13 @@ public:
      **/
     void timeoutBusyCursor();
 
+    /**
+     * Return the scheduler for the deferred layout passes and column
+     * resizes. It is created in initUI() and deleted in the destructor
+     * after all dialogs, so it is never 0 while there is any dialog.
+     **/
+    YQLayoutScheduler * layoutScheduler() const { return _layoutScheduler; }
+
     /**
      * Open file selection box and let the user save y2logs to that location.
      * (Shift-F8)
@@ -305,6 +313,8 @@ public:
      *
      * If no icon could be loaded, this will return a null QIcon (check with
      * icon.isNull()), and a warning is logged.
+     *
+     * Each icon is looked up only once, see YQIconCache.
      **/
     QIcon loadIcon( const string & iconName ) const;
 
@@ -374,6 +384,7 @@ protected:
     bool 		_uiInitialized;
 
     YQUISignalReceiver * _signalReceiver;
+    YQLayoutScheduler *	_layoutScheduler;
     QString 		_applicationTitle;
 
     // Qt copies the _reference_ to argc, so we need to store argc
@@ -0,0 +1,108 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Minimal widget implementations for the benchmarks, they do not need
+  any UI. Only the abstract methods are implemented.
+*/
+
+#ifndef BenchWidgets_h
+#define BenchWidgets_h
+
+#include <string>
+
+#include <yui/YCheckBox.h>
+#include <yui/YComboBox.h>
+#include <yui/YDialog.h>
+#include <yui/YInputField.h>
+#include <yui/YIntField.h>
+#include <yui/YLabel.h>
+#include <yui/YLayoutBox.h>
+
+#define BENCH_WIDGET_SIZE                                       \
+    virtual int preferredWidth() { return 10; }                 \
+    virtual int preferredHeight() { return 1; }                 \
+    virtual void setSize( int newWidth, int newHeight ) {}
+
+class BenchBox : public YLayoutBox
+{
+public:
+    BenchBox( YWidget *parent, YUIDimension dim ) : YLayoutBox( parent, dim ) {}
+    virtual void moveChild( YWidget *child, int newX, int newY ) {}
+    BENCH_WIDGET_SIZE
+};
+
+class BenchLabel : public YLabel
+{
+public:
+    BenchLabel( YWidget *parent, const std::string &text ) : YLabel( parent, text ) {}
+    BENCH_WIDGET_SIZE
+};
+
+class BenchIntField : public YIntField
+{
+public:
+    BenchIntField( YWidget *parent, const std::string &label ) : YIntField( parent, label, 0, 100 ), _value( 42 ) {}
+    virtual int value() { return _value; }
+    virtual void setValueInternal( int val ) { _value = val; }
+    BENCH_WIDGET_SIZE
+private:
+    int _value;
+};
+
+class BenchCheckBox : public YCheckBox
+{
+public:
+    BenchCheckBox( YWidget *parent, const std::string &label ) : YCheckBox( parent, label ), _value( YCheckBox_on ) {}
+    virtual YCheckBoxState value() { return _value; }
+    virtual void setValue( YCheckBoxState state ) { _value = state; }
+    BENCH_WIDGET_SIZE
+private:
+    YCheckBoxState _value;
+};
+
+class BenchInputField : public YInputField
+{
+public:
+    BenchInputField( YWidget *parent, const std::string &label ) : YInputField( parent, label ) {}
+    virtual std::string value() { return _value; }
+    virtual void setValue( const std::string &text ) { _value = text; }
+    BENCH_WIDGET_SIZE
+private:
+    std::string _value;
+};
+
+class BenchComboBox : public YComboBox
+{
+public:
+    BenchComboBox( YWidget *parent, const std::string &label ) : YComboBox( parent, label, false ) {}
+    virtual std::string text() { return "item 1"; }
+    virtual void setText( const std::string &newText ) {}
+    BENCH_WIDGET_SIZE
+};
+
+class BenchDialog : public YDialog
+{
+public:
+    BenchDialog() : YDialog( YMainDialog, YDialogNormalColor ) {}
+    virtual void activate() {}
+    virtual void openInternal() {}
+    virtual YEvent *waitForEventInternal( int timeout_millisec ) { return 0; }
+    virtual YEvent *pollEventInternal() { return 0; }
+    BENCH_WIDGET_SIZE
+};
+
+#endif // BenchWidgets_h
@@ -0,0 +1,157 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Benchmark for the widget lookups in a large dialog.
+
+  Usage:
+
+    yui-rest-api-finder [WIDGETS [ROUNDS]]
+
+  Builds a dialog with WIDGETS widgets (default 5000) and runs several
+  queries ROUNDS times (default 200) with the plain tree walk used
+  before, with the index rebuilt for each query (the dialog changed) and
+  with the index reused (the dialog did not change).
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include <yui/YWidgetID.h>
+
+#include "BenchWidgets.h"
+#include "YWidgetActionHandler.h"
+#include "YWidgetFinder.h"
+
+static void create_dialog( int widgets )
+{
+    YDialog *dialog = new BenchDialog();
+    YWidget *vbox = new BenchBox( dialog, YD_VERT );
+    int count = 2;
+
+    for ( int row = 0; count < widgets; ++row )
+    {
+        YWidget *hbox = new BenchBox( vbox, YD_HORIZ );
+        ++count;
+
+        for ( int col = 0; col < 8 && count < widgets; ++col, ++count )
+        {
+            std::string label = "Widget &" + std::to_string( count );
+            YWidget *widget;
+
+            switch ( col % 4 )
+            {
+                case 0: widget = new BenchLabel( hbox, label ); break;
+                case 1: widget = new BenchIntField( hbox, label ); break;
+                case 2: widget = new BenchCheckBox( hbox, label ); break;
+                default: widget = new BenchInputField( hbox, label ); break;
+            }
+
+            if ( count % 10 == 0 )
+                widget->setId( new YStringWidgetID( "w" + std::to_string( count ) ) );
+        }
+    }
+}
+
+// the tree walk with a filter function used before the index
+static void walk( YWidget *w, WidgetArray &array, const std::function<bool (YWidget*)> &filter )
+{
+    if ( filter( w ) )
+        array.push_back( w );
+
+    for ( YWidget *child: *w )
+        walk( child, array, filter );
+}
+
+static WidgetArray walk_find( const char *label, const char *id, const char *type )
+{
+    WidgetArray ret;
+
+    walk( YDialog::topmostDialog(), ret, [&]( YWidget *w ) {
+        return ( !label || ( w->propertySet().contains( "Label" ) &&
+                    YWidgetActionHandler::normalized_labels_equal( w->getProperty( "Label" ).stringVal(), label ) ) ) &&
+               ( !id || ( w->hasId() && w->id()->toString() == id ) ) &&
+               ( !type || w->getProperty( "WidgetClass" ).stringVal() == type );
+    });
+
+    return ret;
+}
+
+struct Query
+{
+    const char *name;
+    const char *label;
+    const char *id;
+    const char *type;
+};
+
+template<typename Find>
+static void run( const char *name, const Query &query, int rounds, Find find )
+{
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < rounds; ++i )
+        found = find( query ).size();
+
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    printf( "  %-10s %10.1f us/query  %5zu found\n", name, elapsed.count() / rounds, found );
+}
+
+int main( int argc, char **argv )
+{
+    int widgets = argc > 1 ? atoi( argv[1] ) : 5000;
+    int rounds  = argc > 2 ? atoi( argv[2] ) : 200;
+
+    create_dialog( widgets );
+    printf( "widgets: %d, rounds: %d\n", widgets, rounds );
+
+    std::string last_label = "Widget " + std::to_string( widgets - 1 );
+    std::string last_id = "w" + std::to_string( ( widgets - 1 ) / 10 * 10 );
+
+    Query queries[] = {
+        { "label",      last_label.c_str(), nullptr,         nullptr },
+        { "id",         nullptr,            last_id.c_str(), nullptr },
+        { "type",       nullptr,            nullptr,         "YCheckBox" },
+        { "type+label", "Widget 4",         nullptr,         "YIntField" },
+        { "all",        nullptr,            nullptr,         nullptr },
+    };
+
+    for ( const Query &query: queries )
+    {
+        printf( "%s:\n", query.name );
+
+        run( "walk", query, rounds, []( const Query &q ) {
+            return walk_find( q.label, q.id, q.type );
+        });
+
+        run( "rebuild", query, rounds, []( const Query &q ) {
+            // pretend the dialog has changed
+            YWidget::markChanged();
+            return YWidgetFinder::find( q.label, q.id, q.type );
+        });
+
+        run( "indexed", query, rounds, []( const Query &q ) {
+            return YWidgetFinder::find( q.label, q.id, q.type );
+        });
+    }
+
+    // The widgets are not deleted: That would need a UI to notify.
+    return 0;
+}
@@ -0,0 +1,378 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Load generator for the REST API: Runs a number of parallel clients which
+  send GET requests over keep-alive connections and reports the throughput
+  and the latency percentiles.
+
+  Usage:
+
+    yui-rest-api-latency [-p PORT | -s SOCKET] [-c CLIENTS] [-n REQUESTS] [-u USER:PASSWD] [-z] [PATH...]
+
+  Start the application with YUI_HTTP_PORT (and optionally YUI_HTTP_THREADS)
+  first, for example:
+
+    YUI_HTTP_PORT=9999 YUI_HTTP_THREADS=4 ./SelectionBox1 &
+    yui-rest-api-latency -p 9999 -c 16 -n 500 /v1/dialog /v1/widgets?type=YPushButton
+
+  or with YUI_HTTP_SOCKET for a Unix domain socket:
+
+    YUI_HTTP_SOCKET=/tmp/yui.sock ./SelectionBox1 &
+    yui-rest-api-latency -s /tmp/yui.sock /v1/dialog
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options
+{
+    int port = 9999;
+    std::string socket; // Unix domain socket path, used instead of the port
+    int clients = 8;
+    int requests = 1000;
+    std::string auth;
+    bool gzip = false;
+    std::vector<std::string> paths;
+};
+
+struct ClientResult
+{
+    std::vector<double> latencies; // in milliseconds
+    int errors = 0;
+    int reconnects = 0;
+    size_t bytes = 0; // received body bytes
+};
+
+static std::string base64(const std::string &in)
+{
+    static const char *chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    size_t i = 0;
+
+    for (; i + 2 < in.size(); i += 3)
+    {
+        unsigned v = (unsigned char) in[i] << 16 | (unsigned char) in[i + 1] << 8 | (unsigned char) in[i + 2];
+        out += chars[v >> 18 & 63];
+        out += chars[v >> 12 & 63];
+        out += chars[v >> 6 & 63];
+        out += chars[v & 63];
+    }
+
+    if (i + 1 == in.size())
+    {
+        unsigned v = (unsigned char) in[i] << 16;
+        out += chars[v >> 18 & 63];
+        out += chars[v >> 12 & 63];
+        out += "==";
+    }
+    else if (i + 2 == in.size())
+    {
+        unsigned v = (unsigned char) in[i] << 16 | (unsigned char) in[i + 1] << 8;
+        out += chars[v >> 18 & 63];
+        out += chars[v >> 12 & 63];
+        out += chars[v >> 6 & 63];
+        out += '=';
+    }
+
+    return out;
+}
+
+static int connect_to(const std::string &path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (connect(fd, (sockaddr *) &addr, sizeof(addr)) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static int connect_to(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    if (connect(fd, (sockaddr *) &addr, sizeof(addr)) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static bool send_all(int fd, const std::string &data)
+{
+    size_t sent = 0;
+
+    while (sent < data.size())
+    {
+        ssize_t n = write(fd, data.data() + sent, data.size() - sent);
+
+        if (n <= 0)
+            return false;
+
+        sent += n;
+    }
+
+    return true;
+}
+
+// Read one complete response, return the status code or -1 on error.
+// 'keep_alive' is set to false if the server closes the connection,
+// 'body_size' is set to the size of the received body.
+static int read_response(int fd, std::string &buffer, bool &keep_alive, size_t &body_size)
+{
+    size_t header_end;
+
+    while ((header_end = buffer.find("\r\n\r\n")) == std::string::npos)
+    {
+        char chunk[16384];
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+
+        if (n <= 0)
+            return -1;
+
+        buffer.append(chunk, n);
+    }
+
+    std::string header = buffer.substr(0, header_end);
+    int status = atoi(header.c_str() + header.find(' ') + 1);
+
+    // header names are case insensitive
+    std::string lower = header;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+    keep_alive = lower.find("connection: close") == std::string::npos;
+
+    size_t length = 0;
+    size_t pos = lower.find("content-length:");
+
+    if (pos != std::string::npos)
+        length = strtoul(lower.c_str() + pos + 15, nullptr, 10);
+    else
+        keep_alive = false; // read until the server closes the connection
+
+    size_t total = header_end + 4 + length;
+
+    while (buffer.size() < total || (!keep_alive && pos == std::string::npos))
+    {
+        char chunk[16384];
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+
+        if (n <= 0)
+            break;
+
+        buffer.append(chunk, n);
+    }
+
+    if (buffer.size() < total)
+        return -1;
+
+    body_size = pos == std::string::npos ? buffer.size() - header_end - 4 : length;
+    buffer.erase(0, total);
+    return status;
+}
+
+static void run_client(const Options &options, int id, ClientResult &result)
+{
+    std::vector<std::string> requests;
+
+    for (const std::string &path: options.paths)
+    {
+        std::string request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n";
+
+        if (!options.auth.empty())
+            request += "Authorization: Basic " + base64(options.auth) + "\r\n";
+
+        if (options.gzip)
+            request += "Accept-Encoding: gzip\r\n";
+
+        requests.push_back(request + "\r\n");
+    }
+
+    result.latencies.reserve(options.requests);
+
+    int fd = -1;
+    std::string buffer;
+
+    for (int i = 0; i < options.requests; ++i)
+    {
+        const std::string &request = requests[(id + i) % requests.size()];
+        Clock::time_point start = Clock::now();
+
+        if (fd < 0)
+        {
+            fd = options.socket.empty() ? connect_to(options.port) : connect_to(options.socket);
+            buffer.clear();
+            ++result.reconnects;
+        }
+
+        bool keep_alive = true;
+        int status = -1;
+        size_t body_size = 0;
+
+        if (fd >= 0 && send_all(fd, request))
+            status = read_response(fd, buffer, keep_alive, body_size);
+
+        if (status < 0 || !keep_alive)
+        {
+            if (fd >= 0)
+                close(fd);
+            fd = -1;
+        }
+
+        if (status != 200)
+        {
+            ++result.errors;
+            continue;
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        result.latencies.push_back(elapsed.count());
+        result.bytes += body_size;
+    }
+
+    if (fd >= 0)
+        close(fd);
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    size_t index = (size_t) (p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-p PORT | -s SOCKET] [-c CLIENTS] [-n REQUESTS] [-u USER:PASSWD] [-z] [PATH...]\n\n"
+        "  -p PORT      port of the REST API server (default 9999)\n"
+        "  -s SOCKET    Unix domain socket of the REST API server\n"
+        "  -c CLIENTS   number of parallel clients (default 8)\n"
+        "  -n REQUESTS  number of requests per client (default 1000)\n"
+        "  -u USER:PWD  HTTP basic authentication credentials\n"
+        "  -z           accept gzip compressed responses\n"
+        "  PATH         request paths, used round robin (default /v1/dialog)\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:s:c:n:u:zh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p': options.port = atoi(optarg); break;
+            case 's': options.socket = optarg; break;
+            case 'c': options.clients = std::max(1, atoi(optarg)); break;
+            case 'n': options.requests = std::max(1, atoi(optarg)); break;
+            case 'u': options.auth = optarg; break;
+            case 'z': options.gzip = true; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    for (int i = optind; i < argc; ++i)
+        options.paths.push_back(argv[i]);
+
+    if (options.paths.empty())
+        options.paths.push_back("/v1/dialog");
+
+    std::vector<ClientResult> results(options.clients);
+    std::vector<std::thread> threads;
+    Clock::time_point start = Clock::now();
+
+    for (int i = 0; i < options.clients; ++i)
+        threads.emplace_back(run_client, std::cref(options), i, std::ref(results[i]));
+
+    for (std::thread &thread: threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    std::vector<double> latencies;
+    int errors = 0;
+    int connections = 0;
+    size_t bytes = 0;
+
+    for (const ClientResult &result: results)
+    {
+        latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+        errors += result.errors;
+        connections += result.reconnects;
+        bytes += result.bytes;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("clients:     %d\n", options.clients);
+    printf("requests:    %zu ok, %d failed\n", latencies.size(), errors);
+    printf("connections: %d\n", connections);
+    printf("throughput:  %.1f requests/s, %.2f MB/s\n", latencies.size() / elapsed.count(),
+        bytes / elapsed.count() / (1024 * 1024));
+    printf("body size:   %.0f bytes/response\n", latencies.empty() ? 0.0 : (double) bytes / latencies.size());
+    printf("latency ms:  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n",
+        percentile(latencies, 50), percentile(latencies, 90),
+        percentile(latencies, 99), latencies.empty() ? 0.0 : latencies.back());
+
+    return errors ? 1 : 0;
+}
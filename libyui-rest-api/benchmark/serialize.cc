@@ -0,0 +1,135 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Benchmark for the JSON serialization of a large widget tree.
+
+  Usage:
+
+    yui-rest-api-serialize [WIDGETS [ROUNDS]]
+
+  Builds a widget tree with WIDGETS widgets (default 5000) without any UI
+  (so only widgets which do not need the UI application can be used)
+  and serializes it ROUNDS times (default 20) in the indented and in the
+  compact mode. Then the compact output is compressed like the HTTP
+  responses for the clients accepting gzip.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include "BenchWidgets.h"
+#include "YHttpCompression.h"
+#include "YJsonSerializer.h"
+
+static YWidget *create_tree( int widgets )
+{
+    YWidget *root = new BenchBox( 0, YD_VERT );
+    int count = 1;
+
+    for ( int row = 0; count < widgets; ++row )
+    {
+        YWidget *hbox = new BenchBox( root, YD_HORIZ );
+        ++count;
+
+        for ( int col = 0; col < 8 && count < widgets; ++col, ++count )
+        {
+            std::string label = "Widget " + std::to_string( count ) + " \"äöü\"";
+
+            switch ( col % 5 )
+            {
+                case 0: new BenchLabel( hbox, label ); break;
+                case 1: new BenchIntField( hbox, label ); break;
+                case 2: new BenchCheckBox( hbox, label ); break;
+                case 3:
+                {
+                    BenchInputField *input = new BenchInputField( hbox, label );
+                    input->setValue( "value " + std::to_string( count ) );
+                    break;
+                }
+                case 4:
+                {
+                    BenchComboBox *combo = new BenchComboBox( hbox, label );
+                    combo->addItem( new YItem( "item 1" ) );
+                    combo->addItem( new YItem( "item 2", true ) );
+                    break;
+                }
+            }
+        }
+    }
+
+    return root;
+}
+
+// 'serialize' returns the output size, the throughput is computed from
+// 'input' if set (for the compression) or from the output
+template<typename Serialize>
+static void run( const char *name, int rounds, Serialize serialize, size_t input = 0 )
+{
+    size_t size = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for ( int i = 0; i < rounds; ++i )
+        size = serialize();
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    double ms = elapsed.count() / rounds;
+    printf( "%-16s %8.3f ms/round  %9zu bytes  %8.1f MB/s\n", name, ms, size,
+            ( input ? input : size ) / ms * 1000 / ( 1024 * 1024 ) );
+}
+
+int main( int argc, char **argv )
+{
+    int widgets = argc > 1 ? atoi( argv[1] ) : 5000;
+    int rounds  = argc > 2 ? atoi( argv[2] ) : 20;
+
+    YWidget *root = create_tree( widgets );
+    printf( "widgets: %d, rounds: %d\n", widgets, rounds );
+
+    run( "stream", rounds, [&]() {
+        std::ostringstream output;
+        YJsonSerializer::serialize( root, output );
+        return output.str().size();
+    });
+
+    std::string buffer;
+
+    run( "buffer", rounds, [&]() {
+        buffer.clear();
+        YJsonSerializer::serialize( root, buffer, false );
+        return buffer.size();
+    });
+
+    run( "buffer compact", rounds, [&]() {
+        buffer.clear();
+        YJsonSerializer::serialize( root, buffer, true );
+        return buffer.size();
+    });
+
+    std::string compressed;
+
+    run( "gzip", rounds, [&]() {
+        compressed = buffer;
+        YHttpCompression::compress( compressed, YHttpCompression::GZIP );
+        return compressed.size();
+    }, buffer.size() );
+
+    // The widgets are not deleted: That would need a UI to notify.
+    return 0;
+}
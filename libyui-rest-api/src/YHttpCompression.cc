@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+#include <microhttpd.h>
+#include <zlib.h>
+
+#include "YHttpResponseBody.h"
+#include "YHttpServer.h"
+#include "YHttpCompression.h"
+
+YHttpCompression::Encoding YHttpCompression::accepted(struct MHD_Connection *connection)
+{
+    static bool enabled = !getenv(YUI_HTTP_COMPRESS) || strcmp(getenv(YUI_HTTP_COMPRESS), "0") != 0;
+
+    if (!enabled)
+        return NONE;
+
+    return parse(MHD_lookup_connection_value(connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_ACCEPT_ENCODING));
+}
+
+YHttpCompression::Encoding YHttpCompression::parse(const char *accept_encoding)
+{
+    if (!accept_encoding)
+        return NONE;
+
+    // -1: not listed, 0: not acceptable, 1: acceptable
+    int gzip = -1;
+    int deflate = -1;
+    int any = -1;
+    const char *pos = accept_encoding;
+
+    // a comma separated list of the encodings with optional quality values,
+    // e.g. "gzip;q=1.0, deflate;q=0.5, *;q=0", q=0 means not acceptable
+    while (*pos)
+    {
+        while (*pos == ' ' || *pos == '\t' || *pos == ',')
+            ++pos;
+
+        const char *end = pos;
+        while (*end && *end != ',' && *end != ';' && *end != ' ' && *end != '\t')
+            ++end;
+
+        size_t len = end - pos;
+        bool acceptable = true;
+
+        while (*end && *end != ',')
+        {
+            if (*end == 'q' && end[1] == '=')
+                acceptable = strtod(end + 2, nullptr) > 0;
+            ++end;
+        }
+
+        if (len == 4 && strncasecmp(pos, "gzip", len) == 0)
+            gzip = acceptable;
+        else if (len == 7 && strncasecmp(pos, "deflate", len) == 0)
+            deflate = acceptable;
+        else if (len == 1 && *pos == '*')
+            any = acceptable;
+
+        pos = end;
+    }
+
+    // an explicitly listed encoding takes precedence over "*"
+    if (gzip < 0)
+        gzip = any > 0;
+    if (deflate < 0)
+        deflate = any > 0;
+
+    return gzip > 0 ? GZIP : deflate > 0 ? DEFLATE : NONE;
+}
+
+const char *YHttpCompression::name(Encoding encoding)
+{
+    switch (encoding)
+    {
+        case GZIP: return "gzip";
+        case DEFLATE: return "deflate";
+        default: return nullptr;
+    }
+}
+
+bool YHttpCompression::compress(std::string &data, Encoding encoding)
+{
+    if (encoding == NONE)
+        return false;
+
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+
+    // the fastest level, the JSON compresses well anyway and the
+    // compression should not be slower than sending the data
+    int window_bits = encoding == GZIP ? MAX_WBITS + 16 : MAX_WBITS;
+
+    if (deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+
+    std::string output = YHttpResponseBody::take_buffer();
+    output.resize(deflateBound(&stream, data.size()));
+
+    stream.next_in = (Bytef *) data.data();
+    stream.avail_in = data.size();
+    stream.next_out = (Bytef *) &output[0];
+    stream.avail_out = output.size();
+
+    // the output buffer is large enough for the whole data
+    int ret = deflate(&stream, Z_FINISH);
+    size_t size = stream.total_out;
+    deflateEnd(&stream);
+
+    if (ret != Z_STREAM_END)
+    {
+        YHttpResponseBody::recycle(std::move(output));
+        return false;
+    }
+
+    output.resize(size);
+    data.swap(output);
+    YHttpResponseBody::recycle(std::move(output));
+    return true;
+}
@@ -0,0 +1,70 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YHttpCompression_h
+#define YHttpCompression_h
+
+#include <string>
+
+struct MHD_Connection;
+
+/**
+ * The gzip/deflate compression of the response bodies. The large JSON
+ * dumps (e.g. of the package selector) usually shrink to about a tenth.
+ **/
+class YHttpCompression
+{
+
+public:
+
+    enum Encoding
+    {
+        NONE,
+        GZIP,
+        DEFLATE
+    };
+
+    /**
+     * Smaller bodies are not compressed, it would not save anything.
+     **/
+    static const size_t MIN_SIZE = 1024;
+
+    /**
+     * The best encoding accepted by the client (from the Accept-Encoding
+     * header). Returns NONE if the compression is disabled by
+     * YUI_HTTP_COMPRESS=0.
+     **/
+    static Encoding accepted(struct MHD_Connection *connection);
+
+    /**
+     * The best encoding from an Accept-Encoding header value.
+     **/
+    static Encoding parse(const char *accept_encoding);
+
+    /**
+     * The name of the encoding for the Content-Encoding header,
+     * nullptr for NONE.
+     **/
+    static const char *name(Encoding encoding);
+
+    /**
+     * Replace 'data' with the compressed data (using a pooled buffer).
+     * @return false if compression failed, 'data' is unchanged then
+     **/
+    static bool compress(std::string &data, Encoding encoding);
+};
+
+#endif // YHttpCompression_h
@@ -29,6 +29,8 @@ public:
 
 protected:
 
+    virtual bool cacheable() const { return true; }
+
     virtual void process_request(struct MHD_Connection* connection,
         const char* url, const char* method, const char* upload_data,
         size_t* upload_data_size, std::ostream& body, int& error_code,
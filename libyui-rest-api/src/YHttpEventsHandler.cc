@@ -0,0 +1,468 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+#define YUILogComponent "rest-api"
+#include <yui/YUILog.h>
+
+#include <yui/YDialog.h>
+#include <yui/YEvent.h>
+#include <yui/YEventFilter.h>
+#include <yui/YItem.h>
+
+#include "YHttpEventsHandler.h"
+#include "YHttpServer.h"
+#include "YJsonSerializer.h"
+#include "YJsonWriter.h"
+
+// maximum size of the unsent messages for a client (in bytes)
+#define MAX_CLIENT_BUFFER (1024 * 1024)
+
+struct YHttpEventsHandler::Client
+{
+    Client(struct MHD_Connection *conn, YHttpEventsHandler *events)
+        : connection(conn), handler(events), offset(0), size(0),
+          fresh(true), suspended(false), closed(false)
+    {}
+
+    struct MHD_Connection *connection;
+    YHttpEventsHandler *handler;
+    std::deque<std::shared_ptr<const std::string>> messages;
+    // already sent part of the first message
+    size_t offset;
+    // size of the queued messages
+    size_t size;
+    // the client has not received the initial dialog yet
+    bool fresh;
+    bool suspended;
+    bool closed;
+};
+
+/**
+ * Event filter which passes all events of a dialog to the event streams.
+ **/
+class YHttpEventFilter : public YEventFilter
+{
+public:
+
+    YHttpEventFilter(YDialog *dialog, YHttpEventsHandler *handler)
+        : YEventFilter(dialog), _handler(handler)
+    {}
+
+    virtual ~YHttpEventFilter()
+    {
+        if (_handler)
+            _handler->filter_deleted(dialog());
+    }
+
+    virtual YEvent *filter(YEvent *event)
+    {
+        if (_handler && event)
+            _handler->send_event(event);
+
+        // never change the event
+        return event;
+    }
+
+    void detach() { _handler = nullptr; }
+
+private:
+
+    YHttpEventsHandler *_handler;
+};
+
+YHttpEventsHandler::YHttpEventsHandler()
+    : _fresh_clients(false), _revision(0), _dialog_serial(0), _dialog_count(0)
+{
+}
+
+YHttpEventsHandler::~YHttpEventsHandler()
+{
+    // the dialogs would call the deleted handler
+    for (auto &filter: _filters)
+    {
+        filter.second->detach();
+        delete filter.second;
+    }
+}
+
+MHD_RESULT YHttpEventsHandler::handle(struct MHD_Connection* connection,
+        const char* url, const char* method, const char* upload_data,
+        size_t* upload_data_size, bool *redraw)
+{
+    YHttpServer *server = YHttpServer::yserver();
+
+    // waiting for the next events needs suspending the connection
+    if (!server || !server->can_suspend())
+    {
+        const char *error = "{ \"error\" : \"Event streams are not supported\" }\n";
+        struct MHD_Response *response = MHD_create_response_from_buffer(strlen(error),
+            (void *) error, MHD_RESPMEM_PERSISTENT);
+        MHD_add_response_header(response, MHD_HTTP_HEADER_CONTENT_TYPE, "application/json");
+        MHD_RESULT ret = MHD_queue_response(connection, MHD_HTTP_SERVICE_UNAVAILABLE, response);
+        MHD_destroy_response(response);
+        return ret;
+    }
+
+    std::shared_ptr<Client> *client = new std::shared_ptr<Client>(std::make_shared<Client>(connection, this));
+
+    // the chunked response is read by read_callback() until the client disconnects
+    struct MHD_Response *response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, 4096,
+        &read_callback, client, &free_callback);
+
+    if (!response)
+    {
+        delete client;
+        return MHD_NO;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _clients.push_back(*client);
+        _fresh_clients = true;
+    }
+
+    server->update_timer();
+
+    yuiHttpLog() << "Starting an event stream" << std::endl;
+
+    MHD_add_response_header(response, MHD_HTTP_HEADER_CONTENT_TYPE, "text/event-stream");
+    MHD_add_response_header(response, MHD_HTTP_HEADER_CACHE_CONTROL, "no-cache");
+
+    // the response is released together with the connection, the free
+    // callback then removes the client
+    MHD_RESULT ret = MHD_queue_response(connection, MHD_HTTP_OK, response);
+    MHD_destroy_response(response);
+    return ret;
+}
+
+ssize_t YHttpEventsHandler::read_callback(void *cls, uint64_t pos, char *buf, size_t max)
+{
+    Client *client = static_cast<std::shared_ptr<Client> *>(cls)->get();
+    return client->handler->read(client, buf, max);
+}
+
+void YHttpEventsHandler::free_callback(void *cls)
+{
+    std::shared_ptr<Client> *client = static_cast<std::shared_ptr<Client> *>(cls);
+    (*client)->handler->remove_client(client->get());
+    delete client;
+}
+
+ssize_t YHttpEventsHandler::read(Client *client, char *buf, size_t max)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t ret = 0;
+
+    while (ret < max && !client->messages.empty())
+    {
+        const std::string &message = *client->messages.front();
+        size_t len = std::min(max - ret, message.size() - client->offset);
+
+        memcpy(buf + ret, message.data() + client->offset, len);
+        ret += len;
+        client->offset += len;
+
+        if (client->offset == message.size())
+        {
+            client->size -= message.size();
+            client->offset = 0;
+            client->messages.pop_front();
+        }
+    }
+
+    if (ret > 0)
+        return ret;
+
+    if (client->closed)
+        return MHD_CONTENT_READER_END_OF_STREAM;
+
+    // nothing to send, sleep until the next message (returning 0 without
+    // suspending would make the server busy loop)
+    client->suspended = true;
+    MHD_suspend_connection(client->connection);
+    return 0;
+}
+
+void YHttpEventsHandler::remove_client(Client *client)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _clients.erase(std::remove_if(_clients.begin(), _clients.end(),
+            [client](const std::shared_ptr<Client> &c) { return c.get() == client; }), _clients.end());
+    }
+
+    yuiHttpLog() << "Finished an event stream" << std::endl;
+
+    if (YHttpServer *server = YHttpServer::yserver())
+        server->update_timer();
+}
+
+bool YHttpEventsHandler::has_clients()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_clients.empty();
+}
+
+void YHttpEventsHandler::close_all()
+{
+    std::vector<struct MHD_Connection *> resume;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (auto &client: _clients)
+        {
+            client->closed = true;
+
+            if (client->suspended)
+            {
+                client->suspended = false;
+                resume.push_back(client->connection);
+            }
+        }
+    }
+
+    for (struct MHD_Connection *connection: resume)
+        MHD_resume_connection(connection);
+}
+
+void YHttpEventsHandler::send(const char *type, const std::string &data, bool fresh)
+{
+    std::string text = "event: ";
+    text += type;
+    text += "\nid: ";
+    text += std::to_string(YWidget::changeRevision());
+    // compact JSON, it never contains a new line
+    text += "\ndata: ";
+    text += data;
+    text += "\n\n";
+
+    std::shared_ptr<const std::string> message = std::make_shared<std::string>(std::move(text));
+    std::shared_ptr<const std::string> overflow;
+    std::vector<struct MHD_Connection *> resume;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (auto &client: _clients)
+        {
+            if (client->closed || client->fresh != fresh)
+                continue;
+
+            client->fresh = false;
+
+            if (client->size + message->size() > MAX_CLIENT_BUFFER)
+            {
+                // drop the queued messages except the partially sent one
+                // and tell the client to read the current state again
+                if (!overflow)
+                    overflow = std::make_shared<std::string>("event: overflow\ndata: {}\n\n");
+
+                while (client->messages.size() > (client->offset > 0 ? 1 : 0))
+                {
+                    client->size -= client->messages.back()->size();
+                    client->messages.pop_back();
+                }
+
+                client->messages.push_back(overflow);
+                client->size += overflow->size();
+            }
+            else
+            {
+                client->messages.push_back(message);
+                client->size += message->size();
+            }
+
+            if (client->suspended)
+            {
+                client->suspended = false;
+                resume.push_back(client->connection);
+            }
+        }
+    }
+
+    // resume outside the lock, a server thread might be reading meanwhile
+    for (struct MHD_Connection *connection: resume)
+        MHD_resume_connection(connection);
+}
+
+void YHttpEventsHandler::send_event(YEvent *event)
+{
+    if (!has_clients())
+        return;
+
+    std::string data;
+    YJsonWriter json(data, true);
+
+    json.begin_object();
+    json.member("type", YEvent::toString(event->eventType()));
+
+    if (YWidgetEvent *widget_event = dynamic_cast<YWidgetEvent *>(event))
+        json.member("reason", YEvent::toString(widget_event->reason()));
+
+    if (YKeyEvent *key_event = dynamic_cast<YKeyEvent *>(event))
+        json.member("key", key_event->keySymbol());
+
+    if (YMenuEvent *menu_event = dynamic_cast<YMenuEvent *>(event))
+    {
+        if (menu_event->item())
+            json.member("item", menu_event->item()->label());
+        else
+            json.member("id", menu_event->id());
+    }
+
+    if (event->widget())
+    {
+        std::string widget;
+        YJsonSerializer::serialize(event->widget(), widget, true, false);
+        json.key("widget");
+        json.raw(widget);
+    }
+
+    json.end_object();
+    send("event", data);
+}
+
+void YHttpEventsHandler::update()
+{
+    bool fresh;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        fresh = _fresh_clients;
+        _fresh_clients = false;
+
+        if (_clients.empty())
+        {
+            // start from scratch when a client connects again
+            _dialog_serial = 0;
+            _dialog_count = 0;
+            _widgets.clear();
+            return;
+        }
+    }
+
+    YDialog *dialog = YDialog::topmostDialog(false);
+    unsigned long long dialog_serial = dialog ? dialog->serial() : 0;
+    int count = YDialog::openDialogsCount();
+    unsigned long long revision = YWidget::changeRevision();
+
+    if (revision != _revision || dialog_serial != _dialog_serial || count != _dialog_count)
+    {
+        _revision = revision;
+
+        if (dialog_serial != _dialog_serial || count != _dialog_count)
+        {
+            const char *action = count > _dialog_count ? "open" : (count < _dialog_count ? "close" : "replace");
+            send("dialog", dialog_change(action, dialog, count));
+
+            _dialog_serial = dialog_serial;
+            _dialog_count = count;
+            _widgets.clear();
+
+            if (dialog)
+                snapshot(dialog, _widgets);
+        }
+        else if (dialog)
+        {
+            WidgetMap widgets;
+            snapshot(dialog, widgets);
+
+            for (const auto &widget: widgets)
+            {
+                auto old = _widgets.find(widget.first);
+
+                if (old == _widgets.end())
+                    send("widget", widget_change("added", widget.second));
+                else if (old->second != widget.second)
+                    send("widget", widget_change("changed", widget.second));
+            }
+
+            for (const auto &widget: _widgets)
+            {
+                if (widgets.find(widget.first) == widgets.end())
+                    send("widget", widget_change("removed", widget.second));
+            }
+
+            _widgets.swap(widgets);
+        }
+    }
+
+    // watch the events in the topmost dialog
+    if (dialog && _filters.find(dialog) == _filters.end())
+        _filters[dialog] = new YHttpEventFilter(dialog, this);
+
+    // the new clients start with the complete current dialog
+    if (fresh)
+        send("dialog", dialog_change("current", dialog, count), true);
+}
+
+void YHttpEventsHandler::filter_deleted(YDialog *dialog)
+{
+    _filters.erase(dialog);
+}
+
+void YHttpEventsHandler::snapshot(YWidget *widget, WidgetMap &widgets)
+{
+    std::string &json = widgets[widget->serial()];
+    YJsonSerializer::serialize(widget, json, true, false);
+
+    for (YWidgetListConstIterator it = widget->childrenBegin(); it != widget->childrenEnd(); ++it)
+        snapshot(*it, widgets);
+}
+
+std::string YHttpEventsHandler::widget_change(const char *change, const std::string &widget)
+{
+    std::string data;
+    YJsonWriter json(data, true);
+
+    json.begin_object();
+    json.member("change", change);
+    json.key("widget");
+    json.raw(widget);
+    json.end_object();
+
+    return data;
+}
+
+std::string YHttpEventsHandler::dialog_change(const char *action, YDialog *dialog, int count)
+{
+    std::string data;
+    YJsonWriter json(data, true);
+
+    json.begin_object();
+    json.member("action", action);
+    json.member("dialogs", count);
+    json.key("dialog");
+
+    if (dialog)
+    {
+        std::string widgets;
+        YJsonSerializer::serialize(dialog, widgets, true);
+        json.raw(widgets);
+    }
+    else
+        json.raw("null");
+
+    json.end_object();
+
+    return data;
+}
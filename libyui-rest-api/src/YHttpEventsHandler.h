@@ -0,0 +1,129 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YHttpEventsHandler_h
+#define YHttpEventsHandler_h
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "YHttpHandler.h"
+
+class YDialog;
+class YEvent;
+class YWidget;
+class YHttpEventFilter;
+
+/**
+ * Handler for the "/events" stream of the UI changes (server-sent events).
+ *
+ * The clients receive these events as they happen:
+ *
+ *   - "dialog": a dialog has been opened or closed, contains the complete
+ *     topmost dialog (also sent as the first event after connecting)
+ *   - "widget": a widget in the topmost dialog has been added, changed
+ *     or removed, contains the widget properties
+ *   - "event": a YEvent delivered to the application
+ *   - "overflow": the client does not read fast enough and some events
+ *     have been dropped, it should read the whole dialog again
+ *
+ * The changes are found by comparing the widget properties when the widget
+ * change revision changes (see YWidget::changeRevision()). This only
+ * happens while there are any clients connected.
+ **/
+class YHttpEventsHandler : public YHttpHandler
+{
+
+public:
+
+    YHttpEventsHandler();
+    virtual ~YHttpEventsHandler();
+
+    virtual MHD_RESULT handle(struct MHD_Connection* connection,
+        const char* url, const char* method, const char* upload_data,
+        size_t* upload_data_size, bool *redraw = nullptr);
+
+    /**
+     * Check the UI for changes and send them to the clients.
+     * Called periodically in the UI thread.
+     **/
+    void update();
+
+    /**
+     * Send an event to the clients. Called in the UI thread.
+     **/
+    void send_event(YEvent *event);
+
+    /**
+     * Finish all streams, called before stopping the server.
+     **/
+    void close_all();
+
+    /**
+     * Whether any client is connected.
+     **/
+    bool has_clients();
+
+    struct Client;
+
+protected:
+
+    virtual bool needs_ui_thread() const { return false; }
+
+    // not used, the stream is created in handle()
+    virtual void process_request(struct MHD_Connection* connection,
+        const char* url, const char* method, const char* upload_data,
+        size_t* upload_data_size, std::ostream& body, int& error_code,
+        std::string& content_type, bool *redraw) {}
+
+private:
+
+    friend class YHttpEventFilter;
+
+    // the serialized widgets by their serial (not by their address, a new
+    // widget might get the address of a deleted one)
+    typedef std::map<unsigned long long, std::string> WidgetMap;
+
+    // append the message to the clients, only to the new ones if 'fresh'
+    void send(const char *type, const std::string &data, bool fresh = false);
+    void remove_client(Client *client);
+    ssize_t read(Client *client, char *buf, size_t max);
+
+    static ssize_t read_callback(void *cls, uint64_t pos, char *buf, size_t max);
+    static void free_callback(void *cls);
+    void filter_deleted(YDialog *dialog);
+
+    static void snapshot(YWidget *widget, WidgetMap &widgets);
+    static std::string widget_change(const char *change, const std::string &widget);
+    std::string dialog_change(const char *action, YDialog *dialog, int count);
+
+    // the clients, shared with the HTTP server threads
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<Client>> _clients;
+    bool _fresh_clients;
+
+    // the state sent to the clients, used only in the UI thread
+    unsigned long long _revision;
+    unsigned long long _dialog_serial;
+    int _dialog_count;
+    WidgetMap _widgets;
+    std::map<YDialog *, YHttpEventFilter *> _filters;
+};
+
+#endif // YHttpEventsHandler_h
@@ -16,35 +16,160 @@
 
 #include <json/json.h>
 #include <microhttpd.h>
-#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
 
 #define YUILogComponent "rest-api"
 #include <yui/YUILog.h>
+#include <yui/YWidget.h>
 
 #include "YJsonSerializer.h"
 #include "YHttpHandler.h"
+#include "YHttpResponseBody.h"
+#include "YHttpServer.h"
 
 
 MHD_RESULT YHttpHandler::handle(struct MHD_Connection* connection,
         const char* url, const char* method, const char* upload_data,
         size_t* upload_data_size, bool *redraw)
 {
-    std::ostringstream body_s;
+    YHttpServer *server = YHttpServer::yserver();
+    bool resumed = server && server->resumed(connection, true);
+    YHttpCompression::Encoding accepted = YHttpCompression::accepted(connection);
+    std::string cache_key;
+    const char* if_none_match = nullptr;
+
+    if (cacheable())
+    {
+        // the compressed and the uncompressed responses are cached separately
+        cache_key = YHttpResponseCache::key(connection);
+        if (accepted != YHttpCompression::NONE)
+            cache_key += YHttpCompression::name(accepted);
+
+        if_none_match = MHD_lookup_connection_value(connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_NONE_MATCH);
+    }
+
+    // "?compact=1" requests JSON without indentation
+    const char* compact = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "compact");
+    YHttpResponseBody *body = new YHttpResponseBody(compact && strcmp(compact, "0") != 0 && strcmp(compact, "false") != 0);
+    std::ostream body_s(body);
     std::string content_type;
     int error_code;
+    // the revision of the processed data, read in the thread which accesses the widgets
+    unsigned long long revision = 0;
+    bool not_modified = false;
+    std::shared_ptr<const std::string> cached_data;
+    YHttpCompression::Encoding cached_encoding = YHttpCompression::NONE;
+
+    auto process = [&]() {
+        revision = YWidget::changeRevision();
+
+        // The application does not mark its own widget changes, the revision
+        // only changes when a dialog waits for the next event. Check the
+        // revision here in the UI thread, a server thread would see the
+        // old revision while the application is changing the widgets.
+        if (cacheable())
+        {
+            if (if_none_match && YHttpResponseCache::etag_matches(if_none_match, YHttpResponseCache::etag(revision, accepted)))
+            {
+                not_modified = true;
+                return;
+            }
+
+            if (_cache.lookup(cache_key, revision, cached_data, content_type, cached_encoding))
+                return;
+        }
+
+        process_request(connection, url, method, upload_data, upload_data_size,
+          body_s, error_code, content_type, redraw);
+    };
+
+    if (!needs_ui_thread() || !server)
+        process();
+    else if (!server->run_in_ui_thread(process))
+    {
+        content_type = "application/json";
+        error_code = handle_error(body_s, "The UI is shutting down", MHD_HTTP_SERVICE_UNAVAILABLE);
+    }
+
+    if (not_modified)
+    {
+        delete body;
+
+        // long polling, wait for a change (only once, a resumed request timed out)
+        const char* timeout = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "timeout");
+        int timeout_ms = timeout ? atoi(timeout) : 0;
+
+        if (!resumed && timeout_ms > 0 && server && server->wait_for_change(connection, revision, timeout_ms))
+            return MHD_YES;
+
+        struct MHD_Response *response = MHD_create_response_from_buffer(0, nullptr, MHD_RESPMEM_PERSISTENT);
+        return queue_response(connection, MHD_HTTP_NOT_MODIFIED, response, "",
+            YHttpResponseCache::etag(revision, accepted), 0);
+    }
 
-    process_request(connection, url, method, upload_data, upload_data_size,
-      body_s, error_code, content_type, redraw);
+    if (cached_data)
+    {
+        delete body;
 
-    std::string body_str = body_s.str();
-    struct MHD_Response *response = MHD_create_response_from_buffer (body_str.length(),
-		      (void *) body_str.c_str(), MHD_RESPMEM_MUST_COPY);
+        yuiHttpLog() << "Using the cached response" << std::endl;
+        return queue_response(connection, MHD_HTTP_OK, YHttpResponseBody::create_response(cached_data),
+            content_type, YHttpResponseCache::etag(revision, accepted), cached_data->size(), cached_encoding);
+    }
 
+    size_t body_size = body->data().size();
+
+    // compress outside of the UI thread callback, with the server threads
+    // the UI is not blocked by that
+    YHttpCompression::Encoding encoding = YHttpCompression::NONE;
+
+    if (body_size >= YHttpCompression::MIN_SIZE && YHttpCompression::compress(body->data(), accepted))
+        encoding = accepted;
+
+    if (!cacheable())
+    {
+        // the response takes over the body buffer
+        return queue_response(connection, error_code, YHttpResponseBody::create_response(body),
+            content_type, "", body_size, encoding);
+    }
+
+    std::shared_ptr<const std::string> data = YHttpResponseBody::release(body);
+
+    // cache only the successful responses, the errors are cheap
+    if (error_code == MHD_HTTP_OK)
+        _cache.store(cache_key, revision, data, content_type, encoding);
+
+    return queue_response(connection, error_code, YHttpResponseBody::create_response(data),
+        content_type, error_code == MHD_HTTP_OK ? YHttpResponseCache::etag(revision, accepted) : "",
+        body_size, encoding);
+}
+
+MHD_RESULT YHttpHandler::queue_response(struct MHD_Connection* connection, int error_code,
+        struct MHD_Response* response, const std::string& content_type,
+        const std::string& etag, size_t body_size, YHttpCompression::Encoding encoding)
+{
     if (!content_type.empty())
+    {
         MHD_add_response_header(response, MHD_HTTP_HEADER_CONTENT_TYPE, content_type.c_str());
+        // the body depends on the accepted compression
+        MHD_add_response_header(response, MHD_HTTP_HEADER_VARY, MHD_HTTP_HEADER_ACCEPT_ENCODING);
+    }
+
+    if (encoding != YHttpCompression::NONE)
+        MHD_add_response_header(response, MHD_HTTP_HEADER_CONTENT_ENCODING, YHttpCompression::name(encoding));
+
+    if (!etag.empty())
+    {
+        MHD_add_response_header(response, MHD_HTTP_HEADER_ETAG, etag.c_str());
+        // the clients must always revalidate, the data can change any time
+        MHD_add_response_header(response, MHD_HTTP_HEADER_CACHE_CONTROL, "no-cache");
+    }
 
-    yuiMilestone() << "Sending response: code: " << error_code << ", body size: " << body_str.length()
-      << ", content type: " << content_type << std::endl;
+    yuiHttpLog() << "Sending response: code: " << error_code << ", body size: " << body_size
+      << ", content type: " << content_type
+      << (encoding != YHttpCompression::NONE ? ", encoding: " : "")
+      << (encoding != YHttpCompression::NONE ? YHttpCompression::name(encoding) : "") << std::endl;
 
     MHD_RESULT ret = MHD_queue_response(connection, error_code, response);
     MHD_destroy_response (response);
@@ -34,6 +34,9 @@
 #include <string>
 #include <iostream>
 
+#include "YHttpCompression.h"
+#include "YHttpResponseCache.h"
+
 struct MHD_Connection;
 
 class YHttpHandler
@@ -51,12 +54,41 @@ public:
 
 protected:
 
+    /**
+     * Whether process_request() accesses the UI and must run in the UI
+     * thread. Handlers which do not touch any widget can override this
+     * to be processed directly in the HTTP server thread.
+     */
+    virtual bool needs_ui_thread() const { return true; }
+
+    /**
+     * Whether the response only depends on the widget change revision
+     * (YWidget::changeRevision()) and on the request arguments. Responses
+     * of such handlers get an ETag and are cached, conditional requests
+     * (If-None-Match) for an unchanged revision are answered with 304
+     * without calling process_request(). The revision is checked in the
+     * thread that runs process_request(), i.e. the UI thread unless
+     * needs_ui_thread() is false. With an additional "timeout"
+     * argument the conditional request waits up to that many milliseconds
+     * for a change (long polling).
+     */
+    virtual bool cacheable() const { return false; }
+
     virtual void process_request(struct MHD_Connection* connection,
         const char* url, const char* method, const char* upload_data,
         size_t* upload_data_size, std::ostream& body, int& error_code,
         std::string& content_type, bool *redraw) = 0;
 
     int handle_error(std::ostream& body, std::string error, int error_code);
+
+private:
+
+    MHD_RESULT queue_response(struct MHD_Connection* connection, int error_code,
+        struct MHD_Response* response, const std::string& content_type,
+        const std::string& etag, size_t body_size,
+        YHttpCompression::Encoding encoding = YHttpCompression::NONE);
+
+    YHttpResponseCache _cache;
 };
 
 #endif // YHttpHandler_h
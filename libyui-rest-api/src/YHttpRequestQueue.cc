@@ -0,0 +1,152 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define YUILogComponent "rest-api"
+#include <yui/YUILog.h>
+#include <yui/YUIException.h>
+
+#include "YHttpRequestQueue.h"
+
+YHttpRequestQueue::YHttpRequestQueue()
+    : _head(nullptr), _stopping(false)
+{
+    _fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (_fd < 0)
+        yuiError() << "Cannot create the wakeup FD: " << strerror(errno) << std::endl;
+}
+
+YHttpRequestQueue::~YHttpRequestQueue()
+{
+    shutdown();
+
+    if (_fd >= 0)
+        close(_fd);
+}
+
+bool YHttpRequestQueue::call(const std::function<void()> &fn)
+{
+    if (_stopping)
+        return false;
+
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->fn = fn;
+    std::future<void> done = job->done.get_future();
+
+    // the UI thread may take and delete the node as soon as it is pushed,
+    // so remember the previous head in a local variable
+    Node *prev = _head.load(std::memory_order_relaxed);
+    Node *node = new Node { job, prev };
+
+    while (!_head.compare_exchange_weak(prev, node,
+        std::memory_order_release, std::memory_order_relaxed))
+        node->next = prev;
+
+    // only the first job needs to wake up the UI, it takes all queued jobs
+    if (!prev)
+        wakeup();
+
+    // 'fn' refers to the caller's data, so wait for it even if it takes long;
+    // only give up when the UI will not run it anymore
+    while (done.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready)
+    {
+        if (_stopping)
+            return done.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    return true;
+}
+
+bool YHttpRequestQueue::process()
+{
+    clear_wakeup();
+
+    Node *list = _head.exchange(nullptr, std::memory_order_acquire);
+
+    if (!list)
+        return false;
+
+    // the list is LIFO, reverse it to run the jobs in the order they came
+    Node *fifo = nullptr;
+
+    while (list)
+    {
+        Node *next = list->next;
+        list->next = fifo;
+        fifo = list;
+        list = next;
+    }
+
+    while (fifo)
+    {
+        Node *next = fifo->next;
+
+        if (!_stopping)
+        {
+            try
+            {
+                fifo->job->fn();
+            }
+            catch (YUIException &ex)
+            {
+                YUI_CAUGHT(ex);
+            }
+            catch (std::exception &ex)
+            {
+                yuiError() << "Request failed: " << ex.what() << std::endl;
+            }
+
+            fifo->job->done.set_value();
+        }
+
+        delete fifo;
+        fifo = next;
+    }
+
+    return true;
+}
+
+void YHttpRequestQueue::shutdown()
+{
+    _stopping = true;
+
+    // drop the queued jobs, the waiting threads notice the stop flag
+    process();
+}
+
+void YHttpRequestQueue::wakeup()
+{
+    uint64_t one = 1;
+
+    if (_fd >= 0 && write(_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+        yuiError() << "Cannot write the wakeup FD: " << strerror(errno) << std::endl;
+}
+
+void YHttpRequestQueue::clear_wakeup()
+{
+    uint64_t value;
+
+    if (_fd >= 0 && read(_fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+        yuiError() << "Cannot read the wakeup FD: " << strerror(errno) << std::endl;
+}
@@ -0,0 +1,93 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YHttpRequestQueue_h
+#define YHttpRequestQueue_h
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+
+/**
+ * Queue for marshalling work from the HTTP server threads to the UI thread.
+ *
+ * The server threads (any number of them) add their work with call() and
+ * block until the UI thread has run it. Adding work is lock-free: The work
+ * is pushed onto an atomic singly linked list. When the list was empty
+ * before, the wakeup file descriptor fd() becomes readable; the UI watches
+ * it in its event loop and calls process() which runs all queued work in
+ * the order it was added.
+ **/
+class YHttpRequestQueue
+{
+
+public:
+
+    YHttpRequestQueue();
+    ~YHttpRequestQueue();
+
+    /**
+     * The wakeup file descriptor, readable when there is queued work.
+     **/
+    int fd() const { return _fd; }
+
+    /**
+     * Run 'fn' in the UI thread and wait until it has finished.
+     * Called from the server threads.
+     * @return false if the queue was shut down before 'fn' could run
+     **/
+    bool call(const std::function<void()> &fn);
+
+    /**
+     * Run all queued work. Called from the UI thread.
+     * @return true if any work was run
+     **/
+    bool process();
+
+    /**
+     * Stop running work and release all waiting server threads.
+     * Called from the UI thread before the server threads are stopped.
+     **/
+    void shutdown();
+
+private:
+
+    struct Job
+    {
+        std::function<void()> fn;
+        std::promise<void> done;
+    };
+
+    struct Node
+    {
+        std::shared_ptr<Job> job;
+        Node *next;
+    };
+
+    // disable copying
+    YHttpRequestQueue(const YHttpRequestQueue &);
+    YHttpRequestQueue & operator=(const YHttpRequestQueue &);
+
+    void wakeup();
+    void clear_wakeup();
+
+    std::atomic<Node *> _head;
+    std::atomic<bool> _stopping;
+    int _fd;
+};
+
+#endif // YHttpRequestQueue_h
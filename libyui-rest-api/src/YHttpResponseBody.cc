@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "YHttpHandler.h"
+#include "YHttpResponseBody.h"
+
+// The clients usually ask for the same data again and again,
+// start with the size of the last response to avoid reallocations
+static std::atomic<size_t> last_size(4096);
+
+// the pool of the released buffers, a few are enough as the responses
+// are usually sent one by one
+#define POOL_SIZE 4
+// do not keep the extremely large buffers
+#define MAX_POOLED_CAPACITY (8 * 1024 * 1024)
+
+static std::mutex pool_mutex;
+static std::vector<std::string> pool;
+
+YHttpResponseBody::YHttpResponseBody(bool compact)
+    : _data(take_buffer()), _compact(compact)
+{
+    if (_data.capacity() < last_size.load(std::memory_order_relaxed))
+        _data.reserve(last_size.load(std::memory_order_relaxed));
+}
+
+std::string YHttpResponseBody::take_buffer()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    if (pool.empty())
+        return std::string();
+
+    std::string ret(std::move(pool.back()));
+    pool.pop_back();
+    return ret;
+}
+
+void YHttpResponseBody::recycle(std::string &&buffer)
+{
+    if (buffer.capacity() < 4096 || buffer.capacity() > MAX_POOLED_CAPACITY)
+        return;
+
+    buffer.clear();
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    if (pool.size() < POOL_SIZE)
+        pool.push_back(std::move(buffer));
+}
+
+YHttpResponseBody::int_type YHttpResponseBody::overflow(int_type ch)
+{
+    if (ch != traits_type::eof())
+        _data += traits_type::to_char_type(ch);
+
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize YHttpResponseBody::xsputn(const char *str, std::streamsize count)
+{
+    _data.append(str, count);
+    return count;
+}
+
+static void free_body(void *data)
+{
+    YHttpResponseBody *body = static_cast<YHttpResponseBody *>(data);
+    YHttpResponseBody::recycle(std::move(body->data()));
+    delete body;
+}
+
+struct MHD_Response *YHttpResponseBody::create_response(YHttpResponseBody *body)
+{
+    const std::string &data = body->data();
+    last_size.store(data.size() + 1, std::memory_order_relaxed);
+
+#if MHD_VERSION >= 0x00097101
+    // pass the data directly, it is released together with the response
+    struct MHD_Response *response = MHD_create_response_from_buffer_with_free_callback_cls(
+        data.size(), data.data(), &free_body, body);
+
+    if (!response)
+        free_body(body);
+
+    return response;
+#else
+    // old libmicrohttpd, the data has to be copied
+    struct MHD_Response *response = MHD_create_response_from_buffer(data.size(),
+        (void *) data.data(), MHD_RESPMEM_MUST_COPY);
+    free_body(body);
+    return response;
+#endif
+}
+
+static void free_shared(void *data)
+{
+    delete static_cast<std::shared_ptr<const std::string> *>(data);
+}
+
+struct MHD_Response *YHttpResponseBody::create_response(const std::shared_ptr<const std::string> &data)
+{
+#if MHD_VERSION >= 0x00097101
+    // the response holds its own reference to the data
+    std::shared_ptr<const std::string> *ref = new std::shared_ptr<const std::string>(data);
+    struct MHD_Response *response = MHD_create_response_from_buffer_with_free_callback_cls(
+        data->size(), data->data(), &free_shared, ref);
+
+    if (!response)
+        free_shared(ref);
+
+    return response;
+#else
+    return MHD_create_response_from_buffer(data->size(), (void *) data->data(),
+        MHD_RESPMEM_MUST_COPY);
+#endif
+}
+
+std::shared_ptr<const std::string> YHttpResponseBody::release(YHttpResponseBody *body)
+{
+    last_size.store(body->data().size() + 1, std::memory_order_relaxed);
+
+    // the buffer returns to the pool when the last reference is released
+    std::shared_ptr<const std::string> ret(new std::string(std::move(body->data())),
+        [](const std::string *data) {
+            recycle(std::move(*const_cast<std::string *>(data)));
+            delete data;
+        });
+    delete body;
+    return ret;
+}
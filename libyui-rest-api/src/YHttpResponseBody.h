@@ -0,0 +1,93 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YHttpResponseBody_h
+#define YHttpResponseBody_h
+
+#include <memory>
+#include <streambuf>
+#include <string>
+
+struct MHD_Response;
+
+/**
+ * The body of an HTTP response.
+ *
+ * It is used as the stream buffer of the body stream passed to the request
+ * handlers, so the handlers can write to it as to any other stream. The
+ * JSON serializer detects it and appends its output directly to data().
+ * Finally the buffer is handed over to the HTTP server without copying.
+ **/
+class YHttpResponseBody : public std::streambuf
+{
+
+public:
+
+    YHttpResponseBody(bool compact = false);
+    virtual ~YHttpResponseBody() {}
+
+    /**
+     * The body data, can be appended to directly.
+     **/
+    std::string &data() { return _data; }
+
+    /**
+     * Whether the client asked for the compact JSON output
+     * (without indentation).
+     **/
+    bool compact() const { return _compact; }
+
+    /**
+     * Create an HTTP response with the body data, the response takes
+     * over the ownership of 'body'.
+     **/
+    static struct MHD_Response *create_response(YHttpResponseBody *body);
+
+    /**
+     * Create an HTTP response with shared data (e.g. from a cache),
+     * the response keeps a reference to the data.
+     **/
+    static struct MHD_Response *create_response(const std::shared_ptr<const std::string> &data);
+
+    /**
+     * Take the body data out of 'body' and delete it. Used when the data
+     * is shared with a cache.
+     **/
+    static std::shared_ptr<const std::string> release(YHttpResponseBody *body);
+
+    /**
+     * Get an empty buffer from the pool of the released buffers. The large
+     * buffers are reused to avoid reallocating them for each response.
+     **/
+    static std::string take_buffer();
+
+    /**
+     * Return a buffer which is not needed anymore to the pool.
+     **/
+    static void recycle(std::string &&buffer);
+
+protected:
+
+    virtual int_type overflow(int_type ch);
+    virtual std::streamsize xsputn(const char *str, std::streamsize count);
+
+private:
+
+    std::string _data;
+    bool _compact;
+};
+
+#endif // YHttpResponseBody_h
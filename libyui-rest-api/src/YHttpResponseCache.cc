@@ -0,0 +1,122 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include "YHttpHandler.h"
+#include "YHttpResponseCache.h"
+
+YHttpResponseCache::YHttpResponseCache()
+    : _revision(0), _encoding(YHttpCompression::NONE)
+{
+}
+
+bool YHttpResponseCache::lookup(const std::string &key, unsigned long long revision,
+    std::shared_ptr<const std::string> &data, std::string &content_type,
+    YHttpCompression::Encoding &encoding)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_data || _revision != revision || _key != key)
+        return false;
+
+    data = _data;
+    content_type = _content_type;
+    encoding = _encoding;
+    return true;
+}
+
+void YHttpResponseCache::store(const std::string &key, unsigned long long revision,
+    const std::shared_ptr<const std::string> &data, const std::string &content_type,
+    YHttpCompression::Encoding encoding)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _key = key;
+    _revision = revision;
+    _data = data;
+    _content_type = content_type;
+    _encoding = encoding;
+}
+
+static MHD_RESULT add_argument(void *cls, enum MHD_ValueKind kind, const char *key, const char *value)
+{
+    // the long polling timeout does not change the content
+    if (strcmp(key, "timeout") != 0)
+    {
+        std::string *ret = static_cast<std::string *>(cls);
+        *ret += key;
+        *ret += '=';
+        if (value) *ret += value;
+        *ret += '&';
+    }
+
+    return MHD_YES;
+}
+
+std::string YHttpResponseCache::key(struct MHD_Connection *connection)
+{
+    std::string ret;
+    MHD_get_connection_values(connection, MHD_GET_ARGUMENT_KIND, &add_argument, &ret);
+    return ret;
+}
+
+std::string YHttpResponseCache::etag(unsigned long long revision, YHttpCompression::Encoding encoding)
+{
+    static const unsigned int instance = std::random_device()();
+
+    const char *name = YHttpCompression::name(encoding);
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "\"%08x-%llu%s%s\"", instance, revision,
+        name ? "-" : "", name ? name : "");
+    return buffer;
+}
+
+bool YHttpResponseCache::etag_matches(const char *if_none_match, const std::string &etag)
+{
+    // the header contains a comma separated list of the (possibly weak) tags
+    // or "*" which matches any tag
+    const char *pos = if_none_match;
+
+    while (*pos)
+    {
+        while (*pos == ' ' || *pos == '\t' || *pos == ',')
+            ++pos;
+
+        const char *end = pos;
+        while (*end && *end != ',')
+            ++end;
+
+        size_t len = end - pos;
+        while (len > 0 && (pos[len - 1] == ' ' || pos[len - 1] == '\t'))
+            --len;
+
+        if (len >= 2 && strncmp(pos, "W/", 2) == 0)
+        {
+            pos += 2;
+            len -= 2;
+        }
+
+        if ((len == 1 && *pos == '*') || etag.compare(0, std::string::npos, pos, len) == 0)
+            return true;
+
+        pos = end;
+    }
+
+    return false;
+}
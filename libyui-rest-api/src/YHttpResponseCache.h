@@ -0,0 +1,89 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YHttpResponseCache_h
+#define YHttpResponseCache_h
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "YHttpCompression.h"
+
+struct MHD_Connection;
+
+/**
+ * Cache for the last response of a handler which only depends on the
+ * widget change revision (see YWidget::changeRevision()) and on the request
+ * arguments.
+ *
+ * The clients usually poll the same URL again and again, so remembering
+ * only the last response is enough. The cache can be used from any thread.
+ **/
+class YHttpResponseCache
+{
+
+public:
+
+    YHttpResponseCache();
+
+    /**
+     * Find the cached response for the request arguments 'key' at the
+     * change revision 'revision'.
+     * @return true if found, 'data', 'content_type' and 'encoding' are set then
+     **/
+    bool lookup(const std::string &key, unsigned long long revision,
+        std::shared_ptr<const std::string> &data, std::string &content_type,
+        YHttpCompression::Encoding &encoding);
+
+    /**
+     * Remember the response data, 'encoding' is the compression of 'data'.
+     **/
+    void store(const std::string &key, unsigned long long revision,
+        const std::shared_ptr<const std::string> &data, const std::string &content_type,
+        YHttpCompression::Encoding encoding);
+
+    /**
+     * The cache key for the request, built from the GET arguments
+     * (except the "timeout" argument used for long polling).
+     **/
+    static std::string key(struct MHD_Connection *connection);
+
+    /**
+     * The ETag for the change revision. It contains a random prefix
+     * unique for the process so the tags from a previous run of the
+     * application do not match. The compressed responses get a different
+     * tag than the uncompressed ones.
+     **/
+    static std::string etag(unsigned long long revision,
+        YHttpCompression::Encoding encoding = YHttpCompression::NONE);
+
+    /**
+     * Whether the value of an If-None-Match header matches the ETag.
+     **/
+    static bool etag_matches(const char *if_none_match, const std::string &etag);
+
+private:
+
+    std::mutex _mutex;
+    std::string _key;
+    unsigned long long _revision;
+    std::shared_ptr<const std::string> _data;
+    std::string _content_type;
+    YHttpCompression::Encoding _encoding;
+};
+
+#endif // YHttpResponseCache_h
@@ -14,6 +14,7 @@
   Floor, Boston, MA 02110-1301 USA
 */
 
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -22,7 +23,11 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
 #include <arpa/inet.h>
+#include <unistd.h>
 
 #include <microhttpd.h>
 
@@ -30,18 +35,38 @@
 #include <yui/YUILog.h>
 
 #include <yui/YDialog.h>
+#include <yui/YWidget.h>
 
 #include "YHttpAppHandler.h"
 #include "YHttpDialogHandler.h"
+#include "YHttpEventsHandler.h"
 #include "YHttpRootHandler.h"
 #include "YHttpVersionHandler.h"
 #include "YHttpWidgetsActionHandler.h"
+#include "YHttpWidgetsBatchHandler.h"
 #include "YHttpWidgetsHandler.h"
+#include "YHttpWidgetsItemsHandler.h"
 #include "YJsonSerializer.h"
 
 #include "YHttpServer.h"
 
 
+#if MHD_VERSION < 0x00095900
+// renamed in libmicrohttpd 0.9.59
+#define MHD_ALLOW_SUSPEND_RESUME MHD_USE_SUSPEND_RESUME
+#endif
+
+#ifndef MHD_HTTP_PAYLOAD_TOO_LARGE
+// renamed in libmicrohttpd 0.9.64
+#define MHD_HTTP_PAYLOAD_TOO_LARGE MHD_HTTP_REQUEST_ENTITY_TOO_LARGE
+#endif
+
+// how often the long polling requests are checked (in ms)
+#define WAIT_CHECK_INTERVAL 50
+
+// the memory per connection (the default is 32KiB)
+#define CONNECTION_MEMORY_LIMIT (128 * 1024)
+
 YHttpServer * YHttpServer::_yserver = 0;
 YHttpWidgetsActionHandler * YHttpServer::_widget_action_handler = 0;
 
@@ -53,6 +78,26 @@ int YHttpServer::port_num()
     return env_port ? atoi(env_port) : 0;
 }
 
+int YHttpServer::thread_num()
+{
+    const char* env_threads = getenv( YUI_HTTP_THREADS );
+    int threads = env_threads ? atoi(env_threads) : 0;
+    return threads > 0 ? threads : 0;
+}
+
+std::string YHttpServer::socket_path()
+{
+    const char* env_socket = getenv( YUI_HTTP_SOCKET );
+    return env_socket ? env_socket : "";
+}
+
+unsigned int YHttpServer::keep_alive_timeout()
+{
+    const char* env_timeout = getenv( YUI_HTTP_KEEP_ALIVE );
+    int timeout = env_timeout ? atoi(env_timeout) : 60;
+    return timeout > 0 ? timeout : 0;
+}
+
 // For security reasons accept the connections only from the localhost
 // by default, allow listening on all interfaces only when explicitly allowed.
 bool remote_access()
@@ -94,8 +139,13 @@ struct in6_addr listen_address_v6(bool remote)
 }
 
 YHttpServer::YHttpServer(YHttpWidgetsActionHandler * widgets_action_handler)
-    : server_v4(nullptr), server_v6(nullptr), redraw(false)
+    : server_v4(nullptr), server_v6(nullptr), server_unix(nullptr), redraw(false), _queue(nullptr), _events(nullptr), _not_found(nullptr)
 {
+    _timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (_timer_fd < 0)
+        yuiError() << "Cannot create the timer FD, long polling disabled: " << strerror(errno) << std::endl;
+
     _yserver = this;
     _widget_action_handler = widgets_action_handler;
     // authorization user set?
@@ -124,6 +174,17 @@ YHttpServer::~YHttpServer()
 {
     yuiMilestone() << "Finishing the REST API HTTP server..." << std::endl;
 
+    // release the server threads waiting for the UI, otherwise
+    // stopping the daemons would wait for them forever
+    if (_queue)
+        _queue->shutdown();
+
+    // the suspended connections must be resumed before stopping
+    check_waiters(true);
+
+    if (_events)
+        _events->close_all();
+
     if (server_v4) {
         yuiMilestone() << "Stopping IPv4 HTTP server" << std::endl;
         MHD_stop_daemon(server_v4);
@@ -133,6 +194,22 @@ YHttpServer::~YHttpServer()
         yuiMilestone() << "Stopping IPv6 HTTP server" << std::endl;
         MHD_stop_daemon(server_v6);
     }
+
+    if (server_unix) {
+        yuiMilestone() << "Stopping Unix socket HTTP server" << std::endl;
+        MHD_stop_daemon(server_unix);
+    }
+
+    if (!_socket_file.empty())
+        unlink(_socket_file.c_str());
+
+    delete _queue;
+
+    if (_not_found)
+        MHD_destroy_response(_not_found);
+
+    if (_timer_fd >= 0)
+        close(_timer_fd);
 }
 
 // add the server file descriptors to the socket lists
@@ -162,8 +239,20 @@ YHttpServerSockets YHttpServer::sockets()
 {
     YHttpServerSockets ret;
 
+    // the server threads watch the HTTP sockets themselves,
+    // the UI only needs to watch for the queued requests
+    if (_timer_fd >= 0)
+        ret.add_read(_timer_fd);
+
+    if (_queue)
+    {
+        ret.add_read(_queue->fd());
+        return ret;
+    }
+
     if (server_v4) add_fds(server_v4, ret);
     if (server_v6) add_fds(server_v6, ret);
+    if (server_unix) add_fds(server_unix, ret);
 
     if (ret.empty())
         yuiWarning() << "Not watching any FD!" << std::endl;
@@ -175,7 +264,7 @@ MHD_RESULT YHttpServer::handle(struct MHD_Connection* connection,
     const char* url, const char* method, const char* upload_data,
     size_t* upload_data_size)
 {
-    yuiMilestone() << "Processing " << method << " request: "<< url << ", input data size: " << *upload_data_size << std::endl;
+    yuiHttpLog() << "Processing " << method << " request: "<< url << ", input data size: " << *upload_data_size << std::endl;
 
     // find the handler
     for(YHttpMount m: _mounts)
@@ -185,9 +274,8 @@ MHD_RESULT YHttpServer::handle(struct MHD_Connection* connection,
     }
 
     // if not found create an empty 404 error response
-    yuiMilestone() << "URL path/method not found, returning error code 404" << std::endl;
-    struct MHD_Response* response = MHD_create_response_from_buffer(0, 0, MHD_RESPMEM_PERSISTENT);
-    return MHD_queue_response(connection, MHD_HTTP_NOT_FOUND, response);
+    yuiHttpLog() << "URL path/method not found, returning error code 404" << std::endl;
+    return MHD_queue_response(connection, MHD_HTTP_NOT_FOUND, _not_found);
 }
 
 // handle the HTTP Basic Authentication
@@ -205,6 +293,19 @@ bool authenticated(struct MHD_Connection *connection, const YHttpServer *server)
     return success;
 }
 
+// the uploaded request body is collected before calling the handler,
+// limit the size so a client cannot exhaust the memory
+#define MAX_UPLOAD_SIZE (1024 * 1024)
+
+const char *upload_error_body = "{ \"error\" : \"The request body is too large\" }\n";
+
+// the state of a request which is being received
+struct YHttpRequestState
+{
+    std::string upload;
+    bool too_large = false;
+};
+
 // callback for handling the HTTP request
 static MHD_RESULT
 requestHandler(void *srv,
@@ -214,20 +315,29 @@ requestHandler(void *srv,
           const char *version,
           const char *upload_data, size_t *upload_data_size, void **ptr)
 {
-    // remember the callback status
-    static int aptr;
+    YHttpServer *server = (YHttpServer *)srv;
+    YHttpRequestState *state = static_cast<YHttpRequestState *>(*ptr);
 
-    if (&aptr != *ptr)
+    if (!state)
     {
-        // do not respond on first call, it's used for the initial check to close invalid requests early
-        *ptr = &aptr;
+        // do not respond on first call, it's used for the initial check to close invalid requests early,
+        // the state is released in requestCompleted()
+        *ptr = new YHttpRequestState();
         // continue processing the request
         return MHD_YES;
     }
-    // reset
-    *ptr = NULL;
 
-    YHttpServer *server = (YHttpServer *)srv;
+    // collect the uploaded data, they might be received in several parts
+    if (*upload_data_size > 0)
+    {
+        if (state->upload.size() + *upload_data_size > MAX_UPLOAD_SIZE)
+            state->too_large = true;
+        else if (!state->too_large)
+            state->upload.append(upload_data, *upload_data_size);
+
+        *upload_data_size = 0;
+        return MHD_YES;
+    }
 
     // the basic auth is configured and failed
     if ((!server->user().empty() || !server->passwd().empty()) && !authenticated(connection, server))
@@ -238,7 +348,27 @@ requestHandler(void *srv,
         return MHD_queue_basic_auth_fail_response(connection, "libyui realm", response);
     }
 
-    return server->handle(connection, url, method, upload_data, upload_data_size);
+    if (state->too_large)
+    {
+        struct MHD_Response *response = MHD_create_response_from_buffer(strlen(upload_error_body),
+            (void *) upload_error_body, MHD_RESPMEM_PERSISTENT);
+        MHD_add_response_header(response, MHD_HTTP_HEADER_CONTENT_TYPE, "application/json");
+        MHD_RESULT ret = MHD_queue_response(connection, MHD_HTTP_PAYLOAD_TOO_LARGE, response);
+        MHD_destroy_response(response);
+        return ret;
+    }
+
+    // a resumed long polling request gets here again, with the same state
+    size_t upload_size = state->upload.size();
+    return server->handle(connection, url, method, state->upload.c_str(), &upload_size);
+}
+
+// callback called when a request is finished (or aborted)
+static void requestCompleted(void *srv, struct MHD_Connection *connection,
+    void **ptr, enum MHD_RequestTerminationCode toe)
+{
+    delete static_cast<YHttpRequestState *>(*ptr);
+    *ptr = NULL;
 }
 
 // callback called when a new client connects to the HTTP server,
@@ -249,7 +379,7 @@ static MHD_RESULT onConnect(void *srv, const struct sockaddr *addr, socklen_t ad
         // macro INET_ADDRSTRLEN contains the maximum length of an IPv4 address
         char buffer[INET_ADDRSTRLEN];
         inet_ntop(AF_INET, &(addr_in->sin_addr), buffer, INET_ADDRSTRLEN);
-        yuiMilestone() << "Received an IPv4 connection from " << buffer << std::endl;
+        yuiHttpLog() << "Received an IPv4 connection from " << buffer << std::endl;
     }
 
     if (addr->sa_family == AF_INET6) {
@@ -257,7 +387,7 @@ static MHD_RESULT onConnect(void *srv, const struct sockaddr *addr, socklen_t ad
         // macro INET6_ADDRSTRLEN contains the maximum length of an IPv6 address
         char buffer[INET6_ADDRSTRLEN];
         inet_ntop(AF_INET6, &(addr6_in->sin6_addr), buffer, INET6_ADDRSTRLEN);
-        yuiMilestone() << "Received an IPv6 connection from " << buffer << std::endl;
+        yuiHttpLog() << "Received an IPv6 connection from " << buffer << std::endl;
     }
 
     // always continue processing the request
@@ -269,20 +399,64 @@ void YHttpServer::start()
     mount("/", "GET", new YHttpRootHandler(), false);
     mount("/dialog", "GET", new YHttpDialogHandler());
     mount("/widgets", "GET", new YHttpWidgetsHandler());
+    mount("/widgets/items", "GET", new YHttpWidgetsItemsHandler());
     mount("/widgets", "POST", get_widget_action_handler());
+    mount("/widgets/batch", "POST", new YHttpWidgetsBatchHandler(get_widget_action_handler()));
     mount("/application", "GET", new YHttpAppHandler());
+    _events = new YHttpEventsHandler();
+    mount("/events", "GET", _events);
     mount("/version", "GET", new YHttpVersionHandler(), false);
 
     bool remote = remote_access();
 
+    // By default the server runs in the UI thread, the UI calls process_data()
+    // when a socket is ready. With server threads the HTTP requests are parsed
+    // in an epoll thread pool and only the widget access is passed to the UI
+    // thread through the request queue.
+    int threads = thread_num();
+    unsigned int flags = MHD_USE_DEBUG;
+
+    if (threads > 0)
+    {
+        yuiMilestone() << "Using " << threads << " HTTP server thread(s)" << std::endl;
+        _queue = new YHttpRequestQueue();
+        flags |= MHD_USE_EPOLL_INTERNAL_THREAD;
+    }
+
+    // the long polling requests are suspended while waiting
+    if (_timer_fd >= 0)
+        flags |= MHD_ALLOW_SUSPEND_RESUME;
+
+    // a pool of one thread is just the internal polling thread
+    unsigned int pool_size = threads > 1 ? threads : 0;
+
+    // the clients usually send many requests over a keep-alive connection,
+    // close it only when idle for too long to not run out of the connections
+    unsigned int keep_alive = keep_alive_timeout();
+
+    // the unknown URLs share the same response
+    if (!_not_found)
+        _not_found = MHD_create_response_from_buffer(0, nullptr, MHD_RESPMEM_PERSISTENT);
+
+    // the Unix domain socket, avoids the TCP overhead and allocating
+    // the ports for the local clients (e.g. the parallel tests)
+    std::string socket = socket_path();
+
+    if (!socket.empty())
+        start_unix(socket, flags, pool_size, keep_alive);
+
+    // only the Unix domain socket requested
+    if (port_num() == 0)
+        return;
+
     // setup the IPv4 server
     sockaddr_in server_socket;
     server_socket.sin_family = AF_INET;
     server_socket.sin_port = htons(port_num());
     server_socket.sin_addr.s_addr = listen_address_v4(remote);
     server_v4 = MHD_start_daemon (
-                        // enable debugging output (on STDERR)
-                        MHD_USE_DEBUG,
+                        // enable debugging output (on STDERR), optional server threads
+                        flags,
                         // the port number to use
                         port_num(),
                         // handler for new connections
@@ -291,8 +465,16 @@ void YHttpServer::start()
                         &requestHandler, this,
                         // allow or forbid reusing the socket for multiple processes
                         MHD_OPTION_LISTENING_ADDRESS_REUSE, port_reuse(),
+                        // number of the server threads
+                        MHD_OPTION_THREAD_POOL_SIZE, pool_size,
                         // set the port and interface to listen to
                         MHD_OPTION_SOCK_ADDR, &server_socket,
+                        // the idle keep-alive connection timeout
+                        MHD_OPTION_CONNECTION_TIMEOUT, keep_alive,
+                        // larger buffers for the request uploads and the event streams
+                        MHD_OPTION_CONNECTION_MEMORY_LIMIT, (size_t) CONNECTION_MEMORY_LIMIT,
+                        // release the request state
+                        MHD_OPTION_NOTIFY_COMPLETED, &requestCompleted, this,
                         // finish the argument list
                         MHD_OPTION_END);
 
@@ -302,8 +484,8 @@ void YHttpServer::start()
     server_socket_v6.sin6_port = htons(port_num());
     server_socket_v6.sin6_addr = listen_address_v6(remote);
     server_v6 = MHD_start_daemon (
-                        // enable debugging output (on STDERR)
-                        MHD_USE_DEBUG |
+                        // enable debugging output (on STDERR), optional server threads
+                        flags |
                         // use IPv6
                         MHD_USE_IPv6,
                         // the port number to use
@@ -315,8 +497,16 @@ void YHttpServer::start()
                         // disable reusing the socket for multiple processes,
                         // for security reasons allow only one process to use this port
                         MHD_OPTION_LISTENING_ADDRESS_REUSE, port_reuse(),
+                        // number of the server threads
+                        MHD_OPTION_THREAD_POOL_SIZE, pool_size,
                         // set the port and interface to listen to
                         MHD_OPTION_SOCK_ADDR, &server_socket_v6,
+                        // the idle keep-alive connection timeout
+                        MHD_OPTION_CONNECTION_TIMEOUT, keep_alive,
+                        // larger buffers for the request uploads and the event streams
+                        MHD_OPTION_CONNECTION_MEMORY_LIMIT, (size_t) CONNECTION_MEMORY_LIMIT,
+                        // release the request state
+                        MHD_OPTION_NOTIFY_COMPLETED, &requestCompleted, this,
                         // finish the argument list
                         MHD_OPTION_END);
 
@@ -338,15 +528,145 @@ void YHttpServer::start()
     // FIXME: exit when no server available?
 }
 
+// create a listening Unix domain socket, returns -1 on error
+static int unix_listen_socket(const std::string &path)
+{
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        yuiError() << "The socket path is too long: " << path << std::endl;
+        return -1;
+    }
+
+    strcpy(addr.sun_path, path.c_str());
+
+    // remove a stale socket left by a crashed process, but do not touch
+    // other files or a socket which is still in use
+    struct stat st;
+
+    if (lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+    {
+        int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        if (probe >= 0 && connect(probe, (sockaddr *) &addr, sizeof(addr)) < 0 && errno == ECONNREFUSED)
+        {
+            yuiMilestone() << "Removing stale socket " << path << std::endl;
+            unlink(path.c_str());
+        }
+
+        if (probe >= 0)
+            close(probe);
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (fd < 0)
+    {
+        yuiError() << "Cannot create a Unix socket: " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    // there is no access control for the local connections except the
+    // basic auth, allow connecting only to the owner (the socket is not
+    // accessible before listen())
+    if (bind(fd, (sockaddr *) &addr, sizeof(addr)) < 0
+        || chmod(path.c_str(), S_IRUSR | S_IWUSR) < 0
+        || listen(fd, SOMAXCONN) < 0)
+    {
+        yuiError() << "Cannot listen on socket " << path << ": " << strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+void YHttpServer::start_unix(const std::string &path, unsigned int flags,
+    unsigned int pool_size, unsigned int keep_alive)
+{
+    int fd = unix_listen_socket(path);
+
+    if (fd >= 0)
+    {
+        server_unix = MHD_start_daemon (
+                            // the same flags as the TCP servers
+                            flags,
+                            // no port, the socket is passed below
+                            0,
+                            // handler for new connections
+                            &onConnect, this,
+                            // handler for processing requests
+                            &requestHandler, this,
+                            // the listening socket, closed by the server
+                            MHD_OPTION_LISTEN_SOCKET, fd,
+                            // number of the server threads
+                            MHD_OPTION_THREAD_POOL_SIZE, pool_size,
+                            // the idle keep-alive connection timeout
+                            MHD_OPTION_CONNECTION_TIMEOUT, keep_alive,
+                            // larger buffers for the request uploads and the event streams
+                            MHD_OPTION_CONNECTION_MEMORY_LIMIT, (size_t) CONNECTION_MEMORY_LIMIT,
+                            // release the request state
+                            MHD_OPTION_NOTIFY_COMPLETED, &requestCompleted, this,
+                            // finish the argument list
+                            MHD_OPTION_END);
+    }
+
+    if (server_unix == nullptr) {
+        std::cerr << "Cannot start the HTTP server at socket " << path << std::endl;
+        yuiError() << "Cannot start the HTTP server at socket " << path << std::endl;
+
+        if (fd >= 0)
+        {
+            close(fd);
+            unlink(path.c_str());
+        }
+    }
+    else {
+        _socket_file = path;
+        yuiWarning() << "Started REST API HTTP server at socket " << path << std::endl;
+    }
+}
+
 bool YHttpServer::process_data()
 {
     redraw = false;
-    yuiMilestone() << "Processing HTTP server data..." << std::endl;
+    yuiHttpLog() << "Processing HTTP server data..." << std::endl;
+
+    // resume the long polling requests first, the server
+    // processes them in the same run then
+    check_waiters();
+
+    // send the UI changes to the event streams
+    if (_events)
+        _events->update();
+
+    if (_queue)
+    {
+        // run the requests queued by the server threads
+        _queue->process();
+        return redraw;
+    }
+
     if (server_v4) MHD_run(server_v4);
     if (server_v6) MHD_run(server_v6);
+    if (server_unix) MHD_run(server_unix);
     return redraw;
 }
 
+bool YHttpServer::run_in_ui_thread(const std::function<void()> &fn)
+{
+    if (!_queue)
+    {
+        fn();
+        return true;
+    }
+
+    return _queue->call(fn);
+}
+
 void YHttpServer::mount(std::string path, const std::string &method, YHttpHandler *handler, bool has_api_version)
 {
     if (has_api_version)
@@ -355,3 +675,113 @@ void YHttpServer::mount(std::string path, const std::string &method, YHttpHandle
     }
     _mounts.push_back(YHttpMount(path, method, handler));
 }
+
+bool YHttpServer::wait_for_change(struct MHD_Connection *connection,
+    unsigned long long revision, int timeout_ms)
+{
+    if (!can_suspend())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(_waiters_mutex);
+
+        // suspend while locked, the UI thread must not resume the connection
+        // before it has been suspended
+        MHD_suspend_connection(connection);
+
+        _waiters.push_back({ connection, revision,
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms) });
+    }
+
+    update_timer();
+
+    yuiHttpLog() << "Waiting for a change of revision " << revision << ", timeout: " << timeout_ms << "ms" << std::endl;
+    return true;
+}
+
+bool YHttpServer::resumed(struct MHD_Connection *connection, bool clear)
+{
+    std::lock_guard<std::mutex> lock(_waiters_mutex);
+
+    auto it = _resumed.find(connection);
+    if (it == _resumed.end())
+        return false;
+
+    if (clear)
+        _resumed.erase(it);
+
+    return true;
+}
+
+void YHttpServer::update_timer()
+{
+    if (_timer_fd < 0)
+        return;
+
+    // serialize the updates, the last one must win
+    std::lock_guard<std::mutex> timer_lock(_timer_mutex);
+    bool enabled = _events && _events->has_clients();
+
+    if (!enabled)
+    {
+        std::lock_guard<std::mutex> lock(_waiters_mutex);
+        enabled = !_waiters.empty();
+    }
+
+    struct itimerspec spec = {};
+
+    if (enabled)
+    {
+        spec.it_interval.tv_nsec = WAIT_CHECK_INTERVAL * 1000000L;
+        spec.it_value = spec.it_interval;
+    }
+
+    if (timerfd_settime(_timer_fd, 0, &spec, nullptr) < 0)
+        yuiError() << "Cannot set the timer: " << strerror(errno) << std::endl;
+}
+
+void YHttpServer::check_waiters(bool resume_all)
+{
+    if (_timer_fd < 0)
+        return;
+
+    uint64_t expirations;
+    if (read(_timer_fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+        yuiError() << "Cannot read the timer FD: " << strerror(errno) << std::endl;
+
+    std::vector<struct MHD_Connection *> resume;
+    unsigned long long revision = YWidget::changeRevision();
+    auto now = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(_waiters_mutex);
+
+        if (_waiters.empty())
+            return;
+
+        auto it = _waiters.begin();
+        while (it != _waiters.end())
+        {
+            if (resume_all || it->revision != revision || it->deadline <= now)
+            {
+                resume.push_back(it->connection);
+                _resumed.insert(it->connection);
+                it = _waiters.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    if (resume.empty())
+        return;
+
+    update_timer();
+
+    // resume outside the lock, in the threaded mode the server threads
+    // might be calling wait_for_change() meanwhile
+    for (struct MHD_Connection *connection: resume)
+        MHD_resume_connection(connection);
+
+    yuiHttpLog() << "Resumed " << resume.size() << " waiting connection(s)" << std::endl;
+}
@@ -17,11 +17,18 @@
 #ifndef YHttpServer_h
 #define YHttpServer_h
 
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <string>
 
 #include "YHttpMount.h"
 #include "YHttpHandler.h"
+#include "YHttpRequestQueue.h"
 #include "YHttpServerSockets.h"
 #include "YHttpWidgetsActionHandler.h"
 
@@ -31,10 +38,21 @@
 #define YUI_AUTH_USER       "YUI_AUTH_USER"
 #define YUI_AUTH_PASSWD     "YUI_AUTH_PASSWD"
 #define YUI_REUSE_PORT      "YUI_REUSE_PORT"
+#define YUI_HTTP_THREADS    "YUI_HTTP_THREADS"
+#define YUI_HTTP_VERBOSE    "YUI_HTTP_VERBOSE"
+#define YUI_HTTP_COMPRESS   "YUI_HTTP_COMPRESS"
+#define YUI_HTTP_KEEP_ALIVE "YUI_HTTP_KEEP_ALIVE"
+#define YUI_HTTP_SOCKET     "YUI_HTTP_SOCKET"
 
 #define YUI_API_VERSION     "v1"
 
+// log a milestone for each request only in the verbose mode,
+// the message is not even formatted otherwise
+#define yuiHttpLog()	if ( !YHttpServer::verbose() ) ; else yuiMilestone()
+
 struct MHD_Daemon;
+struct MHD_Response;
+class YHttpEventsHandler;
 
 class YHttpServer
 {
@@ -43,10 +61,20 @@ public:
 
     static bool enabled()
     {
-        static bool enabled = port_num() != 0;
+        static bool enabled = port_num() != 0 || !socket_path().empty();
         return enabled;
     }
 
+    /**
+     * Whether each request and response should be logged (YUI_HTTP_VERBOSE=1),
+     * the logging noticeably slows down the processing of many small requests.
+     **/
+    static bool verbose()
+    {
+        static bool verbose = getenv(YUI_HTTP_VERBOSE) && strcmp(getenv(YUI_HTTP_VERBOSE), "1") == 0;
+        return verbose;
+    }
+
     /**
     * Access the global YHttpServer.
     **/
@@ -54,6 +82,24 @@ public:
 
     static int port_num();
 
+    /**
+     * Path of the Unix domain socket to listen on (YUI_HTTP_SOCKET),
+     * empty if not set.
+     **/
+    static std::string socket_path();
+
+    /**
+     * Number of the HTTP server threads, 0 if the server runs in the UI
+     * thread (the default).
+     **/
+    static int thread_num();
+
+    /**
+     * How long (in seconds) an idle keep-alive connection is kept open
+     * (YUI_HTTP_KEEP_ALIVE, default 60), 0 means no limit.
+     **/
+    static unsigned int keep_alive_timeout();
+
     /**
      * Constructor to override widgets action handler. Is used in case there
      * are UI specific actions for the widget.
@@ -82,6 +128,43 @@ public:
      */
     YHttpServerSockets sockets();
 
+    /**
+     * Run the function in the UI thread. When the server uses its own
+     * threads this queues the function and waits until process_data()
+     * has run it, otherwise it is called directly.
+     * @return false if the server is shutting down and the function was not run
+     */
+    bool run_in_ui_thread(const std::function<void()> &fn);
+
+    /**
+     * Suspend the connection until the widget change revision differs from
+     * 'revision' or until 'timeout_ms' milliseconds pass, used for long
+     * polling. The request is then passed to its handler again and
+     * resumed() returns true for the connection.
+     * The condition is checked while the UI waits for input.
+     * @return false if the connection could not be suspended
+     */
+    bool wait_for_change(struct MHD_Connection *connection, unsigned long long revision, int timeout_ms);
+
+    /**
+     * Whether the connections can be suspended, needed for the long
+     * polling and for the event streams.
+     */
+    bool can_suspend() const { return _timer_fd >= 0; }
+
+    /**
+     * Arm or disarm the timer for checking the long polling requests and
+     * updating the event streams, depending on whether there are any.
+     * Must not be called with any server lock held.
+     */
+    void update_timer();
+
+    /**
+     * Whether the connection has been resumed after wait_for_change(),
+     * 'clear' resets the flag.
+     */
+    bool resumed(struct MHD_Connection *connection, bool clear = false);
+
     void mount(std::string path, const std::string &method, YHttpHandler *handler, bool has_api_version = true);
 
     MHD_RESULT handle(struct MHD_Connection* connection,
@@ -96,8 +179,40 @@ private:
 
     // dual stack support (for both IPv4 and IPv6)
     struct MHD_Daemon *server_v4, *server_v6;
+    // the optional Unix domain socket server
+    struct MHD_Daemon *server_unix;
+    // the created socket file, removed at exit
+    std::string _socket_file;
+
+    void start_unix(const std::string &path, unsigned int flags,
+        unsigned int pool_size, unsigned int keep_alive);
     std::vector<YHttpMount> _mounts;
     bool redraw;
+    // requests for the UI thread, only used with the server threads
+    YHttpRequestQueue *_queue;
+
+    // connections suspended by wait_for_change()
+    struct Waiter
+    {
+        struct MHD_Connection *connection;
+        unsigned long long revision;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    std::mutex _waiters_mutex;
+    std::vector<Waiter> _waiters;
+    std::set<struct MHD_Connection *> _resumed;
+    // timer for checking the waiting connections, armed only when there are some
+    int _timer_fd;
+
+    std::mutex _timer_mutex;
+
+    // the event stream handler, it needs the periodic updates
+    YHttpEventsHandler *_events;
+    // the shared empty "404 Not Found" response
+    struct MHD_Response *_not_found;
+
+    void check_waiters(bool resume_all = false);
     static YHttpServer * _yserver;
     static YHttpWidgetsActionHandler * _widget_action_handler;
     // HTTP Basic Auth credentials
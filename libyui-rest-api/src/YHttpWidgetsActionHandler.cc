@@ -46,62 +46,68 @@ void YHttpWidgetsActionHandler::process_request(struct MHD_Connection* connectio
     size_t* upload_data_size, std::ostream& body, int& error_code,
     std::string& content_type, bool *redraw)
 {
-    if ( YDialog::topmostDialog(false) )
-    {
-        WidgetArray widgets;
+    content_type = "application/json";
 
-        content_type = "application/json";
+    auto arg = [connection] (const char *name) {
+        return MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, name);
+    };
 
-        const char* label = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "label");
-        const char* id = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "id");
-        const char* type = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "type");
+    error_code = perform( arg("label"), arg("id"), arg("type"), arg("action"), arg, body );
 
-        if ( label || id || type )
-        {
-            widgets = YWidgetFinder::find(label, id, type);
-        }
-        else
-        {
-            body << "{ \"error\" : \"No search criteria provided\" }" << std::endl;
-            error_code = MHD_HTTP_NOT_FOUND;
-            return;
-        }
+    // the action possibly changed something in the UI, signalize redraw needed
+    if ( redraw && error_code == MHD_HTTP_OK )
+        *redraw = true;
+}
 
-        if ( widgets.empty() )
-        {
-            body << "{ \"error\" : \"Widget not found\" }" << std::endl;
-            error_code = MHD_HTTP_NOT_FOUND;
-            return;
-        }
+int YHttpWidgetsActionHandler::perform(const char *label, const char *id, const char *type,
+    const char *action, const ParamLookup &param, std::ostream& body)
+{
+    if ( !YDialog::topmostDialog(false) )
+    {
+        body << "{ \"error\" : \"No dialog is open\" }" << std::endl;
+        return MHD_HTTP_NOT_FOUND;
+    }
 
-        if ( const char* action = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "action") )
-        {
-            if( widgets.size() != 1 )
-            {
-                body << "{ \"error\" : \"Multiple widgets found to act on, try using multicriteria search (label+id+type)\" }" << std::endl;
-                error_code = MHD_HTTP_NOT_FOUND;
-                return;
-            }
+    WidgetArray widgets;
+
+    if ( label || id || type )
+    {
+        widgets = YWidgetFinder::find(label, id, type);
+    }
+    else
+    {
+        body << "{ \"error\" : \"No search criteria provided\" }" << std::endl;
+        return MHD_HTTP_NOT_FOUND;
+    }
 
-            error_code = do_action(widgets[0], action, connection, body);
+    if ( widgets.empty() )
+    {
+        body << "{ \"error\" : \"Widget not found\" }" << std::endl;
+        return MHD_HTTP_NOT_FOUND;
+    }
 
-            // the action possibly changed something in the UI, signalize redraw needed
-            if ( redraw && error_code == MHD_HTTP_OK )
-                *redraw = true;
-        }
-        else
-        {
-            body << "{ \"error\" : \"Missing action parameter\" }" << std::endl;
-            error_code = MHD_HTTP_NOT_FOUND;
-        }
+    if ( !action )
+    {
+        body << "{ \"error\" : \"Missing action parameter\" }" << std::endl;
+        return MHD_HTTP_NOT_FOUND;
     }
-    else {
-        body << "{ \"error\" : \"No dialog is open\" }" << std::endl;
-        error_code = MHD_HTTP_NOT_FOUND;
+
+    if( widgets.size() != 1 )
+    {
+        body << "{ \"error\" : \"Multiple widgets found to act on, try using multicriteria search (label+id+type)\" }" << std::endl;
+        return MHD_HTTP_NOT_FOUND;
     }
+
+    int error_code = do_action(widgets[0], action, param, body);
+
+    // invalidate the cached dialog snapshots, even a failed action
+    // might have changed something
+    YWidget::markChanged();
+
+    return error_code;
 }
 
-int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &action, struct MHD_Connection *connection, std::ostream& body)
+int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &action, const ParamLookup &param, std::ostream& body)
 {
 
     // TODO improve this, maybe use better names for the actions...
@@ -149,7 +155,7 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
         else
         {
             std::string value;
-            if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "value") )
+            if ( const char* val = param("value") )
                 value = val;
 
             if( YItemSelector* selector = dynamic_cast<YItemSelector*>(widget) )
@@ -195,7 +201,7 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
         else
         {
             std::string value;
-            if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "value") )
+            if ( const char* val = param("value") )
                 value = val;
 
             if( YItemSelector* selector = dynamic_cast<YItemSelector*>(widget) )
@@ -243,7 +249,7 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
         else
         {
             std::string value;
-            if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "value") )
+            if ( const char* val = param("value") )
                 value = val;
 
             if( YItemSelector* selector = dynamic_cast<YItemSelector*>(widget) )
@@ -269,7 +275,7 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
     else if ( action == "enter_text" )
     {
         std::string value;
-        if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "value") )
+        if ( const char* val = param("value") )
             value = val;
 
         if ( dynamic_cast<YInputField*>(widget) )
@@ -339,7 +345,7 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
     else if ( action == "select" )
     {
         std::string value;
-        if (const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "value"))
+        if (const char* val = param("value"))
             value = val;
         if ( dynamic_cast<YComboBox*>(widget) )
         {
@@ -362,11 +368,11 @@ int YHttpWidgetsActionHandler::do_action(YWidget *widget, const std::string &act
         else if( auto tbl = dynamic_cast<YTable*>(widget) )
         {
             int row_id = -1;
-            if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "row") )
+            if ( const char* val = param("row") )
                 row_id = atoi(val);
 
             int column_id = 0;
-            if ( const char* val = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "column") )
+            if ( const char* val = param("column") )
                 column_id = atoi(val);
 
             return action_handler<YTable>( widget, body, get_table_handler()->get_handler( tbl, value, column_id, row_id) );
@@ -54,6 +54,21 @@ public:
     YHttpWidgetsActionHandler() {};
     virtual ~YHttpWidgetsActionHandler() {};
 
+    /**
+     * Lookup of the action parameters ("value", "row", "column"),
+     * returns nullptr if the parameter is not set.
+     **/
+    typedef std::function<const char *(const char *name)> ParamLookup;
+
+    /**
+     * Find the widget matching the search criteria (at least one of them
+     * must be set) and run the action on it. Must be called in the UI thread.
+     * @param body HTTP response body stream, receives the error description
+     * @return HTTP status code
+     **/
+    int perform( const char *label, const char *id, const char *type,
+                 const char *action, const ParamLookup &param, std::ostream& body );
+
 protected:
 
     virtual void process_request(struct MHD_Connection* connection,
@@ -61,7 +76,7 @@ protected:
         size_t* upload_data_size, std::ostream& body, int& error_code,
         std::string& content_type, bool *redraw);
 
-    int do_action( YWidget *widget, const std::string &action, struct MHD_Connection *connection, std::ostream& body );
+    int do_action( YWidget *widget, const std::string &action, const ParamLookup &param, std::ostream& body );
 
     /**
      * Define widgets handlers to override in case need to implement
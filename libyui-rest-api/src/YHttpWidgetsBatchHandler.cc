@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <json/json.h>
+#include <microhttpd.h>
+
+#define YUILogComponent "rest-api"
+#include <yui/YUILog.h>
+
+#include <yui/YDialog.h>
+#include <yui/YWidget.h>
+
+#include "YHttpServer.h"
+#include "YHttpWidgetsActionHandler.h"
+#include "YJsonSerializer.h"
+#include "YHttpWidgetsBatchHandler.h"
+
+// the parameters of a single operation
+typedef std::map<std::string, std::string> OperationParams;
+
+// store the scalar JSON value (string, number or boolean) as a parameter
+static void add_param(OperationParams &params, const Json::Value &op, const char *name)
+{
+    const Json::Value &val = op[name];
+
+    if ( val.isString() || val.isNumeric() || val.isBool() )
+        params[name] = val.asString();
+}
+
+// the error message written by the action handler
+static std::string error_message(const std::string &output)
+{
+    Json::Value json;
+    Json::CharReaderBuilder builder;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+
+    if ( !reader->parse(output.data(), output.data() + output.size(), &json, nullptr)
+         || !json.isObject() )
+        return output;
+
+    return json["error"].asString();
+}
+
+void YHttpWidgetsBatchHandler::process_request(struct MHD_Connection* connection,
+    const char* url, const char* method, const char* upload_data,
+    size_t* upload_data_size, std::ostream& body, int& error_code,
+    std::string& content_type, bool *redraw)
+{
+    content_type = "application/json";
+
+    Json::Value operations;
+    Json::CharReaderBuilder builder;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    std::string parse_error;
+
+    if ( !reader->parse(upload_data, upload_data + *upload_data_size, &operations, &parse_error)
+         || !operations.isArray() )
+    {
+        std::string error ( "Expected a JSON array of operations in the request body" );
+        if ( !parse_error.empty() )
+            error.append( ": " ).append( parse_error );
+        error_code = handle_error( body, error, MHD_HTTP_BAD_REQUEST );
+        return;
+    }
+
+    YDialog *dialog = YDialog::topmostDialog(false);
+
+    if ( !dialog )
+    {
+        error_code = handle_error( body, "No dialog is open", MHD_HTTP_NOT_FOUND );
+        return;
+    }
+
+    yuiHttpLog() << "Running " << operations.size() << " batch operation(s)" << std::endl;
+
+    Json::Value results(Json::arrayValue);
+    bool changed = false;
+    error_code = MHD_HTTP_OK;
+
+    {
+        // the dialog is redrawn only once after all changes
+        YWidget::OptimizeChanges optimize( *dialog );
+
+        for ( const Json::Value &op: operations )
+        {
+            Json::Value result(Json::objectValue);
+
+            if ( op.isObject() )
+            {
+                const Json::Value &selector = op["selector"].isObject() ? op["selector"] : op;
+                OperationParams params;
+
+                for ( const char *name: { "label", "id", "type" } )
+                    add_param( params, selector, name );
+
+                for ( const char *name: { "action", "value", "row", "column" } )
+                    add_param( params, op, name );
+
+                auto param = [&params] (const char *name) -> const char * {
+                    auto it = params.find( name );
+                    return it == params.end() ? nullptr : it->second.c_str();
+                };
+
+                std::ostringstream output;
+                error_code = _action_handler->perform( param("label"), param("id"), param("type"),
+                                                       param("action"), param, output );
+
+                if ( error_code != MHD_HTTP_OK )
+                    result["error"] = error_message( output.str() );
+            }
+            else
+            {
+                error_code = MHD_HTTP_BAD_REQUEST;
+                result["error"] = "The operation is not a JSON object";
+            }
+
+            result["code"] = error_code;
+            results.append( result );
+
+            if ( error_code != MHD_HTTP_OK )
+                break;
+
+            changed = true;
+        }
+    }
+
+    // some operations might have succeeded before a failure
+    if ( redraw && changed )
+        *redraw = true;
+
+    YJsonSerializer::save( results, body );
+}
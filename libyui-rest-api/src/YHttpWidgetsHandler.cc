@@ -30,7 +30,7 @@ void YHttpWidgetsHandler::process_request(struct MHD_Connection* connection,
     if (YDialog::topmostDialog(false))  {
         WidgetArray widgets;
 
-        // TODO: allow filtering by both label and type
+        // the filters are combined (all of them must match)
         const char* label = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "label");
         const char* id = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "id");
         const char* type = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "type");
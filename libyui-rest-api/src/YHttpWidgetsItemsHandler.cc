@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+#include <microhttpd.h>
+#include <yui/YDialog.h>
+
+#include "YWidgetFinder.h"
+#include "YJsonSerializer.h"
+#include "YHttpWidgetsItemsHandler.h"
+
+// the default page size
+#define DEFAULT_LIMIT 100
+
+// parse the plain decimal digits at 'str' (no sign, no white space) up to
+// 'max', advance 'str' behind them, returns false if there are none
+static bool parse_digits(const char *&str, unsigned long long max, unsigned long long &value)
+{
+    if (!isdigit((unsigned char) *str))
+        return false;
+
+    value = 0;
+
+    while (isdigit((unsigned char) *str))
+    {
+        unsigned digit = *str++ - '0';
+
+        if (value > (max - digit) / 10)
+            return false;
+
+        value = value * 10 + digit;
+    }
+
+    return true;
+}
+
+// parse a non-negative number, returns false if invalid
+static bool parse_number(const char *str, size_t &value)
+{
+    unsigned long long ret;
+
+    if (!parse_digits(str, SIZE_MAX, ret) || *str)
+        return false;
+
+    value = ret;
+    return true;
+}
+
+// parse a comma separated list of the column numbers, returns false
+// if invalid (also for empty elements like in "1,,2" or "1,")
+static bool parse_columns(const char *str, std::vector<int> &columns)
+{
+    while (true)
+    {
+        unsigned long long column;
+
+        if (!parse_digits(str, INT_MAX, column))
+            return false;
+
+        columns.push_back(column);
+
+        if (!*str)
+            return true;
+
+        if (*str++ != ',')
+            return false;
+    }
+}
+
+void YHttpWidgetsItemsHandler::process_request(struct MHD_Connection* connection,
+    const char* url, const char* method, const char* upload_data,
+    size_t* upload_data_size, std::ostream& body, int& error_code,
+    std::string& content_type, bool *redraw)
+{
+    content_type = "application/json";
+
+    if (!YDialog::topmostDialog(false))
+    {
+        error_code = handle_error(body, "No dialog is open", MHD_HTTP_NOT_FOUND);
+        return;
+    }
+
+    const char* label = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "label");
+    const char* id = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "id");
+    const char* type = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "type");
+    const char* offset_arg = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "offset");
+    const char* limit_arg = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "limit");
+    const char* columns_arg = MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "columns");
+
+    size_t offset = 0;
+    size_t limit = DEFAULT_LIMIT;
+    std::vector<int> columns;
+
+    if ((offset_arg && !parse_number(offset_arg, offset))
+        || (limit_arg && !parse_number(limit_arg, limit))
+        || (columns_arg && !parse_columns(columns_arg, columns)))
+    {
+        error_code = handle_error(body, "Invalid offset, limit or columns parameter", MHD_HTTP_BAD_REQUEST);
+        return;
+    }
+
+    if (!label && !id && !type)
+    {
+        error_code = handle_error(body, "No search criteria provided", MHD_HTTP_NOT_FOUND);
+        return;
+    }
+
+    WidgetArray widgets = YWidgetFinder::find(label, id, type);
+
+    if (widgets.empty())
+    {
+        error_code = handle_error(body, "Widget not found", MHD_HTTP_NOT_FOUND);
+        return;
+    }
+
+    if (widgets.size() != 1)
+    {
+        error_code = handle_error(body, "Multiple widgets found, try using multicriteria search (label+id+type)",
+            MHD_HTTP_NOT_FOUND);
+        return;
+    }
+
+    if (!YJsonSerializer::serialize_items(widgets[0], body, offset, limit, columns))
+    {
+        std::string error("The widget does not have any items: ");
+        error_code = handle_error(body, error + widgets[0]->widgetClass(), MHD_HTTP_UNPROCESSABLE_ENTITY);
+        return;
+    }
+
+    error_code = MHD_HTTP_OK;
+}
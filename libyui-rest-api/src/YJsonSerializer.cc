@@ -14,6 +14,8 @@
   Floor, Boston, MA 02110-1301 USA
 */
 
+#include <algorithm>
+
 #include <json/json.h>
 
 #include <yui/YBarGraph.h>
@@ -41,153 +43,231 @@
 #include <yui/YWidgetID.h>
 #include <yui/YWizard.h>
 
+#include "YHttpResponseBody.h"
 #include "YJsonSerializer.h"
+#include "YJsonWriter.h"
 
-static void serialize_widget_properties(YWidget *widget, Json::Value &json);
-static void serialize_widget_data(YWidget *widget, Json::Value &json);
-static void serialize_widget_specific_data(YWidget *widget, Json::Value &json);
+static void serialize_widget_properties(YWidget *widget, YJsonWriter &json);
+static void serialize_widget_data(YWidget *widget, YJsonWriter &json);
+static void serialize_widget_specific_data(YWidget *widget, YJsonWriter &json);
 
-Json::Value serialize_rec(YWidget *w, bool recursive = true) {
-    Json::Value ret;
+static void serialize_rec(YWidget *w, YJsonWriter &json, bool recursive = true) {
+    json.begin_object();
 
-    serialize_widget_properties(w, ret);
-    serialize_widget_data(w, ret);
-    serialize_widget_specific_data(w, ret);
+    serialize_widget_properties(w, json);
+    serialize_widget_data(w, json);
+    serialize_widget_specific_data(w, json);
 
     if (recursive && w->hasChildren()) {
-        Json::Value widgets;
+        json.key("widgets");
+        json.begin_array();
 
         for ( YWidgetListConstIterator it = w->childrenBegin(); it != w->childrenEnd(); ++it )
         {
             if (*it)
-            {
-                Json::Value widget = serialize_rec(*it);
-                widgets.append(widget);
-            }
+                serialize_rec(*it, json);
         }
 
-        ret["widgets"] = widgets;
+        json.end_array();
     }
 
-    return ret;
+    json.end_object();
+}
+
+// Write the JSON text produced by 'write' to the output stream. The text is
+// appended directly to the HTTP response body if the stream writes to it.
+template<typename Writer>
+static void write_json(std::ostream &output, Writer write)
+{
+    if (auto body = dynamic_cast<YHttpResponseBody *>(output.rdbuf()))
+    {
+        YJsonWriter json(body->data(), body->compact());
+        write(json);
+        json.finish();
+    }
+    else
+    {
+        std::string buffer;
+        YJsonWriter json(buffer);
+        write(json);
+        json.finish();
+        output << buffer;
+    }
 }
 
 void YJsonSerializer::save(const Json::Value &json, std::ostream &output)
 {
+    auto body = dynamic_cast<YHttpResponseBody *>(output.rdbuf());
+
     // use a custom indentation, the default it too big,
     // the dialogs usually have too many nested widgets
     Json::StreamWriterBuilder builder;
-    builder["indentation"] = "  ";
+    builder["indentation"] = (body && body->compact()) ? "" : "  ";
     std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
     writer->write(json, &output);
 }
 
 void YJsonSerializer::serialize(YWidget *w, std::ostream &output, bool recursive) {
     if (!w) return;
-    Json::Value json = serialize_rec(w, recursive);
-    save(json, output);
+
+    write_json(output, [&](YJsonWriter &json) {
+        serialize_rec(w, json, recursive);
+    });
 }
 
 void YJsonSerializer::serialize(const std::vector<YWidget*> &widgets, std::ostream &output, bool recursive) {
-    Json::Value array;
+    write_json(output, [&](YJsonWriter &json) {
+        json.begin_array();
 
-    for(YWidget *widget: widgets)
-    {
-        Json::Value json = serialize_rec(widget, recursive);
-        array.append(json);
-    }
+        for(YWidget *widget: widgets)
+            serialize_rec(widget, json, recursive);
+
+        json.end_array();
+    });
+}
+
+void YJsonSerializer::serialize(YWidget *w, std::string &output, bool compact, bool recursive) {
+    if (!w) return;
 
-    save(array, output);
+    YJsonWriter json(output, compact);
+    serialize_rec(w, json, recursive);
+    json.finish();
 }
 
 namespace {
-    void add_opt_string_property(YWidget *w, const std::string &name, Json::Value &json, const std::string &key)
+    // get the property value only if the widget supports it
+    bool get_property(YWidget *w, const YPropertySet &propSet, const char *name, YPropertyValue &value)
+    {
+        if (!propSet.contains(name))
+            return false;
+
+        value = w->getProperty(name);
+        return true;
+    }
+
+    void add_opt_string_property(YWidget *w, const YPropertySet &propSet, const char *name, YJsonWriter &json, const char *key)
     {
+        YPropertyValue value;
+
         // only when not empty
-        if (w->propertySet().contains(name) && !w->getProperty(name).stringVal().empty())
-            json[key] = w->getProperty(name).stringVal();
+        if (get_property(w, propSet, name, value) && !value.stringVal().empty())
+            json.member(key, value.stringVal());
     }
 }
 
-void serialize_widget_properties(YWidget *widget, Json::Value &json) {
-    auto propSet = widget->propertySet();
+void serialize_widget_properties(YWidget *widget, YJsonWriter &json) {
+    const YPropertySet &propSet = widget->propertySet();
+    YPropertyValue value;
 
-    if (propSet.contains("WidgetClass"))
-        json["class"] = widget->getProperty("WidgetClass").stringVal();
+    if (get_property(widget, propSet, "WidgetClass", value))
+        json.member("class", value.stringVal());
 
     if (widget->hasId())
-        json["id"] = widget->id()->toString();
-
-    if (propSet.contains("Label"))
-        json["label"] = widget->getProperty("Label").stringVal();
+        json.member("id", widget->id()->toString());
 
-    // only when false
-    if (propSet.contains("Enabled") && !widget->getProperty("Enabled").boolVal())
-        json["enabled"] = widget->getProperty("Enabled").boolVal();
+    if (get_property(widget, propSet, "Label", value))
+        json.member("label", value.stringVal());
 
-    // only when true
-    if (propSet.contains("Notify") && widget->getProperty("Notify").boolVal())
-        json["notify"] = widget->getProperty("Notify").boolVal();
+    // "Enabled" and "Notify" are generic properties, they are written
+    // in serialize_widget_data()
 
-    add_opt_string_property(widget, "DebugLabel", json, "debug_label");
-    add_opt_string_property(widget, "Text", json, "text");
-    add_opt_string_property(widget, "ValidChars", json, "valid_chars");
-    add_opt_string_property(widget, "IconPath", json, "icon_path");
-    add_opt_string_property(widget, "HelpText", json, "help_text");
+    add_opt_string_property(widget, propSet, "DebugLabel", json, "debug_label");
+    add_opt_string_property(widget, propSet, "Text", json, "text");
+    add_opt_string_property(widget, propSet, "ValidChars", json, "valid_chars");
+    add_opt_string_property(widget, propSet, "IconPath", json, "icon_path");
+    add_opt_string_property(widget, propSet, "HelpText", json, "help_text");
 
-    // only when set
-    if (propSet.contains("InputMaxLength") && widget->getProperty("InputMaxLength").integerVal() >= 0)
-        json["input_max_length"] = (Json::Value::Int64)widget->getProperty("InputMaxLength").integerVal();
+    // only when set, YMultiLineEdit writes it in serialize_widget_specific_data()
+    if (!dynamic_cast<YMultiLineEdit*>(widget) && get_property(widget, propSet, "InputMaxLength", value) && value.integerVal() >= 0)
+        json.member("input_max_length", value.integerVal());
 
 }
 
-void serialize_widget_data(YWidget *widget, Json::Value &json) {
+void serialize_widget_data(YWidget *widget, YJsonWriter &json) {
     // generic data
     if (!widget->isEnabled())
-        json["enabled"] = widget->isEnabled();
+        json.member("enabled", false);
 
     if (widget->notify())
-        json["notify"] = widget->notify();
+        json.member("notify", true);
 
     if (widget->hasFunctionKey())
-        json["fkey"] = widget->functionKey();
+        json.member("fkey", widget->functionKey());
 
     if (widget->stretchable(YD_HORIZ))
-        json["hstretch"] = widget->stretchable(YD_HORIZ);
+        json.member("hstretch", true);
 
     if (widget->stretchable(YD_VERT))
-        json["vstretch"] = widget->stretchable(YD_VERT);
+        json.member("vstretch", true);
 
     if (widget->hasWeight(YD_HORIZ))
-        json["hweight"] = widget->weight(YD_HORIZ);
+        json.member("hweight", widget->weight(YD_HORIZ));
 
     if (widget->hasWeight(YD_VERT))
-        json["vweight"] = widget->weight(YD_VERT);
+        json.member("vweight", widget->weight(YD_VERT));
 }
 
 namespace
 {
-    void add_items_rec(Json::Value &jitem, const YItem *yitem)
+    // 'columns' optionally selects the table columns to add
+    void add_items_rec(YJsonWriter &json, const YItem *yitem, const std::vector<int> *columns = nullptr)
     {
+        json.begin_object();
+
         if (yitem->selected())
-            jitem["selected"] = true;
+            json.member("selected", true);
 
         // handle YTableItem specifically
-        if (auto tabitem = dynamic_cast<const YTableItem*>(yitem))
+        auto tabitem = dynamic_cast<const YTableItem*>(yitem);
+
+        if (tabitem && columns)
+        {
+            bool no_icon = std::none_of(columns->begin(), columns->end(), [&](int column)
+            {
+                return tabitem->hasIconName(column);
+            });
+
+            if (!no_icon)
+            {
+                json.key("icons");
+                json.begin_array();
+                for (int column: *columns)
+                    json.value(tabitem->iconName(column));
+                json.end_array();
+            }
+
+            json.key("labels");
+            json.begin_array();
+            for (int column: *columns)
+                json.value(tabitem->label(column));
+            json.end_array();
+        }
+        else if (tabitem)
         {
-            Json::Value icons, labels;
             // add icons only if not empty
-            bool no_icon = true;
-            std::for_each(tabitem->cellsBegin(), tabitem->cellsEnd(), [&](const YTableCell *ycell)
+            bool no_icon = std::all_of(tabitem->cellsBegin(), tabitem->cellsEnd(), [](const YTableCell *ycell)
             {
-                no_icon &= ycell->iconName().empty();
-                icons.append(ycell->iconName());
-                labels.append(ycell->label());
+                return ycell->iconName().empty();
             });
+
             if (!no_icon)
-                jitem["icons"] = icons;
+            {
+                json.key("icons");
+                json.begin_array();
+                std::for_each(tabitem->cellsBegin(), tabitem->cellsEnd(), [&](const YTableCell *ycell)
+                {
+                    json.value(ycell->iconName());
+                });
+                json.end_array();
+            }
 
-            jitem["labels"] = labels;
+            json.key("labels");
+            json.begin_array();
+            std::for_each(tabitem->cellsBegin(), tabitem->cellsEnd(), [&](const YTableCell *ycell)
+            {
+                json.value(ycell->label());
+            });
+            json.end_array();
         }
         // else if (auto treeitem = dynamic_cast<const YTreeItem*>(yitem))
         // {
@@ -195,31 +275,32 @@ namespace
         // }
         else
         {
-            jitem["label"] = yitem->label();
+            json.member("label", yitem->label());
 
             if (yitem->hasIconName())
-                jitem["icon_name"] = yitem->iconName();
+                json.member("icon_name", yitem->iconName());
         }
 
         // this is mainly for the generic widgets like YSelectionBox, YComboBox,...
         if (yitem->hasChildren())
         {
-            Json::Value children;
+            json.key("children");
+            json.begin_array();
 
             // recursively add the children
             std::for_each(yitem->childrenBegin(), yitem->childrenEnd(), [&](const YItem *ychild)
             {
-                Json::Value child;
-                add_items_rec(child, ychild);
-                children.append(child);
+                add_items_rec(json, ychild, columns);
             });
 
-            jitem["children"] = children;
+            json.end_array();
         }
+
+        json.end_object();
     }
 }
 // widget specific data
-static void serialize_widget_specific_data(YWidget *widget, Json::Value &json) {
+static void serialize_widget_specific_data(YWidget *widget, YJsonWriter &json) {
 
     // check all classes, some widgets might be derived from others
     // TODO: group the base classes and the final classes
@@ -233,69 +314,59 @@ static void serialize_widget_specific_data(YWidget *widget, Json::Value &json) {
         case YGnomeButtonOrder  : order = "Gnome"; break;
         }
 
-        json["button_order"] = order;
+        json.member("button_order", order);
     }
 
     if (auto cb = dynamic_cast<YComboBox*>(widget))
     {
-        json["value"] = cb->value();
+        json.member("value", cb->value());
 
         if (cb->editable())
-            json["editable"] = true;
+            json.member("editable", true);
     }
 
     if (auto ch = dynamic_cast<YCheckBox*>(widget))
     {
         if (ch->value() != YCheckBoxState::YCheckBox_dont_care)
-            json["value"] = ch->isChecked();
+            json.member("value", ch->isChecked());
     }
 
     if (auto cbframe = dynamic_cast<YCheckBoxFrame*>(widget))
     {
-        json["auto_enable"] = cbframe->autoEnable();
+        json.member("auto_enable", cbframe->autoEnable());
     }
 
     if (auto img = dynamic_cast<YImage*>(widget))
     {
-        json["image_file_name"] = img->imageFileName();
-        json["animated"] = img->animated();
-        json["auto_scale"] = img->autoScale();
+        json.member("image_file_name", img->imageFileName());
+        json.member("animated", img->animated());
+        json.member("auto_scale", img->autoScale());
     }
 
     if (auto inp = dynamic_cast<YInputField*>(widget))
     {
-        json["value"] = inp->value();
-        json["password_mode"] = inp->passwordMode();
-    }
-
-    if (auto inp = dynamic_cast<YMultiLineEdit*>(widget))
-    {
-        json["value"] = inp->value();
-    }
-
-    if (auto inp = dynamic_cast<YProgressBar*>(widget))
-    {
-        json["value"] = inp->value();
+        json.member("value", inp->value());
+        json.member("password_mode", inp->passwordMode());
     }
 
     if (auto intf = dynamic_cast<YIntField*>(widget))
     {
-        json["value"] = intf->value();
-        json["min_value"] = intf->minValue();
-        json["max_value"] = intf->maxValue();
+        json.member("value", intf->value());
+        json.member("min_value", intf->minValue());
+        json.member("max_value", intf->maxValue());
     }
 
     if (auto rb = dynamic_cast<YRadioButton*>(widget))
     {
-        json["value"] = rb->value();
+        json.member("value", rb->value());
     }
 
     if (auto sp = dynamic_cast<YSpacing*>(widget))
     {
         if (sp->dimension() == YD_HORIZ)
-            json["value"] = sp->preferredWidth();
+            json.member("value", sp->preferredWidth());
         else
-            json["value"] = sp->preferredHeight();
+            json.member("value", sp->preferredHeight());
     }
 
     if (auto dg = dynamic_cast<YDialog*>(widget))
@@ -303,13 +374,13 @@ static void serialize_widget_specific_data(YWidget *widget, Json::Value &json) {
         switch (dg->dialogType())
         {
             case YMainDialog:
-                json["type"] = "main";
+                json.member("type", "main");
                 break;
             case YPopupDialog:
-                json["type"] = "popup";
+                json.member("type", "popup");
                 break;
             case YWizardDialog:
-                json["type"] = "wizard";
+                json.member("type", "wizard");
                 break;
         }
     }
@@ -317,75 +388,77 @@ static void serialize_widget_specific_data(YWidget *widget, Json::Value &json) {
     if (auto label = dynamic_cast<YLabel*>(widget))
     {
         if (label->isHeading())
-            json["is_heading"] = true;
+            json.member("is_heading", true);
 
         if (label->isOutputField())
-            json["is_output_field"] = true;
+            json.member("is_output_field", true);
 
         if (label->useBoldFont())
-            json["use_bold_font"] = true;
+            json.member("use_bold_font", true);
     }
 
     if (auto lv = dynamic_cast<YLogView*>(widget))
     {
-        json["lines"] = lv->lines();
-        json["log_text"] = lv->logText();
-        json["max_lines"] = lv->maxLines();
-        json["visible_lines"] = lv->visibleLines();
+        json.member("lines", lv->lines());
+        json.member("log_text", lv->logText());
+        json.member("max_lines", lv->maxLines());
+        json.member("visible_lines", lv->visibleLines());
     }
 
     if (auto mle = dynamic_cast<YMultiLineEdit*>(widget))
     {
-        json["input_max_length"] = mle->inputMaxLength();
-        json["default_visible_lines"] = mle->defaultVisibleLines();
+        json.member("value", mle->value());
+        json.member("input_max_length", mle->inputMaxLength());
+        json.member("default_visible_lines", mle->defaultVisibleLines());
     }
 
     if (auto pkg = dynamic_cast<YPackageSelector*>(widget))
     {
-        json["test_mode"] = pkg->testMode();
-        json["online_update_mode"] = pkg->onlineUpdateMode();
-        json["update_mode"] = pkg->updateMode();
-        json["search_mode"] = pkg->searchMode();
-        json["summary_mode"] = pkg->summaryMode();
-        json["repo_mode"] = pkg->repoMode();
-        json["repo_mgr_enabled"] = pkg->repoMgrEnabled();
-        json["confirm_unsupported"] = pkg->confirmUnsupported();
+        json.member("test_mode", pkg->testMode());
+        json.member("online_update_mode", pkg->onlineUpdateMode());
+        json.member("update_mode", pkg->updateMode());
+        json.member("search_mode", pkg->searchMode());
+        json.member("summary_mode", pkg->summaryMode());
+        json.member("repo_mode", pkg->repoMode());
+        json.member("repo_mgr_enabled", pkg->repoMgrEnabled());
+        json.member("confirm_unsupported", pkg->confirmUnsupported());
     }
 
     if (auto selection = dynamic_cast<YSelectionWidget*>(widget))
     {
-        json["items_count"] = selection->itemsCount();
-        json["icon_base_path"] = selection->iconBasePath();
+        json.member("items_count", selection->itemsCount());
+        json.member("icon_base_path", selection->iconBasePath());
 
-        Json::Value items;
+        json.key("items");
+        json.begin_array();
         std::for_each(selection->itemsBegin(), selection->itemsEnd(), [&](const YItem *yitem)
         {
-            Json::Value item;
-            add_items_rec(item, yitem);
-            items.append(item);
+            add_items_rec(json, yitem);
         });
-
-        json["items"] = items;
+        json.end_array();
     }
 
     if (auto progress = dynamic_cast<YProgressBar*>(widget))
     {
-        json["max_value"] = progress->maxValue();
+        json.member("value", progress->value());
+        json.member("max_value", progress->maxValue());
     }
 
     if (auto tb = dynamic_cast<YTable*>(widget))
     {
-        Json::Value header;
+        json.key("header");
+        json.begin_array();
         for ( auto idx = 0; idx < tb->columns(); ++idx )
         {
-            header.append(tb->header(idx));
+            json.value(tb->header(idx));
         }
-        json["header"] = header;
+        json.end_array();
 
-        Json::Value alignment;
+        json.key("alignment");
+        json.begin_array();
         for ( auto idx = 0; idx < tb->columns(); ++idx )
         {
-            std::string alignment_str;
+            const char *alignment_str = "";
             switch (tb->alignment(idx))
             {
                 case YAlignUnchanged:
@@ -401,38 +474,95 @@ static void serialize_widget_specific_data(YWidget *widget, Json::Value &json) {
                     alignment_str = "center";
                     break;
             }
-            alignment.append(alignment_str);
+            json.value(alignment_str);
         }
-        json["alignment"] = alignment;
+        json.end_array();
 
-        json["columns"] = tb->columns();
-        json["immediate_mode"] = tb->immediateMode();
-        json["keep_sorting"] = tb->keepSorting();
-        json["hasMultiSelection"] = tb->hasMultiSelection();
+        json.member("columns", tb->columns());
+        json.member("immediate_mode", tb->immediateMode());
+        json.member("keep_sorting", tb->keepSorting());
+        json.member("hasMultiSelection", tb->hasMultiSelection());
     }
 
     if ( auto bargraph = dynamic_cast<YBarGraph*>(widget) )
     {
-        Json::Value jsegment, jsegments;
+        json.key("segments");
+        json.begin_array();
         for ( auto idx = 0; idx < bargraph->segments(); ++idx )
         {
-            std::string label;
             YBarGraphSegment segment = bargraph->segment(idx);
-            jsegment["label"] = segment.label();
-            jsegment["value"] = segment.value();
-            jsegments.append(jsegment);
+            json.begin_object();
+            json.member("label", segment.label());
+            json.member("value", segment.value());
+            json.end_object();
         }
-        json["segments"] = jsegments;
-
+        json.end_array();
     }
 
     if (auto df = dynamic_cast<YDateField*>(widget))
     {
-        json["value"] = df->value();
+        json.member("value", df->value());
     }
 
     if (auto tf = dynamic_cast<YTimeField*>(widget))
     {
-        json["value"] = tf->value();
+        json.member("value", tf->value());
     }
 }
+
+bool YJsonSerializer::serialize_items(YWidget *w, std::ostream &output, size_t offset, size_t limit,
+    const std::vector<int> &columns)
+{
+    auto selection = dynamic_cast<YSelectionWidget*>(w);
+
+    if (!selection)
+        return false;
+
+    auto table = dynamic_cast<YTable*>(w);
+    // only the tables have columns
+    const std::vector<int> *selected_columns = table && !columns.empty() ? &columns : nullptr;
+    // paging the top level items, the collection allows random access
+    size_t total = selection->itemsCount();
+    size_t begin = std::min(offset, total);
+    size_t end = begin + std::min(limit, total - begin);
+
+    write_json(output, [&](YJsonWriter &json) {
+        json.begin_object();
+        json.member("class", w->widgetClass());
+        json.member("total", (long long) total);
+        json.member("offset", (long long) begin);
+        json.member("count", (long long) (end - begin));
+
+        if (table)
+        {
+            json.key("header");
+            json.begin_array();
+
+            if (selected_columns)
+            {
+                for (int column: columns)
+                    json.value(column >= 0 && column < table->columns() ? table->header(column) : "");
+            }
+            else
+            {
+                for (int column = 0; column < table->columns(); ++column)
+                    json.value(table->header(column));
+            }
+
+            json.end_array();
+        }
+
+        json.key("items");
+        json.begin_array();
+
+        YItemConstIterator it = selection->itemsBegin() + begin;
+
+        for (size_t i = begin; i < end; ++i, ++it)
+            add_items_rec(json, *it, selected_columns);
+
+        json.end_array();
+        json.end_object();
+    });
+
+    return true;
+}
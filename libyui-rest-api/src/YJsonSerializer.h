@@ -18,6 +18,7 @@
 #define YJsonSerializer_h
 
 #include <iostream>
+#include <string>
 #include <vector>
 
 class YWidget;
@@ -37,6 +38,16 @@ public:
     // serialize widget array (by default recursively with all children)
     static void serialize(const std::vector<YWidget*> &widgets, std::ostream &output, bool recursive = true);
 
+    // serialize one widget and append the JSON text to the output string,
+    // optionally without indentation
+    static void serialize(YWidget *, std::string &output, bool compact, bool recursive = true);
+
+    // serialize the items of a selection widget (e.g. YTable or YTree),
+    // only 'limit' items starting at 'offset' and only the table 'columns'
+    // (all columns if empty), returns false if the widget has no items
+    static bool serialize_items(YWidget *, std::ostream &output, size_t offset, size_t limit,
+        const std::vector<int> &columns);
+
     // save the JSON value as a text into the output stream
     static void save(const Json::Value &json, std::ostream &output);
 };
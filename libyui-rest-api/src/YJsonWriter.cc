@@ -0,0 +1,199 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "YJsonWriter.h"
+
+YJsonWriter::YJsonWriter(std::string &output, bool compact)
+    : _out(output), _compact(compact), _after_key(false)
+{
+}
+
+void YJsonWriter::new_line()
+{
+    if (_compact)
+        return;
+
+    // use a small indentation, the dialogs usually have many nested widgets
+    _out += '\n';
+    _out.append(_has_value.size() * 2, ' ');
+}
+
+void YJsonWriter::before_value()
+{
+    if (_after_key)
+    {
+        _after_key = false;
+        return;
+    }
+
+    if (!_has_value.empty())
+    {
+        if (_has_value.back())
+            _out += ',';
+
+        _has_value.back() = true;
+        new_line();
+    }
+}
+
+void YJsonWriter::begin_object()
+{
+    before_value();
+    _out += '{';
+    _has_value.push_back(false);
+}
+
+void YJsonWriter::end_object()
+{
+    bool empty = !_has_value.back();
+    _has_value.pop_back();
+
+    if (!empty)
+        new_line();
+
+    _out += '}';
+}
+
+void YJsonWriter::begin_array()
+{
+    before_value();
+    _out += '[';
+    _has_value.push_back(false);
+}
+
+void YJsonWriter::end_array()
+{
+    bool empty = !_has_value.back();
+    _has_value.pop_back();
+
+    if (!empty)
+        new_line();
+
+    _out += ']';
+}
+
+void YJsonWriter::key(const char *name)
+{
+    before_value();
+    write_string(name, strlen(name));
+    _out += _compact ? ":" : " : ";
+    _after_key = true;
+}
+
+void YJsonWriter::value(const std::string &str)
+{
+    before_value();
+    write_string(str.data(), str.size());
+}
+
+void YJsonWriter::value(const char *str)
+{
+    before_value();
+    write_string(str, strlen(str));
+}
+
+void YJsonWriter::value(bool val)
+{
+    before_value();
+    _out += val ? "true" : "false";
+}
+
+void YJsonWriter::value(int val)
+{
+    value((long long) val);
+}
+
+void YJsonWriter::value(long long val)
+{
+    before_value();
+
+    char buffer[32];
+    int len = snprintf(buffer, sizeof(buffer), "%lld", val);
+    _out.append(buffer, len);
+}
+
+void YJsonWriter::value(double val)
+{
+    before_value();
+
+    // JSON does not support NaN or infinity
+    if (!std::isfinite(val))
+    {
+        _out += "null";
+        return;
+    }
+
+    char buffer[32];
+    int len = snprintf(buffer, sizeof(buffer), "%.17g", val);
+    _out.append(buffer, len);
+}
+
+void YJsonWriter::raw(const std::string &json)
+{
+    before_value();
+    _out += json;
+}
+
+void YJsonWriter::finish()
+{
+    if (!_compact)
+        _out += '\n';
+}
+
+void YJsonWriter::write_string(const char *str, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    _out += '"';
+
+    // copy the runs of characters which do not need escaping at once,
+    // UTF-8 sequences are written as they are
+    size_t start = 0;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        unsigned char ch = str[i];
+
+        if (ch >= 0x20 && ch != '"' && ch != '\\')
+            continue;
+
+        _out.append(str + start, i - start);
+        start = i + 1;
+
+        switch (ch)
+        {
+            case '"':  _out += "\\\""; break;
+            case '\\': _out += "\\\\"; break;
+            case '\b': _out += "\\b"; break;
+            case '\f': _out += "\\f"; break;
+            case '\n': _out += "\\n"; break;
+            case '\r': _out += "\\r"; break;
+            case '\t': _out += "\\t"; break;
+            default:
+                _out += "\\u00";
+                _out += hex[ch >> 4];
+                _out += hex[ch & 0xf];
+                break;
+        }
+    }
+
+    _out.append(str + start, len - start);
+    _out += '"';
+}
@@ -0,0 +1,94 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef YJsonWriter_h
+#define YJsonWriter_h
+
+#include <string>
+#include <vector>
+
+/**
+ * Streaming JSON writer, appends the JSON text directly to a string
+ * without building a document tree first.
+ *
+ * The caller is responsible for the structure: values in objects must be
+ * preceded by key(), each begin_object()/begin_array() must be closed by
+ * the matching end_object()/end_array().
+ **/
+class YJsonWriter
+{
+
+public:
+
+    /**
+     * Constructor, the output is appended to 'output'.
+     * In the compact mode no indentation and no line breaks are written.
+     **/
+    YJsonWriter(std::string &output, bool compact = false);
+
+    void begin_object();
+    void end_object();
+
+    void begin_array();
+    void end_array();
+
+    /**
+     * Write an object key, must be followed by a value or by
+     * begin_object()/begin_array().
+     **/
+    void key(const char *name);
+
+    void value(const std::string &str);
+    void value(const char *str);
+    void value(bool val);
+    void value(int val);
+    void value(long long val);
+    void value(double val);
+
+    /**
+     * Write a value which is already JSON encoded (e.g. a serialized widget).
+     **/
+    void raw(const std::string &json);
+
+    /**
+     * Shortcut for writing a key and a value.
+     **/
+    template<typename T>
+    void member(const char *name, const T &val)
+    {
+        key(name);
+        value(val);
+    }
+
+    /**
+     * Write a finishing new line (only in the non-compact mode).
+     **/
+    void finish();
+
+private:
+
+    void before_value();
+    void new_line();
+    void write_string(const char *str, size_t len);
+
+    std::string &_out;
+    bool _compact;
+    // nesting levels, true if a value has been written at that level
+    std::vector<bool> _has_value;
+    bool _after_key;
+};
+
+#endif // YJsonWriter_h
@@ -45,5 +45,10 @@ std::string normalize_label_shortcut(const std::string& label)
 
 std::string YWidgetActionHandler::normalize_label(const std::string & label)
 {
+    // all BiDi control characters start with the 0xE2 byte in UTF-8,
+    // skip the expensive wide string conversion for the other labels
+    if (label.find('\xE2') == std::string::npos)
+        return normalize_label_shortcut(label);
+
     return normalize_label_shortcut(normalize_label_bidi(label));
 }
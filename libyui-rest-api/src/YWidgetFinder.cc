@@ -14,9 +14,8 @@
   Floor, Boston, MA 02110-1301 USA
 */
 
-// boost::erase_all
-#include <boost/algorithm/string.hpp>
-#include <functional>
+#include <algorithm>
+#include <unordered_map>
 
 #include <yui/YDialog.h>
 #include <yui/YWidget.h>
@@ -26,101 +25,196 @@
 #include "YWidgetActionHandler.h"
 
 
-// internal helper methods
-static bool filter_by_label_rec(YWidget *w, const std::string &label);
-static bool filter_by_id_rec(YWidget *w, const std::string &id);
-static bool filter_by_type_rec(YWidget *w, const std::string &type);
-static void find_widgets(YWidget *w, WidgetArray &array, std::function<bool (YWidget*)> filter_func);
+namespace {
 
-// WidgetArray YWidgetFinder::find(const std::string &label, const std::string &id, const std::string &type)
-WidgetArray YWidgetFinder::find( const char* label, const char* id, const char* type )
-{
-    WidgetArray ret;
-    find_widgets(YDialog::topmostDialog(), ret, [& label, & id, & type] (YWidget *w) {
-        return (!label || filter_by_label_rec(w, label)) &&
-               (!id || filter_by_id_rec(w, id)) &&
-               (!type || filter_by_type_rec(w, type));
-    } );
-    return ret;
-}
+    // index of a widget tree, the widgets are referenced by their
+    // position in the tree order so the results keep the order
+    class WidgetIndex
+    {
 
-WidgetArray YWidgetFinder::by_label(const std::string &label)
-{
-    WidgetArray ret;
-    find_widgets(YDialog::topmostDialog(), ret, [& label] (YWidget *w) {
-        return filter_by_label_rec(w, label);
-    } );
-    return ret;
-}
+    public:
+
+        WidgetIndex() : _root(nullptr), _revision(0), _labels_indexed(false) {}
+
+        // rebuild the index if the tree might have changed since
+        // the last lookup
+        void update(YWidget *root)
+        {
+            unsigned long long revision = YWidget::changeRevision();
+
+            if (root == _root && revision == _revision)
+                return;
+
+            _root = root;
+            _revision = revision;
+            _entries.clear();
+            _by_id.clear();
+            _by_type.clear();
+            _by_label.clear();
+            _labels_indexed = false;
+
+            if (root)
+                add(root);
+        }
+
+        WidgetArray find(const char* label, const char* id, const char* type)
+        {
+            std::string normalized_label;
+            const Positions *candidates = nullptr;
+
+            // start with the shortest list, the other criteria
+            // are then checked for each candidate
+            if (id && !shortest(_by_id, id, candidates))
+                return WidgetArray();
+
+            if (type && !shortest(_by_type, type, candidates))
+                return WidgetArray();
+
+            if (label)
+            {
+                index_labels();
+                normalized_label = YWidgetActionHandler::normalize_label(label);
+
+                if (!shortest(_by_label, normalized_label, candidates))
+                    return WidgetArray();
+            }
+
+            WidgetArray ret;
+
+            if (!candidates)
+            {
+                ret.reserve(_entries.size());
+
+                for (const Entry &entry: _entries)
+                    ret.push_back(entry.widget);
+
+                return ret;
+            }
+
+            for (size_t pos: *candidates)
+            {
+                const Entry &entry = _entries[pos];
+
+                if ((!id || entry.id == id) &&
+                    (!type || entry.type == type) &&
+                    (!label || (entry.has_label && entry.label == normalized_label)))
+                    ret.push_back(entry.widget);
+            }
+
+            return ret;
+        }
+
+    private:
+
+        typedef std::vector<size_t> Positions;
+        typedef std::unordered_map<std::string, Positions> Postings;
+
+        struct Entry
+        {
+            YWidget *widget;
+            std::string id;
+            std::string type;
+            // normalized label (without shortcuts and BiDi control characters)
+            std::string label;
+            bool has_label;
+        };
+
+        void add(YWidget *w)
+        {
+            size_t pos = _entries.size();
+            _entries.push_back(Entry());
+            Entry &entry = _entries.back();
+
+            entry.widget = w;
+            entry.type = w->widgetClass();
+            _by_type[entry.type].push_back(pos);
+
+            if (w->hasId())
+            {
+                entry.id = w->id()->toString();
+                _by_id[entry.id].push_back(pos);
+            }
+
+            for (YWidget *child: *w)
+                add(child);
+        }
+
+        // the labels are indexed only when needed, reading and
+        // normalizing them is the most expensive part
+        void index_labels()
+        {
+            if (_labels_indexed)
+                return;
+
+            for (size_t pos = 0; pos < _entries.size(); ++pos)
+            {
+                Entry &entry = _entries[pos];
+                entry.has_label = entry.widget->propertySet().contains("Label");
+
+                if (entry.has_label)
+                {
+                    entry.label = YWidgetActionHandler::normalize_label(entry.widget->getProperty("Label").stringVal());
+                    _by_label[entry.label].push_back(pos);
+                }
+            }
+
+            _labels_indexed = true;
+        }
+
+        // find the key, remember its list if it is shorter than 'candidates'
+        // returns false if the key is not found
+        static bool shortest(const Postings &postings, const std::string &key, const Positions *&candidates)
+        {
+            auto it = postings.find(key);
+
+            if (it == postings.end())
+                return false;
+
+            if (!candidates || it->second.size() < candidates->size())
+                candidates = &it->second;
 
-WidgetArray YWidgetFinder::by_id(const std::string &id)
-{
-    WidgetArray ret;
-    find_widgets(YDialog::topmostDialog(), ret, [& id] (YWidget *w) {
-        return filter_by_id_rec(w, id);
-    } );
-    return ret;
+            return true;
+        }
+
+        YWidget *_root;
+        unsigned long long _revision;
+        std::vector<Entry> _entries;
+        Postings _by_id;
+        Postings _by_type;
+        Postings _by_label;
+        bool _labels_indexed;
+    };
+
+    WidgetIndex widget_index;
 }
 
-WidgetArray YWidgetFinder::by_type(const std::string &type)
+WidgetArray YWidgetFinder::find( const char* label, const char* id, const char* type )
 {
-    WidgetArray ret;
-    find_widgets(YDialog::topmostDialog(), ret, [& type] (YWidget *w) {
-        return filter_by_type_rec(w, type);
-    } );
-    return ret;
+    return find(YDialog::topmostDialog(), label, id, type);
 }
 
-WidgetArray YWidgetFinder::all()
+WidgetArray YWidgetFinder::find( YWidget *root, const char* label, const char* id, const char* type )
 {
-    WidgetArray ret;
-    find_widgets(YDialog::topmostDialog(), ret, [] (YWidget *w) {
-        return true;
-    } );
-    return ret;
+    widget_index.update(root);
+    return widget_index.find(label, id, type);
 }
 
-void find_widgets(YWidget *w, WidgetArray &array, std::function<bool (YWidget*)> filter_func) {
-    if ( !w )
-        return;
-
-    if( filter_func(w) )
-        array.push_back(w);
-
-    for(YWidget *child: *w)
-    {
-        find_widgets(child, array, filter_func);
-    };
+WidgetArray YWidgetFinder::by_label(const std::string &label)
+{
+    return find(label.c_str(), nullptr, nullptr);
 }
 
-static bool filter_by_label_rec(YWidget *w, const std::string &label)
+WidgetArray YWidgetFinder::by_id(const std::string &id)
 {
-    // check the widget label if it is defined
-    if ( w->propertySet().contains("Label") )
-    {
-        std::string widget_label = w->getProperty("Label").stringVal();
-
-        if ( YWidgetActionHandler::normalized_labels_equal( widget_label, label ) )
-            return true;
-    }
-    return false;
+    return find(nullptr, id.c_str(), nullptr);
 }
 
-static bool filter_by_id_rec(YWidget *w, const std::string &id)
+WidgetArray YWidgetFinder::by_type(const std::string &type)
 {
-    if ( w->hasId() && w->id()->toString() == id )
-        return true;
-
-    return false;
+    return find(nullptr, nullptr, type.c_str());
 }
 
-
-static bool filter_by_type_rec(YWidget *w, const std::string &type)
+WidgetArray YWidgetFinder::all()
 {
-    auto propSet = w->propertySet();
-
-    if ( propSet.contains("WidgetClass") && w->getProperty("WidgetClass").stringVal() == type )
-        return true;
-
-    return false;
+    return find(nullptr, nullptr, nullptr);
 }
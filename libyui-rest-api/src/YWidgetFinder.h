@@ -24,14 +24,30 @@ class YWidget;
 
 typedef std::vector<YWidget*> WidgetArray;
 
+/**
+ * Find widgets in the topmost dialog.
+ *
+ * The lookups use an index of the widget IDs, types and normalized labels
+ * which is built on the first query and reused until the widget change
+ * revision (YWidget::changeRevision()) or the dialog changes. The index
+ * must be used only in the UI thread.
+ **/
 class YWidgetFinder
 {
 
 public:
 
-    // static WidgetArray find(const std::string &label, const std::string &id, const std::string &type);
+    /**
+     * Find the widgets matching all the specified criteria, the unset
+     * (null) criteria are ignored. The result is in the widget tree order.
+     **/
     static WidgetArray find( const char* label, const char* id, const char* type );
 
+    /**
+     * Same as above, but search the widget tree starting at 'root'.
+     **/
+    static WidgetArray find( YWidget *root, const char* label, const char* id, const char* type );
+
     static WidgetArray by_label(const std::string &label);
 
     static WidgetArray by_id(const std::string &id);
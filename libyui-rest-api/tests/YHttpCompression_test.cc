@@ -0,0 +1,58 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for parsing the Accept-Encoding header
+
+#define BOOST_TEST_MODULE YHttpCompression_tests
+#include <boost/test/unit_test.hpp>
+
+#include "YHttpCompression.h"
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+BOOST_AUTO_TEST_CASE( listed_encodings )
+{
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( nullptr ), YHttpCompression::NONE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "" ), YHttpCompression::NONE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "identity" ), YHttpCompression::NONE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "gzip" ), YHttpCompression::GZIP );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "deflate" ), YHttpCompression::DEFLATE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "deflate, GZIP" ), YHttpCompression::GZIP );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "gzip;q=0, deflate;q=0.5" ), YHttpCompression::DEFLATE );
+}
+
+BOOST_AUTO_TEST_CASE( wildcard )
+{
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "*" ), YHttpCompression::GZIP );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "*;q=0" ), YHttpCompression::NONE );
+
+    // an explicitly listed encoding takes precedence over "*"
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "gzip;q=0, *" ), YHttpCompression::DEFLATE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "*, gzip;q=0" ), YHttpCompression::DEFLATE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "gzip;q=0, deflate;q=0, *" ), YHttpCompression::NONE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "deflate, *;q=0" ), YHttpCompression::DEFLATE );
+    BOOST_CHECK_EQUAL( YHttpCompression::parse( "br, *;q=0" ), YHttpCompression::NONE );
+}
@@ -0,0 +1,181 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is a smoke test for the YHttpServer with the server threads: It
+// sends requests over the Unix domain socket while the test (the "UI
+// thread") processes the queued requests.
+
+#define BOOST_TEST_MODULE YHttpServer_tests
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <yui/YWidget.h>
+
+#include "YHttpCompression.h"
+#include "YHttpResponseCache.h"
+#include "YHttpServer.h"
+
+using std::string;
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// send a request over the Unix domain socket, return the whole response
+static string send_request( const string & socket_path, const string & request )
+{
+    int fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+    if ( fd < 0 )
+        return "";
+
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    socket_path.copy( address.sun_path, sizeof( address.sun_path ) - 1 );
+
+    string response;
+
+    if ( connect( fd, (struct sockaddr *) &address, sizeof( address ) ) == 0 &&
+         write( fd, request.data(), request.size() ) == (ssize_t) request.size() )
+    {
+        char buffer[ 4096 ];
+        ssize_t size;
+
+        while ( ( size = read( fd, buffer, sizeof( buffer ) ) ) > 0 )
+            response.append( buffer, size );
+    }
+
+    close( fd );
+    return response;
+}
+
+static string get( const string & socket_path, const string & url, const string & headers = "" )
+{
+    return send_request( socket_path, "GET " + url + " HTTP/1.1\r\nHost: localhost\r\n" +
+                         headers + "Connection: close\r\n\r\n" );
+}
+
+// a server with two threads on a Unix domain socket
+struct ThreadedServer {
+    ThreadedServer()
+    {
+        char tmpl[] = "/tmp/YHttpServer_test.XXXXXX";
+        dir = mkdtemp( tmpl );
+        socket_path = dir + "/api.sock";
+
+        setenv( YUI_HTTP_SOCKET, socket_path.c_str(), 1 );
+        setenv( YUI_HTTP_THREADS, "2", 1 );
+        unsetenv( YUITest_HTTP_PORT );
+
+        server = new YHttpServer();
+        server->start();
+    }
+
+    ~ThreadedServer()
+    {
+        delete server;
+        rmdir( dir.c_str() );
+    }
+
+    // process the queued requests like the UI does until 'done' is set
+    void process_until( const std::atomic<bool> & done )
+    {
+        while ( ! done )
+        {
+            std::vector<struct pollfd> fds;
+
+            for ( int fd : server->sockets().read() )
+                fds.push_back( { fd, POLLIN, 0 } );
+
+            if ( poll( fds.data(), fds.size(), 50 ) > 0 )
+                server->process_data();
+        }
+    }
+
+    string dir;
+    string socket_path;
+    YHttpServer * server;
+};
+
+BOOST_FIXTURE_TEST_CASE( threaded_requests, ThreadedServer )
+{
+    std::atomic<bool> done( false );
+    string version;
+    std::vector<string> dialogs( 4 );
+
+    std::thread client( [&]() {
+        // processed in a server thread
+        version = get( socket_path, "/version" );
+
+        // processed in the UI thread, several at once
+        std::vector<std::thread> clients;
+
+        for ( string & dialog : dialogs )
+            clients.emplace_back( [&]() { dialog = get( socket_path, "/v1/dialog" ); } );
+
+        for ( std::thread & thread : clients )
+            thread.join();
+
+        done = true;
+    } );
+
+    process_until( done );
+    client.join();
+
+    BOOST_CHECK_EQUAL( version.compare( 0, 15, "HTTP/1.1 200 OK" ), 0 );
+
+    // there is no UI, so there is no dialog
+    for ( const string & dialog : dialogs )
+        BOOST_CHECK_EQUAL( dialog.compare( 0, 22, "HTTP/1.1 404 Not Found" ), 0 );
+}
+
+BOOST_FIXTURE_TEST_CASE( long_polling, ThreadedServer )
+{
+    BOOST_REQUIRE( server->can_suspend() );
+
+    std::atomic<bool> done( false );
+    string response;
+    string etag = YHttpResponseCache::etag( YWidget::changeRevision(), YHttpCompression::NONE );
+
+    // the request is suspended until the timeout, then answered with 304
+    std::thread client( [&]() {
+        response = get( socket_path, "/v1/dialog?timeout=100", "If-None-Match: " + etag + "\r\n" );
+        done = true;
+    } );
+
+    process_until( done );
+    client.join();
+
+    BOOST_CHECK_EQUAL( response.compare( 0, 25, "HTTP/1.1 304 Not Modified" ), 0 );
+}
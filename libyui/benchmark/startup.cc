@@ -0,0 +1,246 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+/*
+  Benchmark for the time to the first dialog of each UI plug-in.
+
+  Usage:
+
+    yui-startup [RUNS [WORK_MS]]
+
+  For each installed UI plug-in (Qt and NCurses) and each way of loading it
+  (resolving all symbols right away, lazy binding, preloading in a thread),
+  this starts RUNS processes (default 5). Each of them simulates WORK_MS
+  milliseconds (default 50) of initialization of the application itself,
+  loads the UI, opens a small YesNo popup and waits until it has been
+  painted. It reports the median time of each phase recorded by
+  YStartupProfiler and of the whole startup.
+
+  The UI loader only selects the Qt UI if DISPLAY is set, so the Qt UI is
+  skipped without it. To run it without an X server, set DISPLAY to any
+  value and QT_QPA_PLATFORM=offscreen. Unless stdout is a terminal, the
+  NCurses UI runs headless.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define YUILogComponent "benchmark"
+#include <yui/YUILog.h>
+
+#include <yui/YUI.h>
+#include <yui/YUILoader.h>
+#include <yui/YUIPlugin.h>
+#include <yui/YStartupProfiler.h>
+#include <yui/YWidgetFactory.h>
+#include <yui/YDialog.h>
+#include <yui/YLayoutBox.h>
+
+// Give up waiting for the first paint after that many millisec
+#define PAINT_TIMEOUT 10000
+
+enum LoadMode { BIND_NOW, BIND_LAZY, PRELOAD };
+
+static const char *mode_name( LoadMode mode )
+{
+    switch ( mode )
+    {
+        case BIND_NOW:  return "RTLD_NOW";
+        case BIND_LAZY: return "RTLD_LAZY";
+        case PRELOAD:   return "preloaded";
+    }
+
+    return "?";
+}
+
+// Phase name -> durations of all runs in millisec
+typedef std::map<std::string, std::vector<double>> Durations;
+
+static double median( std::vector<double> values )
+{
+    if ( values.empty() )
+        return 0.0;
+
+    std::sort( values.begin(), values.end() );
+
+    return values[ values.size() / 2 ];
+}
+
+static void open_yes_no_popup()
+{
+    YWidgetFactory *factory = YUI::widgetFactory();
+    YDialog *dialog = factory->createPopupDialog();
+    YLayoutBox *vbox = factory->createVBox( dialog );
+    factory->createLabel( vbox, "Really abort the installation?" );
+
+    YLayoutBox *hbox = factory->createHBox( vbox );
+    factory->createPushButton( hbox, "&Yes" );
+    factory->createPushButton( hbox, "&No" );
+
+    dialog->open();
+}
+
+// Runs in the child process: Start the UI and write the phases as
+// "<duration>\t<name>" lines to 'fd'
+static int run_child( const char *backend, LoadMode mode, int work_ms, int fd )
+{
+    double start = YStartupProfiler::elapsed();
+
+    setenv( "YUI_PREFERED_BACKEND", backend, 1 );
+    YUILog::setLogFileName( "/dev/null" );
+    YStartupProfiler::setEnabled( true );
+    YUIPlugin::setLazyBinding( mode == BIND_LAZY );
+
+    if ( mode == PRELOAD )
+        YUILoader::preloadUI();
+
+    usleep( work_ms * 1000 );   // the application's own initialization
+
+    YUILoader::loadUI();
+    open_yes_no_popup();
+
+    while ( ! YStartupProfiler::firstDialogPainted() &&
+            YStartupProfiler::elapsed() - start < PAINT_TIMEOUT )
+    {
+        YDialog::currentDialog()->pollEvent();
+    }
+
+    double total = YStartupProfiler::elapsed() - start;
+    FILE *out = fdopen( fd, "w" );
+
+    for ( const YStartupProfiler::Phase &phase: YStartupProfiler::phases() )
+    {
+        if ( phase.name != "first dialog painted" )   // just a mark
+            fprintf( out, "%f\t%s\n", phase.duration, phase.name.c_str() );
+    }
+
+    if ( YStartupProfiler::firstDialogPainted() )
+        fprintf( out, "%f\t%s\n", total, "time to first dialog" );
+
+    fclose( out );
+    YDialog::deleteAllDialogs();
+
+    return 0;
+}
+
+// Runs one child process and adds its phases to 'durations'
+static bool run_once( const char *backend, LoadMode mode, int work_ms,
+                      Durations &durations, std::vector<std::string> &order )
+{
+    int pipe_fds[2];
+
+    if ( pipe( pipe_fds ) != 0 )
+        return false;
+
+    fflush( stdout );
+    pid_t pid = fork();
+
+    if ( pid == 0 )
+    {
+        close( pipe_fds[0] );
+        exit( run_child( backend, mode, work_ms, pipe_fds[1] ) );
+    }
+
+    close( pipe_fds[1] );
+
+    FILE *in = fdopen( pipe_fds[0], "r" );
+    double duration;
+    char name[256];
+    std::map<std::string, double> run;   // a phase may occur more than once
+
+    while ( fscanf( in, "%lf\t%255[^\n]\n", &duration, name ) == 2 )
+    {
+        if ( durations.find( name ) == durations.end() && run.find( name ) == run.end() )
+            order.push_back( name );
+
+        run[ name ] += duration;
+    }
+
+    fclose( in );
+
+    for ( const auto &phase: run )
+        durations[ phase.first ].push_back( phase.second );
+
+    bool painted = run.find( "time to first dialog" ) != run.end();
+
+    int status = 0;
+    waitpid( pid, &status, 0 );
+
+    return painted && WIFEXITED( status ) && WEXITSTATUS( status ) == 0;
+}
+
+static void bench( const char *backend, LoadMode mode, int runs, int work_ms )
+{
+    Durations durations;
+    std::vector<std::string> order;
+    int failed = 0;
+
+    for ( int i = 0; i < runs; ++i )
+    {
+        if ( ! run_once( backend, mode, work_ms, durations, order ) )
+            ++failed;
+    }
+
+    printf( "%s, %s:\n", backend, mode_name( mode ) );
+
+    for ( const std::string &name: order )
+        printf( "  %-36s %10.1f ms\n", name.c_str(), median( durations[ name ] ) );
+
+    if ( failed )
+        printf( "  %d of %d runs failed\n", failed, runs );
+}
+
+int main( int argc, char **argv )
+{
+    int runs    = argc > 1 ? atoi( argv[1] ) : 5;
+    int work_ms = argc > 2 ? atoi( argv[2] ) : 50;
+
+    if ( ! isatty( STDOUT_FILENO ) )
+        setenv( "Y2NCURSES_HEADLESS", "1", 1 );
+
+    printf( "runs: %d, application initialization: %d ms\n", runs, work_ms );
+
+    const char *backends[] = { YUIPlugin_Qt, YUIPlugin_NCurses };
+
+    for ( const char *backend: backends )
+    {
+        if ( ! YUILoader::pluginExists( backend ) )
+        {
+            printf( "%s: UI plug-in not installed\n", backend );
+            continue;
+        }
+
+        // The UI loader only picks the Qt UI if there is a display
+        if ( strcmp( backend, YUIPlugin_Qt ) == 0 && ! getenv( "DISPLAY" ) )
+        {
+            printf( "%s: skipped, DISPLAY is not set\n", backend );
+            continue;
+        }
+
+        for ( LoadMode mode: { BIND_NOW, BIND_LAZY, PRELOAD } )
+            bench( backend, mode, runs, work_ms );
+    }
+
+    return 0;
+}
@@ -196,6 +196,7 @@ YDialog::open()
     openInternal();	// Make sure this is only called once!
 
     priv->isOpen = true;
+    markChanged();
 }
 
 
@@ -356,6 +357,13 @@ void
 YDialog::recalcLayout()
 {
     yuiDebug() << "Recalculating layout for " << this << endl;
+    requestLayout();
+}
+
+
+void
+YDialog::requestLayout()
+{
     doLayout();
 }
 
@@ -406,6 +414,9 @@ YDialog::waitForEvent( int timeout_millisec )
     deleteEvent( priv->lastEvent );
     YEvent * event = 0;
 
+    // The application might have changed anything since the last event
+    markChanged();
+
     do
     {
 	event = filterInvalidEvents( waitForEventInternal( timeout_millisec ) );
@@ -432,6 +443,7 @@ YDialog::pollEvent()
     if ( ! isOpen() )
 	open();
 
+    markChanged();
     YEvent * event = filterInvalidEvents( pollEventInternal() );
 
     if ( event ) // Optimization (calling with 0 wouldn't hurt)
@@ -405,6 +405,15 @@ protected:
      **/
     void doLayout();
 
+    /**
+     * Request a new layout calculation. This is called by recalcLayout().
+     *
+     * This default implementation calculates the layout immediately.
+     * Derived classes can reimplement this to defer the calculation and to
+     * merge several requests into one; they have to call doLayout() later.
+     **/
+    virtual void requestLayout();
+
     /**
      * Wait for a user event.
      *
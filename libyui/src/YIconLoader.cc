@@ -24,6 +24,7 @@
 
 
 #include <sys/stat.h>
+#include <dirent.h>
 #include <sstream>
 
 #define YUILogComponent "ui"
@@ -38,6 +39,8 @@ using std::string;
 
 
 YIconLoader::YIconLoader()
+    : _cacheHits( 0 )
+    , _cacheMisses( 0 )
 {
     addIconSearchPath( FALLBACK_ICON_PATH );
 }
@@ -51,6 +54,7 @@ YIconLoader::~YIconLoader()
 void YIconLoader::setIconBasePath( string path )
 {
     _iconBasePath = path;
+    _foundIcons.clear();
 }
 
 
@@ -63,6 +67,7 @@ string YIconLoader::iconBasePath() const
 void YIconLoader::addIconSearchPath( string path )
 {
     _iconDirs.push_front( path );
+    _foundIcons.clear();
 }
 
 
@@ -77,16 +82,28 @@ string YIconLoader::findIcon( string name )
     if ( name[0] == '/' )
 	return name;
 
+    std::map<string, string>::const_iterator found = _foundIcons.find( name );
+
+    if ( found != _foundIcons.end() )
+    {
+        _cacheHits++;
+        return found->second;
+    }
+
+    _cacheMisses++;
+
+    string & result = _foundIcons[ name ];  // "" until found
     string fullPath;
 
     // Look in global search path
     if ( !_iconBasePath.empty () )
     {
 	fullPath = _iconBasePath + name;
-	if ( fileExists ( fullPath ) )
+	if ( fileExists ( _iconBasePath, name ) )
 	{
 	    // yuiMilestone() << "Found " << name << " in global search path" << endl;
-	    return fullPath;
+	    result = fullPath;
+	    return result;
 	}
     }
 
@@ -95,17 +112,22 @@ string YIconLoader::findIcon( string name )
 
     while ( listIt != _iconDirs.end() )
     {
+	string relativePath;
+
 	// Something like relative path
 	if ( name.find('/') != string::npos )
-	    fullPath = *listIt +  name;
+	    relativePath = name;
 	// No '/' chars, just the name -> use '22x22/apps' fallback
 	else
-	    fullPath = *listIt + "22x22/apps/" + name;
+	    relativePath = "22x22/apps/" + name;
+
+	fullPath = *listIt + relativePath;
 
-	if ( fileExists( fullPath ) )
+	if ( fileExists( *listIt, relativePath ) )
 	{
 	    // yuiMilestone() << "Found " << name << " in " <<  *listIt << " search path" << endl;
-	    return fullPath;
+	    result = fullPath;
+	    return result;
 	}
 
 	yuiDebug() <<  name << " not found in " << *listIt << " search path, skipping" << endl;
@@ -116,6 +138,13 @@ string YIconLoader::findIcon( string name )
 }
 
 
+void YIconLoader::clearCache()
+{
+    _foundIcons.clear();
+    _dirIndex.clear();
+}
+
+
 bool YIconLoader::fileExists( string fname )
 {
     struct stat fileInfo;
@@ -123,3 +152,96 @@ bool YIconLoader::fileExists( string fname )
 
     return ret == 0;
 }
+
+
+bool YIconLoader::fileExists( const string & dir, const string & relativePath )
+{
+    // The paths are simply concatenated, so only a directory ending with
+    // '/' can be indexed by the relative paths of its files
+    string path = indexPath( relativePath );
+
+    if ( dir.empty() || dir[ dir.size() - 1 ] != '/' || path.empty() )
+        return fileExists( dir + relativePath );
+
+    string subdir;
+    string fileName = path;
+    string::size_type slash = path.rfind( '/' );
+
+    if ( slash != string::npos )
+    {
+        subdir   = path.substr( 0, slash + 1 );
+        fileName = path.substr( slash + 1 );
+    }
+
+    const DirIndex & index = dirIndex( dir + subdir );
+
+    if ( index.readable && index.entries.find( fileName ) != index.entries.end() )
+        return true;
+
+    // Not in the index: It might have been added after reading the
+    // directory, or the directory is not readable
+    return fileExists( dir + relativePath );
+}
+
+
+const YIconLoader::DirIndex & YIconLoader::dirIndex( const string & dir )
+{
+    std::map<string, DirIndex>::iterator it = _dirIndex.find( dir );
+
+    if ( it != _dirIndex.end() )
+        return it->second;
+
+    DirIndex & index = _dirIndex[ dir ];
+    DIR * dirHandle = opendir( dir.c_str() );
+
+    if ( dirHandle )
+    {
+        index.readable = true;
+        struct dirent * entry;
+
+        while ( ( entry = readdir( dirHandle ) ) != 0 )
+        {
+            // Leave symlinks to stat(), they might be dangling
+            if ( entry->d_type != DT_LNK )
+                index.entries.insert( entry->d_name );
+        }
+
+        closedir( dirHandle );
+
+        yuiDebug() << "Indexed " << index.entries.size() << " entries in " << dir << endl;
+    }
+
+    return index;
+}
+
+
+string YIconLoader::indexPath( const string & relativePath )
+{
+    string path;
+    string::size_type start = 0;
+
+    while ( start <= relativePath.size() )
+    {
+        string::size_type end = relativePath.find( '/', start );
+
+        if ( end == string::npos )
+            end = relativePath.size();
+
+        string component = relativePath.substr( start, end - start );
+        start = end + 1;
+
+        if ( component.empty() || component == "." )
+            continue;
+
+        // Resolving ".." depends on symlinks, leave that to stat()
+        if ( component == ".." )
+            return "";
+
+        if ( ! path.empty() )
+            path += '/';
+
+        path += component;
+    }
+
+    return path;
+}
@@ -28,6 +28,8 @@
 
 #include <string>
 #include <list>
+#include <map>
+#include <set>
 
 class YIconLoader
 {
@@ -36,8 +38,25 @@ public:
     YIconLoader();
     ~YIconLoader();
 
+    /**
+     * Return the full path of icon 'name' or an empty string if there is
+     * none.
+     *
+     * The results (also the empty ones) are cached, so repeated lookups do
+     * not access the file system. The directories that contain the looked
+     * up icons are read once, so looking up more icons in the same
+     * directory does not need a stat() for each one unless the icon is not
+     * there. Icons installed after a lookup are not found until
+     * clearCache() is called.
+     **/
     std::string findIcon( std::string name );
 
+    /**
+     * Forget all cached lookup results and directory contents, e.g. after
+     * icons were installed or removed.
+     **/
+    void clearCache();
+
     // FIXME: these two are here for compatibility reasons.
     // Deprecate them in due course and treat base path just
     // like any other search path
@@ -46,12 +65,53 @@ public:
 
     void addIconSearchPath( std::string path );
 
+    /**
+     * Return the number of findIcon() calls answered from the cache
+     * and the number of the ones that searched the directories.
+     **/
+    int cacheHits()   const { return _cacheHits;   }
+    int cacheMisses() const { return _cacheMisses; }
+
 private:
 
+    /**
+     * The entries of one directory (not recursive)
+     **/
+    struct DirIndex
+    {
+        DirIndex(): readable( false ) {}
+
+        bool                    readable;
+        std::set<std::string>   entries;    // file and directory names
+    };
+
     std::string                 _iconBasePath;
     std::list <std::string>	_iconDirs;
 
+    std::map<std::string, std::string>  _foundIcons;  // name -> path or ""
+    std::map<std::string, DirIndex>     _dirIndex;    // dir -> entries
+    int                                 _cacheHits;
+    int                                 _cacheMisses;
+
     bool fileExists( std::string fname );
+
+    /**
+     * Return 'true' if 'relativePath' exists in directory 'dir', from the
+     * index of the directory that contains it if possible.
+     **/
+    bool fileExists( const std::string & dir, const std::string & relativePath );
+
+    /**
+     * Return 'relativePath' in the form used in the directory index:
+     * Without "./" components and duplicate slashes. Return an empty
+     * string if it can't be looked up in the index (e.g. with "..").
+     **/
+    static std::string indexPath( const std::string & relativePath );
+
+    /**
+     * Return the index of directory 'dir', read it if necessary.
+     **/
+    const DirIndex & dirIndex( const std::string & dir );
 };
 
 #endif
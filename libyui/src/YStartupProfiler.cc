@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:		YStartupProfiler.cc
+
+/-*/
+
+
+#include <stdlib.h>	// getenv()
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+
+#define YUILogComponent "ui"
+#include "YUILog.h"
+
+#include "YStartupProfiler.h"
+
+using std::string;
+using std::vector;
+
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // Initialized when libyui is loaded
+    const Clock::time_point loadTime = Clock::now();
+
+    std::mutex				phasesMutex;
+    vector<YStartupProfiler::Phase>	recordedPhases;
+
+    bool profileEnv()
+    {
+	const char * env = getenv( "YUI_STARTUP_PROFILE" );
+	return env && *env;
+    }
+}
+
+
+std::atomic<bool> YStartupProfiler::_enabled( profileEnv() );
+std::atomic<bool> YStartupProfiler::_dialogPainted( false );
+
+
+double
+YStartupProfiler::elapsed()
+{
+    std::chrono::duration<double, std::milli> sinceLoad = Clock::now() - loadTime;
+
+    return sinceLoad.count();
+}
+
+
+void
+YStartupProfiler::addPhase( const string & name, double start )
+{
+    Phase phase;
+    phase.name	   = name;
+    phase.start	   = start;
+    phase.duration = elapsed() - start;
+
+    std::lock_guard<std::mutex> lock( phasesMutex );
+    recordedPhases.push_back( phase );
+}
+
+
+vector<YStartupProfiler::Phase>
+YStartupProfiler::phases()
+{
+    std::lock_guard<std::mutex> lock( phasesMutex );
+
+    return recordedPhases;
+}
+
+
+void
+YStartupProfiler::recordFirstDialog()
+{
+    // Another thread might have been first
+    if ( _dialogPainted.exchange( true ) )
+	return;
+
+    addPhase( "first dialog painted", elapsed() );
+    logReport();
+}
+
+
+void
+YStartupProfiler::logReport()
+{
+    vector<Phase> report = phases();
+
+    yuiMilestone() << "Startup profile (millisec since libyui was loaded):" << endl;
+
+    for ( const Phase & phase: report )
+    {
+	yuiMilestone() << std::fixed << std::setprecision( 1 )
+		       << std::setw( 9 ) << phase.start	   << " + "
+		       << std::setw( 8 ) << phase.duration << "  "
+		       << phase.name << endl;
+    }
+}
+
+
+YStartupPhase::YStartupPhase( const char * name )
+    : _start( 0.0 )
+    , _enabled( YStartupProfiler::enabled() )
+{
+    if ( _enabled )
+    {
+	_name  = name;
+	_start = YStartupProfiler::elapsed();
+    }
+}
+
+
+YStartupPhase::YStartupPhase( const char * name, const string & detail )
+    : _start( 0.0 )
+    , _enabled( YStartupProfiler::enabled() )
+{
+    if ( _enabled )
+    {
+	_name  = string( name ) + " " + detail;
+	_start = YStartupProfiler::elapsed();
+    }
+}
+
+
+YStartupPhase::~YStartupPhase()
+{
+    if ( _enabled )
+	YStartupProfiler::addPhase( _name, _start );
+}
@@ -0,0 +1,155 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+
+/*-/
+
+  File:		YStartupProfiler.h
+
+/-*/
+
+
+#ifndef YStartupProfiler_h
+#define YStartupProfiler_h
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+
+/**
+ * Records where the time goes while the UI starts up: Finding and loading
+ * the UI plug-in, constructing the UI and painting the first dialog.
+ *
+ * This is enabled with the environment variable YUI_STARTUP_PROFILE or with
+ * setEnabled(). All times are in milliseconds since libyui was loaded. When
+ * the first dialog has been painted, all phases are written to the log.
+ *
+ * When it is not enabled, recording a phase costs no more than checking a
+ * flag.
+ **/
+class YStartupProfiler
+{
+public:
+
+    /**
+     * One phase of the startup.
+     **/
+    struct Phase
+    {
+	std::string	name;
+	double		start;		// millisec since libyui was loaded
+	double		duration;	// millisec
+    };
+
+    /**
+     * Return 'true' if the startup phases are recorded.
+     **/
+    static bool enabled() { return _enabled; }
+
+    /**
+     * Enable or disable recording the startup phases. This overrides the
+     * environment variable YUI_STARTUP_PROFILE.
+     **/
+    static void setEnabled( bool enabled ) { _enabled = enabled; }
+
+    /**
+     * Return the time in milliseconds since libyui was loaded.
+     **/
+    static double elapsed();
+
+    /**
+     * Record phase 'name' that started at 'start' (see elapsed()) and has
+     * just finished.
+     *
+     * This may be called from any thread.
+     **/
+    static void addPhase( const std::string & name, double start );
+
+    /**
+     * Notification from the concrete UI that a dialog has been painted.
+     * Only the first call records anything and writes the report to the log.
+     **/
+    static void dialogPainted()
+	{ if ( _enabled && ! _dialogPainted ) recordFirstDialog(); }
+
+    /**
+     * Return 'true' if the first dialog has been painted since the
+     * profiler was enabled.
+     **/
+    static bool firstDialogPainted() { return _dialogPainted; }
+
+    /**
+     * Return a copy of the phases recorded so far in the order they
+     * finished.
+     **/
+    static std::vector<Phase> phases();
+
+    /**
+     * Write the phases recorded so far to the log.
+     **/
+    static void logReport();
+
+private:
+
+    static void recordFirstDialog();
+
+    static std::atomic<bool> _enabled;
+    static std::atomic<bool> _dialogPainted;
+};
+
+
+/**
+ * Helper class to record a phase for YStartupProfiler from the constructor
+ * to the destructor, i.e. for the current scope:
+ *
+ *     {
+ *         YStartupPhase phase( "dlopen" );
+ *         ...
+ *     }
+ **/
+class YStartupPhase
+{
+public:
+
+    /**
+     * Constructor: Start phase 'name' if the profiler is enabled.
+     **/
+    YStartupPhase( const char * name );
+
+    /**
+     * Constructor: Start phase 'name' with a detail, e.g. the plug-in name,
+     * if the profiler is enabled.
+     **/
+    YStartupPhase( const char * name, const std::string & detail );
+
+    /**
+     * Destructor: Record the phase.
+     **/
+    ~YStartupPhase();
+
+private:
+
+    // Disable copying
+    YStartupPhase( const YStartupPhase & );
+    YStartupPhase & operator=( const YStartupPhase & );
+
+    std::string	_name;
+    double	_start;
+    bool	_enabled;
+};
+
+
+#endif // YStartupProfiler_h
@@ -44,6 +44,7 @@ struct YTablePrivate
     YTableHeader *	header;
     bool		keepSorting;
     bool		immediateMode;
+    string		filter;
 };
 
 
@@ -128,6 +129,20 @@ YTable::setImmediateMode( bool immediateMode )
 }
 
 
+string
+YTable::filter() const
+{
+    return priv->filter;
+}
+
+
+void
+YTable::setFilter( const string & filter )
+{
+    priv->filter = filter;
+}
+
+
 bool
 YTable::keepSorting() const
 {
@@ -194,6 +209,7 @@ YTable::propertySet()
 	 * @property string	Item		QueryWidget only: Return one complete item
 	 * @property string	IconPath	Base path for icons
 	 * @property bool	MultiSelection	Flag: User can select multiple items (read-only)
+	 * @property string	Filter		Show only items containing this text
          *
 	 * @property map<ItemID, string> OpenItems 	Map of IDs of all open items (read-only)
          *                                              to either "ID" or "Text":
@@ -207,6 +223,7 @@ YTable::propertySet()
 	propSet.add( YProperty( YUIProperty_Cell,		YOtherProperty	 ) );
 	propSet.add( YProperty( YUIProperty_Item,		YOtherProperty	 ) );
 	propSet.add( YProperty( YUIProperty_IconPath,		YStringProperty	 ) );
+	propSet.add( YProperty( YUIProperty_Filter,		YStringProperty	 ) );
 	propSet.add( YProperty( YUIProperty_MultiSelection,	YBoolProperty,   true ) ); // read-only
 	propSet.add( YProperty( YUIProperty_OpenItems,		YOtherProperty,  true ) ); // read-only
 	propSet.add( YWidget::propertySet() );
@@ -228,6 +245,7 @@ YTable::setProperty( const string & propertyName, const YPropertyValue & val )
     else if ( propertyName == YUIProperty_Cell		)	return false; // Needs special handling
     else if ( propertyName == YUIProperty_Item 		)	return false; // Needs special handling
     else if ( propertyName == YUIProperty_IconPath 	)	setIconBasePath( val.stringVal() );
+    else if ( propertyName == YUIProperty_Filter 	)	setFilter( val.stringVal() );
     else
     {
 	return YWidget::setProperty( propertyName, val );
@@ -249,6 +267,7 @@ YTable::getProperty( const string & propertyName )
     else if ( propertyName == YUIProperty_Cell		)	return YPropertyValue( YOtherProperty );
     else if ( propertyName == YUIProperty_Item 		)	return YPropertyValue( YOtherProperty );
     else if ( propertyName == YUIProperty_IconPath	)	return YPropertyValue( iconBasePath() );
+    else if ( propertyName == YUIProperty_Filter	)	return YPropertyValue( filter() );
     else if ( propertyName == YUIProperty_MultiSelection )      return YPropertyValue( hasMultiSelection() );
     else if ( propertyName == YUIProperty_OpenItems 	)	return YPropertyValue( YOtherProperty );
     else
@@ -141,6 +141,24 @@ public:
      **/
     virtual void setKeepSorting( bool keepSorting );
 
+    /**
+     * Return the current filter string. See setFilter().
+     **/
+    std::string filter() const;
+
+    /**
+     * Set a filter string: Only items that contain it in any of their cells
+     * (ignoring case) are displayed. An empty filter displays all items.
+     * The filter does not change the items or their selection state.
+     *
+     * UIs that support filtering send a widget event with reason
+     * FilterChanged if notify() is set and the user changed the filter.
+     *
+     * Derived classes can overwrite this function, but they should call this
+     * base class function in the new implementation.
+     **/
+    virtual void setFilter( const std::string & filter );
+
     /**
      * Return 'true' if the user can select multiple items  at the same time
      * (e.g., with shift-click or ctrl-click).
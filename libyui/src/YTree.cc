@@ -42,6 +42,7 @@ struct YTreePrivate
 	{}
 
     bool immediateMode;
+    string filter;
 };
 
 
@@ -84,6 +85,20 @@ YTree::setImmediateMode( bool immediateMode )
 }
 
 
+string
+YTree::filter() const
+{
+    return priv->filter;
+}
+
+
+void
+YTree::setFilter( const string & filter )
+{
+    priv->filter = filter;
+}
+
+
 void
 YTree::addItems( const YItemCollection & itemCollection )
 {
@@ -106,6 +121,7 @@ YTree::propertySet()
 	 * @property itemList		Items		All items
 	 * @property string             Label		Caption above the tree
 	 * @property string             IconPath	Base path for icons
+	 * @property string             Filter		Show only items containing this text
          * @property bool               MultiSelection  Flag: User can select multiple items (read-only)
          *
 	 * @property map<ItemID, string> OpenItems 	Map of IDs of all open items (read-only)
@@ -119,6 +135,7 @@ YTree::propertySet()
 	propSet.add( YProperty( YUIProperty_Items,		YOtherProperty	 ) );
 	propSet.add( YProperty( YUIProperty_Label,		YStringProperty	 ) );
 	propSet.add( YProperty( YUIProperty_IconPath,		YStringProperty	 ) );
+	propSet.add( YProperty( YUIProperty_Filter,		YStringProperty	 ) );
         propSet.add( YProperty( YUIProperty_SelectedItems,      YOtherProperty   ) );
         propSet.add( YProperty( YUIProperty_MultiSelection,     YBoolProperty,   true ) ); // read-only
 	propSet.add( YProperty( YUIProperty_OpenItems,		YOtherProperty,	 true ) ); // read-only
@@ -141,6 +158,7 @@ YTree::setProperty( const string & propertyName, const YPropertyValue & val )
     else if ( propertyName == YUIProperty_SelectedItems )       return false; // Needs special handling
     else if ( propertyName == YUIProperty_Label		)	setLabel( val.stringVal() );
     else if ( propertyName == YUIProperty_IconPath 	)	setIconBasePath( val.stringVal() );
+    else if ( propertyName == YUIProperty_Filter 	)	setFilter( val.stringVal() );
 
     else
     {
@@ -162,6 +180,7 @@ YTree::getProperty( const string & propertyName )
     else if ( propertyName == YUIProperty_Items 	)	return YPropertyValue( YOtherProperty );
     else if ( propertyName == YUIProperty_Label		)	return YPropertyValue( label() );
     else if ( propertyName == YUIProperty_IconPath	)	return YPropertyValue( iconBasePath() );
+    else if ( propertyName == YUIProperty_Filter	)	return YPropertyValue( filter() );
     else if ( propertyName == YUIProperty_SelectedItems )       return YPropertyValue( YOtherProperty );
     else if ( propertyName == YUIProperty_MultiSelection )      return YPropertyValue( hasMultiSelection() );
     else if ( propertyName == YUIProperty_OpenItems 	)	return YPropertyValue( YOtherProperty );
@@ -126,6 +126,24 @@ public:
      **/
     void setImmediateMode( bool on = true );
 
+    /**
+     * Return the current filter string. See setFilter().
+     **/
+    std::string filter() const;
+
+    /**
+     * Set a filter string: Only items that contain it (ignoring case) and
+     * their parent items are displayed. An empty filter displays all items.
+     * The filter does not change the items or their selection state.
+     *
+     * UIs that support filtering send a widget event with reason
+     * FilterChanged if notify() is set and the user changed the filter.
+     *
+     * Derived classes can overwrite this function, but they should call this
+     * base class function in the new implementation.
+     **/
+    virtual void setFilter( const std::string & filter );
+
     /**
      * Set a property.
      * Reimplemented from YWidget.
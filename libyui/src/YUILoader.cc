@@ -26,6 +26,8 @@
 #include <unistd.h>		// isatty()a
 #include <sys/stat.h>
 #include <string.h>
+#include <errno.h>
+#include <pthread.h>
 
 #define YUILogComponent "ui"
 #include "YUILog.h"
@@ -35,6 +37,7 @@
 #include "YUIException.h"
 #include "YPath.h"
 #include "YSettings.h"
+#include "YStartupProfiler.h"
 
 #include "Libyui_config.h"
 
@@ -44,12 +47,162 @@ using std::string;
 bool rest_enabled()
 {
     const char *env = getenv("YUI_HTTP_PORT");
-    return env && atoi(env) > 0;
+    const char *socket = getenv("YUI_HTTP_SOCKET");
+    return ( env && atoi(env) > 0 ) || ( socket && *socket );
+}
+
+
+bool ncurses_headless()
+{
+    // The NCurses UI can run without a terminal (see NCHeadless)
+    const char *env = getenv("Y2NCURSES_HEADLESS");
+    return env && *env;
+}
+
+
+bool have_terminal()
+{
+    return isatty( STDOUT_FILENO ) || ncurses_headless();
+}
+
+
+namespace
+{
+    pthread_t	preloadThread;
+    bool	preloadThreadRunning = false;
+    bool	pluginSelected       = false;	// by preloadUI()
+    string	preloadedPluginName;
+    bool	preloadRestAPI       = false;
+
+
+    void * preload_plugin( void * )
+    {
+	// Only the side effect counts: The libraries stay loaded.
+	// Same order as in YUILoader::loadRestAPIPlugin().
+
+	if ( preloadRestAPI )
+	{
+	    YUIPlugin restPlugin( YUIPlugin_RestAPI );
+	}
+
+	YUIPlugin plugin( preloadedPluginName.c_str() );
+
+	if ( preloadRestAPI )
+	{
+	    YUIPlugin uiRestPlugin( preloadedPluginName == YUIPlugin_Qt ?
+				    YUIPlugin_Qt_RestAPI : YUIPlugin_Ncurses_RestAPI );
+	}
+
+	return 0;
+    }
+}
+
+
+void YUILoader::preloadUI()
+{
+    if ( preloadThreadRunning || pluginSelected || YUI::_ui )
+	return;
+
+    // loadUI() uses this selection, so it is done (and logged) only once
+    preloadedPluginName = selectPlugin();
+    pluginSelected      = true;
+
+    if ( preloadedPluginName.empty() )
+	return;
+
+    // Like loadUI() and loadPlugin(): With the REST API, the UI is loaded
+    // together with its REST API plugin
+    preloadRestAPI = rest_enabled() &&
+	( preloadedPluginName == YUIPlugin_Qt || preloadedPluginName == YUIPlugin_NCurses );
+
+    yuiMilestone() << "Preloading UI-plugin: \"" << preloadedPluginName << "\""
+		   << ( preloadRestAPI ? " with the REST API" : "" ) << endl;
+
+    if ( pthread_create( &preloadThread, 0, preload_plugin, 0 ) == 0 )
+	preloadThreadRunning = true;
+    else
+	yuiError() << "pthread_create() failed: " << errno << " " << strerror( errno ) << endl;
+}
+
+
+void YUILoader::waitForPreload()
+{
+    if ( preloadThreadRunning )
+    {
+	YStartupPhase phase( "wait for preloaded plugin", preloadedPluginName );
+
+	pthread_join( preloadThread, 0 );
+	preloadThreadRunning = false;
+    }
 }
 
 
 void YUILoader::loadUI( bool withThreads )
 {
+    waitForPreload();
+
+    string wantedGUI = pluginSelected ? preloadedPluginName : selectPlugin();
+
+    // Load the wanted UI-plugin.
+    if ( wantedGUI != "" )
+    {
+	yuiMilestone () << "Using UI-plugin: \"" << wantedGUI << "\""<< endl;
+	YSettings::loadedUI( wantedGUI, true );
+
+	try
+	{
+            // Load integration testing framework plugin, which load required UI
+            // There is no support for GTK planned, so not loading rest api
+            // plugin in case gtk was requested
+            if ( rest_enabled() && wantedGUI != YUIPlugin_Gtk )
+            {
+                loadRestAPIPlugin( wantedGUI, withThreads );
+            }
+            else
+            {
+                loadPlugin( wantedGUI, withThreads );
+            }
+
+	    return;
+	}
+
+	catch ( YUIException & ex )
+	{
+	    YUI_CAUGHT( ex );
+
+	    // Default to NCurses, if possible.
+	    if ( wantedGUI != YUIPlugin_NCurses && pluginExists( YUIPlugin_NCurses ) && have_terminal() )
+	    {
+		yuiWarning () << "Defaulting to: \"" << YUIPlugin_NCurses << "\""<< endl;
+		YSettings::loadedUI( YUIPlugin_NCurses, true );
+
+		try
+		{
+		    loadPlugin( YUIPlugin_NCurses, withThreads );
+		    return;
+		}
+
+		catch ( YUIException & ex )
+		{
+		    YUI_CAUGHT( ex );
+		}
+	    }
+
+	    YUI_RETHROW( ex ); // what else to do here?
+	}
+    }
+
+    else
+    {
+	YUI_THROW( YUICantLoadAnyUIException() );
+    }
+}
+
+
+string YUILoader::selectPlugin()
+{
+    YStartupPhase phase( "plugin discovery" );
+
     bool isGtk = false;
     const char * envDesktop    = getenv( "XDG_CURRENT_DESKTOP" )  ?: "";
     const char * envDisplay    = getenv( "DISPLAY" )              ?: "";
@@ -99,13 +252,15 @@ void YUILoader::loadUI( bool withThreads )
     bool haveNcurses = pluginExists( YUIPlugin_NCurses );
     bool haveQt      = pluginExists( YUIPlugin_Qt );
 
+    bool haveTerminal = have_terminal();
+
     // This reset is intentional, so the loader can work it's magic
     // selecting an UI-plugin as described in the documentation.
     wantedGUI="";
 
     // Set the UI-Plugin
     if ( ( haveGtk || haveQt ) && strcmp ( envDisplay, "" ) &&
-	 ( !wantNcurses || !isatty( STDOUT_FILENO ) ) )
+	 ( !wantNcurses || !haveTerminal ) )
     {
 	// Qt is default if available.
 	if ( haveQt )
@@ -116,70 +271,20 @@ void YUILoader::loadUI( bool withThreads )
 	    wantedGUI = YUIPlugin_Gtk;
     }
 
-    else if ( haveNcurses && isatty( STDOUT_FILENO ) )
+    else if ( haveNcurses && haveTerminal )
     {
 	// We use NCurses.
 	wantedGUI = YUIPlugin_NCurses;
     }
 
-    // Load the wanted UI-plugin.
-    if ( wantedGUI != "" )
-    {
-	yuiMilestone () << "Using UI-plugin: \"" << wantedGUI << "\""<< endl;
-	YSettings::loadedUI( wantedGUI, true );
-
-	try
-	{
-            // Load integration testing framework plugin, which load required UI
-            // There is no support for GTK planned, so not loading rest api
-            // plugin in case gtk was requested
-            if ( rest_enabled() && wantedGUI != YUIPlugin_Gtk )
-            {
-                loadRestAPIPlugin( wantedGUI, withThreads );
-            }
-            else
-            {
-                loadPlugin( wantedGUI, withThreads );
-            }
-
-	    return;
-	}
-
-	catch ( YUIException & ex )
-	{
-	    YUI_CAUGHT( ex );
-
-	    // Default to NCurses, if possible.
-	    if ( wantedGUI != YUIPlugin_NCurses && haveNcurses && isatty( STDOUT_FILENO ) )
-	    {
-		yuiWarning () << "Defaulting to: \"" << YUIPlugin_NCurses << "\""<< endl;
-		YSettings::loadedUI( YUIPlugin_NCurses, true );
-
-		try
-		{
-		    loadPlugin( YUIPlugin_NCurses, withThreads );
-		    return;
-		}
-
-		catch ( YUIException & ex )
-		{
-		    YUI_CAUGHT( ex );
-		}
-	    }
-
-	    YUI_RETHROW( ex ); // what else to do here?
-	}
-    }
-
-    else
-    {
-	YUI_THROW( YUICantLoadAnyUIException() );
-    }
+    return wantedGUI;
 }
 
 
 void YUILoader::loadRestAPIPlugin( const string & wantedGUI, bool withThreads )
 {
+    waitForPreload();
+
     // Do not try to load if variable is not set
     yuiMilestone () << "Requested to start http server to control UI." << endl;
 
@@ -217,6 +322,7 @@ void YUILoader::loadRestAPIPlugin( const string & wantedGUI, bool withThreads )
 
         if ( createUI )
         {
+            YStartupPhase phase( "createUI", wantedGUI );
             YUI * ui = createUI( withThreads );
             // Same as in loadPlugin
             atexit(deleteUI);
@@ -243,6 +349,8 @@ void YUILoader::deleteUI()
 
 void YUILoader::loadPlugin( const string & name, bool withThreads )
 {
+    waitForPreload();
+
     if (rest_enabled() && (name == YUIPlugin_NCurses || name == YUIPlugin_Qt))
     {
         loadRestAPIPlugin(name, withThreads);
@@ -257,6 +365,7 @@ void YUILoader::loadPlugin( const string & name, bool withThreads )
 
 	if ( createUI )
 	{
+	    YStartupPhase phase( "createUI", name );
 	    YUI * ui = createUI( withThreads ); // no threads
 
             // At this point the concrete UI will have loaded its own
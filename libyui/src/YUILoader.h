@@ -91,6 +91,23 @@ public:
      **/
     static void loadUI( bool withThreads = false );
 
+    /**
+     * Start loading the UI-plugin that loadUI() will choose in a separate
+     * thread and return immediately.
+     *
+     * Loading the plugin library and the libraries it depends on (for the Qt
+     * UI, the Qt libraries) takes a considerable part of the startup time of
+     * a program. A program can call this as early as possible, e.g. at the
+     * start of main(), so this happens while it does its own initialization.
+     * loadUI() then waits for it to finish and uses the library that is
+     * already loaded. It also uses the plugin selected here instead of
+     * selecting one again. If the REST API is enabled, its plugins are
+     * preloaded as well.
+     *
+     * This does nothing if the UI is already loaded.
+     **/
+    static void preloadUI();
+
     /**
      * This will make sure the UI singleton is deleted.
      * If the UI is already destroyed, it will do nothing. If
@@ -141,6 +158,17 @@ private:
     YUILoader()  {}
     ~YUILoader() {}
 
+    /**
+     * Return the name of the UI-plugin to load according to the criteria
+     * described at loadUI() or an empty string if there is none.
+     **/
+    static std::string selectPlugin();
+
+    /**
+     * Wait until the plugin started by preloadUI() is loaded.
+     **/
+    static void waitForPreload();
+
     /**
      * Used by loadExternalWidgets to load the graphical plugin specialization.
      *
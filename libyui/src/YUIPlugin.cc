@@ -23,6 +23,7 @@
 /-*/
 
 
+#include <stdlib.h>	// getenv()
 #include <dlfcn.h>
 
 #define YUILogComponent "ui"
@@ -30,21 +31,25 @@
 
 #include "YUIPlugin.h"
 #include "YPath.h"
+#include "YStartupProfiler.h"
 
 #include "Libyui_config.h"
 
 using std::string;
 
 
+bool YUIPlugin::_lazyBinding = getenv( "YUI_LAZY_PLUGIN_BINDING" ) != 0;
+
 
 YUIPlugin::YUIPlugin( const char * pluginLibBaseName )
 {
     _pluginLibBaseName = string( pluginLibBaseName );
 
     string pluginFilename = pluginLibFullPath();
+    YStartupPhase phase( "dlopen", _pluginLibBaseName );
 
     _pluginLibHandle = dlopen( pluginFilename.c_str(),
-			       RTLD_NOW | RTLD_GLOBAL);
+			       ( _lazyBinding ? RTLD_LAZY : RTLD_NOW ) | RTLD_GLOBAL );
 
     if ( ! _pluginLibHandle )
     {
@@ -83,6 +83,29 @@ public:
      **/
     std::string errorMsg() const;
 
+    /**
+     * Return 'true' if the plugin libraries are loaded with lazy binding.
+     **/
+    static bool lazyBinding() { return _lazyBinding; }
+
+    /**
+     * Load the plugin libraries with lazy binding (RTLD_LAZY) or resolve
+     * all their symbols right away (RTLD_NOW, the default) in the
+     * constructor. The default can be changed with the environment variable
+     * YUI_LAZY_PLUGIN_BINDING.
+     *
+     * Lazy binding makes loading a big plugin like the Qt UI faster, in
+     * particular for short-lived programs that only use a few of its
+     * functions. The downside is that an undefined symbol is no longer
+     * reported when loading the plugin, so there is no fallback to another
+     * UI: The program is terminated when it calls that function. Libraries
+     * linked with "-z now" and LD_BIND_NOW in the environment still resolve
+     * all symbols right away.
+     *
+     * This affects only plugins that are loaded after this call.
+     **/
+    static void setLazyBinding( bool lazy ) { _lazyBinding = lazy; }
+
 protected:
 
     /**
@@ -105,6 +128,8 @@ private:
     std::string	_pluginLibBaseName;
     void * 	_pluginLibHandle;
     std::string	_errorMsg;
+
+    static bool	_lazyBinding;
 };
 
 
@@ -177,6 +177,7 @@
 #define YUIProperty_EnabledItems		"EnabledItems"
 #define YUIProperty_ExpectedSize		"ExpectedSize"
 #define YUIProperty_Filename			"Filename"
+#define YUIProperty_Filter			"Filter"
 #define YUIProperty_Layout			"Layout"
 #define YUIProperty_HelpText			"HelpText"
 #define YUIProperty_IconPath			"IconPath"
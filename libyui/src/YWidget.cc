@@ -24,6 +24,7 @@
 
 
 #include <signal.h>
+#include <atomic>
 #include <iostream>
 #include <sstream>
 
@@ -70,6 +71,7 @@ struct YWidgetPrivate
 	, toolkitWidgetRep( 0 )
 	, id( 0 )
 	, functionKey( 0 )
+	, serial( 0 )
     {
 	stretch.hor	= false;
 	stretch.vert	= false;
@@ -95,6 +97,7 @@ struct YWidgetPrivate
     YBothDim<int>		weight;
     int				functionKey;
     string			helpText;
+    unsigned long long		serial;
 };
 
 
@@ -102,6 +105,9 @@ struct YWidgetPrivate
 
 bool YWidget::_usedOperatorNew = false;
 
+static std::atomic<unsigned long long> changeRevisionCounter( 0 );
+static std::atomic<unsigned long long> serialCounter( 0 );
+
 
 YWidget::YWidget( YWidget * parent )
     : _magic( YWIDGET_MAGIC )
@@ -121,9 +127,12 @@ YWidget::YWidget( YWidget * parent )
     }
 
     _usedOperatorNew = false;
+    priv->serial = serialCounter.fetch_add( 1, std::memory_order_relaxed ) + 1;
 
     if ( parent )
 	parent->addChild( this );
+
+    markChanged();
 }
 
 
@@ -158,6 +167,7 @@ YWidget::~YWidget()
 	delete priv->id;
 
     invalidate();
+    markChanged();
 }
 
 
@@ -488,6 +498,27 @@ YWidget::getProperty( const string & propertyName )
 }
 
 
+unsigned long long
+YWidget::changeRevision()
+{
+    return changeRevisionCounter.load( std::memory_order_acquire );
+}
+
+
+void
+YWidget::markChanged()
+{
+    changeRevisionCounter.fetch_add( 1, std::memory_order_acq_rel );
+}
+
+
+unsigned long long
+YWidget::serial() const
+{
+    return priv->serial;
+}
+
+
 void *
 YWidget::widgetRep() const
 {
@@ -160,6 +160,36 @@ public:
      **/
     virtual YPropertyValue getProperty( const std::string & propertyName );
 
+    /**
+     * Return the current change revision of the widget trees.
+     *
+     * This is a global counter which is incremented whenever a widget is
+     * created or destroyed, whenever a dialog starts waiting for user input
+     * (the application might have changed any widget property before) and
+     * whenever markChanged() is called. Clients which cache information
+     * about the widgets can compare it to cheaply find out whether their
+     * cache is still valid.
+     *
+     * This can be called from any thread.
+     **/
+    static unsigned long long changeRevision();
+
+    /**
+     * Increment the change revision. Call this when widgets might have
+     * changed while the application is not involved, e.g. after user input
+     * or after a widget has been changed remotely.
+     **/
+    static void markChanged();
+
+    /**
+     * Return a number that identifies this widget. Unlike the address of the
+     * widget, it is never reused for another widget: Clients can use it to
+     * find out whether a widget was replaced by a new one.
+     *
+     * This can be called from any thread.
+     **/
+    unsigned long long serial() const;
+
 
     //
     // Children Management
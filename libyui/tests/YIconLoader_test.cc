@@ -0,0 +1,122 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for the YIconLoader class
+
+#define BOOST_TEST_MODULE YIconLoader_tests
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "YIconLoader.h"
+
+using std::string;
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// a temporary icon directory, removed after each test
+struct IconDir {
+    IconDir()
+    {
+        char tmpl[] = "/tmp/YIconLoader_test.XXXXXX";
+        dir = mkdtemp( tmpl );
+        dir += "/";
+
+        mkdir( ( dir + "22x22" ).c_str(), 0755 );
+        mkdir( ( dir + "22x22/apps" ).c_str(), 0755 );
+        mkdir( ( dir + "sub" ).c_str(), 0755 );
+
+        addFile( "22x22/apps/foo.png" );
+        addFile( "sub/bar.png" );
+    }
+
+    ~IconDir()
+    {
+        string cmd = "rm -rf '" + dir + "'";
+        BOOST_CHECK_EQUAL( system( cmd.c_str() ), 0 );
+    }
+
+    void addFile( const string & relativePath )
+    {
+        std::ofstream file( dir + relativePath );
+    }
+
+    string dir;
+};
+
+BOOST_FIXTURE_TEST_CASE( find_icon, IconDir )
+{
+    YIconLoader loader;
+    loader.addIconSearchPath( dir );
+
+    // the 22x22/apps fallback and the default extension
+    BOOST_CHECK_EQUAL( loader.findIcon( "foo" ), dir + "22x22/apps/foo.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "sub/bar.png" ), dir + "sub/bar.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "missing" ), "" );
+
+    // absolute paths are returned as they are
+    BOOST_CHECK_EQUAL( loader.findIcon( "/no/such/icon.png" ), "/no/such/icon.png" );
+}
+
+BOOST_FIXTURE_TEST_CASE( unusual_relative_paths, IconDir )
+{
+    YIconLoader loader;
+    loader.addIconSearchPath( dir );
+
+    BOOST_CHECK_EQUAL( loader.findIcon( "./sub/bar.png" ), dir + "./sub/bar.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "sub//bar.png" ), dir + "sub//bar.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "sub/./bar.png" ), dir + "sub/./bar.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "22x22/../sub/bar.png" ), dir + "22x22/../sub/bar.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "sub/../sub/missing.png" ), "" );
+}
+
+BOOST_FIXTURE_TEST_CASE( cache, IconDir )
+{
+    YIconLoader loader;
+    loader.addIconSearchPath( dir );
+
+    BOOST_CHECK_EQUAL( loader.findIcon( "foo" ), dir + "22x22/apps/foo.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "foo" ), dir + "22x22/apps/foo.png" );
+    BOOST_CHECK_EQUAL( loader.cacheHits(), 1 );
+    BOOST_CHECK_EQUAL( loader.cacheMisses(), 1 );
+
+    // icons installed later are found only after clearing the cache
+    BOOST_CHECK_EQUAL( loader.findIcon( "new" ), "" );
+    addFile( "22x22/apps/new.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "new" ), "" );
+
+    loader.clearCache();
+    BOOST_CHECK_EQUAL( loader.findIcon( "new" ), dir + "22x22/apps/new.png" );
+
+    // icons added to a directory that was already read are found
+    // if they were not looked up before
+    addFile( "22x22/apps/other.png" );
+    BOOST_CHECK_EQUAL( loader.findIcon( "other" ), dir + "22x22/apps/other.png" );
+}
@@ -0,0 +1,131 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for the "Filter" property of YTable and YTree
+
+#define BOOST_TEST_MODULE YTableFilter_tests
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "YTable.h"
+#include "YTableHeader.h"
+#include "YTableItem.h"
+#include "YTree.h"
+#include "YUISymbols.h"
+
+using std::string;
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// a table without a UI, it only records the filters it gets
+class TestTable : public YTable
+{
+public:
+    TestTable() : YTable( 0, new YTableHeader(), false ), filterCalls( 0 ) {}
+
+    virtual void setFilter( const string & filter )
+    {
+        YTable::setFilter( filter );
+        filterCalls++;
+    }
+
+    virtual void cellChanged( const YTableCell * ) {}
+    virtual int preferredWidth()  { return 0; }
+    virtual int preferredHeight() { return 0; }
+    virtual void setSize( int, int ) {}
+
+    int filterCalls;
+};
+
+// a tree without a UI, it only records the filters it gets
+class TestTree : public YTree
+{
+public:
+    TestTree() : YTree( 0, "tree", false, false ), filterCalls( 0 ) {}
+
+    virtual void setFilter( const string & filter )
+    {
+        YTree::setFilter( filter );
+        filterCalls++;
+    }
+
+    virtual void rebuildTree() {}
+    virtual YTreeItem * currentItem() { return 0; }
+    virtual void activate() {}
+    virtual int preferredWidth()  { return 0; }
+    virtual int preferredHeight() { return 0; }
+    virtual void setSize( int, int ) {}
+
+    int filterCalls;
+};
+
+BOOST_AUTO_TEST_CASE( table_filter_property )
+{
+    // Widgets have to be created with operator new; they are not deleted
+    // since that needs a loaded UI
+    TestTable * table = new TestTable();
+
+    BOOST_CHECK_EQUAL( table->filter(), "" );
+    BOOST_CHECK( table->propertySet().contains( YUIProperty_Filter ) );
+
+    table->setProperty( YUIProperty_Filter, YPropertyValue( "foo" ) );
+    BOOST_CHECK_EQUAL( table->filterCalls, 1 );
+    BOOST_CHECK_EQUAL( table->filter(), "foo" );
+    BOOST_CHECK_EQUAL( table->getProperty( YUIProperty_Filter ).stringVal(), "foo" );
+
+    table->setFilter( "" );
+    BOOST_CHECK_EQUAL( table->getProperty( YUIProperty_Filter ).stringVal(), "" );
+}
+
+BOOST_AUTO_TEST_CASE( table_empty_filter_result )
+{
+    TestTable * table = new TestTable();
+    table->addItem( new YTableItem( "foo" ) );
+
+    // a filter that matches no item is still kept
+    table->setProperty( YUIProperty_Filter, YPropertyValue( "zzz" ) );
+    BOOST_CHECK_EQUAL( table->filterCalls, 1 );
+    BOOST_CHECK_EQUAL( table->filter(), "zzz" );
+    BOOST_CHECK_EQUAL( table->itemsCount(), 1 );
+
+    table->setFilter( "" );
+    BOOST_CHECK_EQUAL( table->filter(), "" );
+    BOOST_CHECK_EQUAL( table->itemsCount(), 1 );
+}
+
+BOOST_AUTO_TEST_CASE( tree_filter_property )
+{
+    TestTree * tree = new TestTree();
+
+    BOOST_CHECK_EQUAL( tree->filter(), "" );
+    BOOST_CHECK( tree->propertySet().contains( YUIProperty_Filter ) );
+
+    tree->setProperty( YUIProperty_Filter, YPropertyValue( "bar" ) );
+    BOOST_CHECK_EQUAL( tree->filterCalls, 1 );
+    BOOST_CHECK_EQUAL( tree->filter(), "bar" );
+    BOOST_CHECK_EQUAL( tree->getProperty( YUIProperty_Filter ).stringVal(), "bar" );
+}
@@ -0,0 +1,70 @@
+/*
+  Copyright (C) 2021 SUSE LLC
+
+  This library is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1 of the
+  License, or (at your option) version 3.0 of the License. This library
+  is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+  License for more details. You should have received a copy of the GNU
+  Lesser General Public License along with this library; if not, write
+  to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+  Floor, Boston, MA 02110-1301 USA
+*/
+
+// This is an unit test for the YWidget class
+
+#define BOOST_TEST_MODULE YWidget_tests
+#include <boost/test/unit_test.hpp>
+
+#include "YWidget.h"
+
+// decrease the log level to warnings
+struct LogWarnings {
+  // global initialization before running any test
+  void setup() {
+      boost::unit_test::unit_test_log.set_threshold_level( boost::unit_test::log_warnings );
+  }
+  // cleanup after all tests are finished
+  void teardown() { }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE( LogWarnings );
+
+// a widget without a UI
+class TestWidget : public YWidget
+{
+public:
+    TestWidget() : YWidget( 0 ) {}
+
+    virtual const char * widgetClass() const { return "TestWidget"; }
+    virtual int preferredWidth()  { return 0; }
+    virtual int preferredHeight() { return 0; }
+    virtual void setSize( int newWidth, int newHeight ) {}
+};
+
+BOOST_AUTO_TEST_CASE( serial )
+{
+    // Widgets have to be created with operator new; they are not deleted
+    // since that needs a loaded UI
+    YWidget * first  = new TestWidget();
+    YWidget * second = new TestWidget();
+
+    BOOST_CHECK( first->serial() > 0 );
+    BOOST_CHECK( second->serial() > first->serial() );
+
+    // the serial does not change
+    unsigned long long serial = first->serial();
+    YWidget::markChanged();
+    BOOST_CHECK_EQUAL( first->serial(), serial );
+}
+
+BOOST_AUTO_TEST_CASE( change_revision )
+{
+    unsigned long long revision = YWidget::changeRevision();
+
+    YWidget::markChanged();
+    BOOST_CHECK( YWidget::changeRevision() > revision );
+}
@@ -19,15 +19,16 @@
 Name:           libyui-ncurses
 
 # DO NOT manually bump the version here; instead, use rake version:bump
-Version:        4.2.14
+Version:        4.3.0
 Release:        0
 
-%define         so_version 15
+%define         so_version 16
 %define         bin_name %{name}%{so_version}
 
 BuildRequires:  boost-devel
 BuildRequires:  cmake >= 3.10
 BuildRequires:  gcc-c++
+BuildRequires:  libboost_test-devel
 BuildRequires:  libyui-devel >= %{version}
 BuildRequires:  ncurses-devel
 
@@ -112,6 +113,12 @@ cmake .. \
 make %{?jobs:-j%jobs}
 popd
 
+%check
+pushd %{name}
+cd build
+make test
+popd
+
 %install
 pushd %{name}
 cd build
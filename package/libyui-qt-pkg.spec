@@ -19,16 +19,17 @@
 Name:           libyui-qt-pkg
 
 # DO NOT manually bump the version here; instead, use rake version:bump
-Version:        4.2.14
+Version:        4.3.0
 Release:        0
 
-%define         so_version 15
+%define         so_version 16
 %define         libzypp_devel_version libzypp-devel >= 17.21.0
 %define         bin_name %{name}%{so_version}
 
 BuildRequires:  boost-devel
 BuildRequires:  cmake >= 3.10
 BuildRequires:  gcc-c++
+BuildRequires:  libboost_test-devel
 BuildRequires:  pkg-config
 
 BuildRequires:  pkgconfig(Qt5Core)
@@ -116,6 +117,12 @@ cmake .. \
 make %{?jobs:-j%jobs}
 popd
 
+%check
+pushd %{name}
+cd build
+make test
+popd
+
 %install
 pushd %{name}
 cd build
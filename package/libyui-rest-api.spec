@@ -19,18 +19,20 @@
 Name:           libyui-rest-api
 
 # DO NOT manually bump the version here; instead, use rake version:bump
-Version:        4.2.14
+Version:        4.3.0
 Release:        0
 
-%define         so_version 15
+%define         so_version 16
 %define         bin_name %{name}%{so_version}
 
 BuildRequires:  boost-devel
 BuildRequires:  cmake >= 3.10
 BuildRequires:  gcc-c++
 BuildRequires:  jsoncpp-devel
+BuildRequires:  libboost_test-devel
 BuildRequires:  libmicrohttpd-devel
 BuildRequires:  libyui-devel >= %{version}
+BuildRequires:  zlib-devel
 
 Summary:        Libyui - REST API plugin, the shared part
 License:        LGPL-2.1-only OR LGPL-3.0-only
@@ -97,6 +99,12 @@ cmake .. \
 make %{?jobs:-j%jobs}
 popd
 
+%check
+pushd %{name}
+cd build
+make test
+popd
+
 %install
 pushd %{name}
 cd build
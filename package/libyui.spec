@@ -19,10 +19,10 @@
 Name:           libyui
 
 # DO NOT manually bump the version here; instead, use rake version:bump
-Version:        4.2.14
+Version:        4.3.0
 Release:        0
 
-%define         so_version 15
+%define         so_version 16
 %define         bin_name %{name}%{so_version}
 
 BuildRequires:  boost-devel
@@ -104,6 +104,12 @@ cmake .. \
 make %{?jobs:-j%jobs}
 popd
 
+%check
+pushd %{name}
+cd build
+make test
+popd
+
 %install
 pushd %{name}
 cd build